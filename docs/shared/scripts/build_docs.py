@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""
+Parallel, incremental build driver for every book under docs/.
+
+    python3 shared/scripts/build_docs.py build [BOOK...]
+    python3 shared/scripts/build_docs.py lint [BOOK...]
+    python3 shared/scripts/build_docs.py all [BOOK...]
+
+A book is any directory beside shared/ holding a book.toml.
+
+build runs `make -C <book> build` for every book whose inputs changed since
+its last build, all books at once. The inputs are every file under src/
+and theme/ (symlinks followed, so the shared custom.css counts), book.toml,
+the book's Makefile, shared/config/book.template.toml and the mdbook
+version. Their SHA-256 is stored as build/.inputs-sha256 after a successful
+build; an unchanged hash with build/index.html present skips the book.
+
+lint runs markdownlint and cspell over the markdown under each src/. A
+result is cached per tool and file, keyed by the SHA-256 of the tool
+version, the book's tool config (.markdownlint.json, cspell.json) and the
+file contents, so only changed files are checked again; cached failures are
+reported again from the cache. Changed files are checked in one batch per
+book and tool, and only a failing batch is rerun file by file to attribute
+the failures. Unlike `make lint` nothing is rewritten (no --fix). Missing
+tools are skipped with a warning, as the book Makefiles do. The cache lives
+in docs/.cache, or $DOCS_CACHE_DIR.
+
+Exit status is 1 if a build failed, or with --strict if a lint check failed.
+"""
+import argparse
+import hashlib
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from typing import Dict, List, Optional, Sequence, Tuple
+
+DOCS_ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+SHARED_INPUTS = ("shared/config/book.template.toml",)
+STAMP = ".inputs-sha256"
+
+# Tool, per-book config files, command line before the file arguments
+LINTERS = (
+    ("markdownlint", (".markdownlint.json",), ("markdownlint",)),
+    ("cspell", ("cspell.json",), ("cspell", "--no-progress", "--no-summary")),
+)
+
+GREEN, YELLOW, RED, NC = "\033[0;32m", "\033[1;33m", "\033[0;31m", "\033[0m"
+
+
+def find_books(names: Sequence[str] = ()) -> List[str]:
+    """Book directories under DOCS_ROOT, or the named ones."""
+    books = sorted(
+        entry for entry in os.listdir(DOCS_ROOT)
+        if os.path.isfile(os.path.join(DOCS_ROOT, entry, "book.toml"))
+    )
+    for name in names:
+        if name not in books:
+            raise SystemExit(f"{RED}Error: Book '{name}' not found{NC}")
+    return list(names) if names else books
+
+
+def file_sha256(path: str) -> str:
+    """SHA-256 of a file's contents."""
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for block in iter(lambda: f.read(1 << 16), b""):
+            h.update(block)
+    return h.hexdigest()
+
+
+def tree_files(directory: str) -> List[str]:
+    """Files below directory, symlinks followed, sorted."""
+    found = []
+    for root, dirs, files in os.walk(directory, followlinks=True):
+        dirs.sort()
+        found.extend(os.path.join(root, name) for name in sorted(files))
+    return found
+
+
+def tool_version(command: str, book_dir: str) -> Optional[str]:
+    """`command --version`, or None when the tool is not installed."""
+    path = shutil.which(command, path=os.pathsep.join(
+        (os.path.join(book_dir, "node_modules", ".bin"), os.environ.get("PATH", ""))
+    ))
+    if path is None:
+        return None
+    result = subprocess.run([path, "--version"], capture_output=True, text=True)
+    return f"{path}\0{result.stdout.strip()}"
+
+
+def book_inputs_hash(book: str, mdbook_version: str) -> str:
+    """SHA-256 over every input of a book's HTML build."""
+    book_dir = os.path.join(DOCS_ROOT, book)
+    paths = [os.path.join(book_dir, name) for name in ("book.toml", "Makefile")]
+    paths += tree_files(os.path.join(book_dir, "src"))
+    paths += tree_files(os.path.join(book_dir, "theme"))
+    paths += [os.path.join(DOCS_ROOT, name) for name in SHARED_INPUTS]
+
+    h = hashlib.sha256(f"mdbook\0{mdbook_version}\0".encode())
+    for path in paths:
+        if os.path.isfile(path):
+            h.update(f"{os.path.relpath(path, DOCS_ROOT)}\0{file_sha256(path)}\0".encode())
+    return h.hexdigest()
+
+
+def build_book(book: str, mdbook_version: str, force: bool) -> Tuple[str, str, str]:
+    """
+    Build one book unless its inputs are unchanged.
+
+    Returns:
+        (book, status, output) with status "built", "skipped" or "failed"
+    """
+    book_dir = os.path.join(DOCS_ROOT, book)
+    build_dir = os.path.join(book_dir, "build")
+    stamp = os.path.join(build_dir, STAMP)
+    digest = book_inputs_hash(book, mdbook_version)
+
+    if not force and os.path.isfile(os.path.join(build_dir, "index.html")):
+        try:
+            with open(stamp) as f:
+                if f.read().strip() == digest:
+                    return book, "skipped", ""
+        except OSError:
+            pass
+
+    result = subprocess.run(["make", "--no-print-directory", "-C", book_dir, "build"],
+                            capture_output=True, text=True)
+    output = result.stdout + result.stderr
+    if result.returncode != 0:
+        return book, "failed", output
+    with open(stamp, "w") as f:
+        f.write(digest + "\n")
+    return book, "built", output
+
+
+class LintCache:
+    """Per-tool, per-file lint results keyed by content hash."""
+
+    def __init__(self, directory: str):
+        self.path = os.path.join(directory, "lint.json")
+        try:
+            with open(self.path) as f:
+                self.entries: Dict[str, Dict] = json.load(f)
+        except (OSError, ValueError):
+            self.entries = {}
+
+    def get(self, key: str) -> Optional[Dict]:
+        return self.entries.get(key)
+
+    def put(self, key: str, passed: bool, output: str) -> None:
+        self.entries[key] = {"passed": passed, "output": output}
+
+    def save(self, keep: Sequence[str]) -> None:
+        """Write the cache atomically, keeping only the given keys."""
+        entries = {k: self.entries[k] for k in keep if k in self.entries}
+        directory = os.path.dirname(self.path)
+        os.makedirs(directory, exist_ok=True)
+        fd, temporary = tempfile.mkstemp(dir=directory, suffix=".tmp")
+        with os.fdopen(fd, "w") as f:
+            json.dump(entries, f, indent=0, sort_keys=True)
+        os.replace(temporary, self.path)
+
+
+def lint_batch(command: Sequence[str], book_dir: str,
+               files: Sequence[str]) -> Tuple[int, str]:
+    """Run a linter over files from the book directory."""
+    tool = shutil.which(command[0], path=os.pathsep.join(
+        (os.path.join(book_dir, "node_modules", ".bin"), os.environ.get("PATH", ""))
+    ))
+    result = subprocess.run([tool, *command[1:], *files], cwd=book_dir,
+                            capture_output=True, text=True)
+    return result.returncode, result.stdout + result.stderr
+
+
+def lint_books(books: Sequence[str], pool: ThreadPoolExecutor, cache: LintCache,
+               ) -> Tuple[int, int, int, List[str]]:
+    """
+    Lint every book with every available tool, through the cache.
+
+    Returns:
+        (files checked, cache hits, failures, cache keys in use)
+    """
+    tasks = []
+    keys_in_use: List[str] = []
+    hits = failures = 0
+    for book in books:
+        book_dir = os.path.join(DOCS_ROOT, book)
+        sources = [os.path.relpath(p, book_dir) for p in tree_files(os.path.join(book_dir, "src"))
+                   if p.endswith(".md")]
+        for tool, configs, command in LINTERS:
+            version = tool_version(command[0], book_dir)
+            if version is None:
+                print(f"{YELLOW}⚠ {tool} not installed; skipping for {book}{NC}")
+                continue
+            prefix = hashlib.sha256(f"{tool}\0{version}\0".encode())
+            for config in configs:
+                path = os.path.join(book_dir, config)
+                if os.path.isfile(path):
+                    prefix.update(f"{config}\0{file_sha256(path)}\0".encode())
+            changed = []
+            for source in sources:
+                h = prefix.copy()
+                h.update(file_sha256(os.path.join(book_dir, source)).encode())
+                key = f"{book}/{source}\0{tool}\0{h.hexdigest()}"
+                keys_in_use.append(key)
+                cached = cache.get(key)
+                if cached is None:
+                    changed.append((source, key))
+                    continue
+                hits += 1
+                if not cached["passed"]:
+                    failures += 1
+                    print(f"{RED}✗ {tool}: {book}/{source} (cached){NC}\n{cached['output']}")
+            if changed:
+                tasks.append((book_dir, book, tool, command, changed))
+
+    def run(task):
+        book_dir, book, tool, command, changed = task
+        status, output = lint_batch(command, book_dir, [s for s, _ in changed])
+        if status == 0:
+            return [(book, tool, source, key, True, "") for source, key in changed]
+        # Attribute the batch failure file by file
+        results = []
+        for source, key in changed:
+            status, output = lint_batch(command, book_dir, [source])
+            results.append((book, tool, source, key, status == 0, output))
+        return results
+
+    checked = 0
+    for results in pool.map(run, tasks):
+        for book, tool, source, key, passed, output in results:
+            checked += 1
+            cache.put(key, passed, output)
+            if not passed:
+                failures += 1
+                print(f"{RED}✗ {tool}: {book}/{source}{NC}\n{output}")
+    return checked, hits, failures, keys_in_use
+
+
+def format_ns(ns: int) -> str:
+    """Nanoseconds as seconds with two decimals (integer arithmetic)."""
+    return f"{ns // 1_000_000_000}.{ns // 10_000_000 % 100:02d} s"
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("command", choices=("build", "lint", "all"))
+    parser.add_argument("books", nargs="*", help="default: every book")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 1)
+    parser.add_argument("--force", action="store_true", help="rebuild unchanged books")
+    parser.add_argument("--strict", action="store_true", help="fail on lint failures")
+    args = parser.parse_args(argv)
+
+    start = time.monotonic_ns()
+    books = find_books(args.books)
+    status = 0
+
+    with ThreadPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+        builds = []
+        if args.command in ("build", "all"):
+            mdbook = subprocess.run(["mdbook", "--version"], capture_output=True, text=True) \
+                if shutil.which("mdbook") else None
+            if mdbook is None:
+                print(f"{RED}✗ mdbook not installed{NC}")
+                return 1
+            version = mdbook.stdout.strip()
+            builds = [pool.submit(build_book, book, version, args.force) for book in books]
+
+        if args.command in ("lint", "all"):
+            cache = LintCache(os.environ.get("DOCS_CACHE_DIR") or os.path.join(DOCS_ROOT, ".cache"))
+            checked, hits, failures, keys = lint_books(books, pool, cache)
+            cache.save(keys)
+            print(f"Lint: {checked} checked, {hits} cached, {failures} failing")
+            if failures and args.strict:
+                status = 1
+
+        for future in builds:
+            book, outcome, output = future.result()
+            if outcome == "failed":
+                status = 1
+                print(f"{RED}✗ {book}: build failed{NC}\n{output}")
+            elif outcome == "built":
+                print(f"{GREEN}✓ {book}: built{NC}")
+            else:
+                print(f"{GREEN}✓ {book}: up to date{NC}")
+
+    print(f"Done in {format_ns(time.monotonic_ns() - start)}")
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
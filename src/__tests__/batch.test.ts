@@ -0,0 +1,108 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { submitBatchOperation } from '../operations/batch.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+
+const testSpecDir = '/tmp/test-batch-spec';
+const testArtifactDir = '/tmp/test-batch-artifacts';
+
+function writeComponent(namespace: string, spec: any): void {
+  const json = JSON.stringify(spec, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts: { spec: `${namespace}.${hash}` } }, null, 2)
+  );
+}
+
+function widgetSpec(namespace: string): any {
+  return {
+    $schema: 'http://json-schema.org/draft-07/schema#',
+    $id: `${namespace}.spec.json`,
+    namespace,
+    parent: 'hologram',
+    conformance: false,
+    type: 'object',
+  };
+}
+
+describe('Batch Submission', () => {
+  beforeEach(() => {
+    for (const dir of [testSpecDir, testArtifactDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+      fs.mkdirSync(dir, { recursive: true });
+    }
+    ArtifactStore.setShared(new ArtifactStore(testArtifactDir));
+
+    writeComponent('hologram.component', {
+      namespace: 'hologram.component',
+      conformance: false,
+      conformance_requirements: { docs: { required: false } },
+    });
+    writeComponent('hologram', {
+      $schema: 'http://json-schema.org/draft-07/schema#',
+      $id: 'hologram.spec',
+      type: 'object',
+      properties: { namespace: { type: 'string' }, conformance: { type: 'boolean' } },
+      required: ['namespace', 'conformance'],
+    });
+  });
+
+  afterEach(() => {
+    ArtifactStore.setShared(null);
+    for (const dir of [testSpecDir, testArtifactDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+  });
+
+  test('creates components from artifacts in the same batch', async () => {
+    const result = await submitBatchOperation(
+      [
+        { key: 'one', content: widgetSpec('hologram.one'), type: 'spec' },
+        { key: 'two', content: widgetSpec('hologram.two'), type: 'spec' },
+      ],
+      [
+        { namespace: 'hologram.one', artifacts: { spec: '@one' } },
+        { namespace: 'hologram.two', artifacts: { spec: '@two' } },
+      ],
+      testSpecDir
+    );
+    const report = JSON.parse(result.content[0].text);
+
+    expect(report.success).toBe(true);
+    expect(report.artifacts.every((a: any) => a.cid?.startsWith('cid:'))).toBe(true);
+    expect(report.manifests.map((m: any) => m.success)).toEqual([true, true]);
+    expect(fs.existsSync(path.join(testSpecDir, 'hologram.one.index.json'))).toBe(true);
+    expect(fs.existsSync(path.join(testSpecDir, 'hologram.two.index.json'))).toBe(true);
+  });
+
+  test('reports failures per item without stopping the batch', async () => {
+    const result = await submitBatchOperation(
+      [
+        { key: 'good', content: widgetSpec('hologram.good'), type: 'spec' },
+        { key: 'bad', content: { namespace: 42 }, type: 'conformance' },
+      ],
+      [
+        { namespace: 'hologram.good', artifacts: { spec: '@good' } },
+        { namespace: 'hologram.bad', artifacts: { spec: '@bad' } },
+        { namespace: 'hologram.missing', artifacts: { spec: '@nothing' } },
+      ],
+      testSpecDir
+    );
+    const report = JSON.parse(result.content[0].text);
+
+    expect(report.success).toBe(false);
+    expect(report.summary.failed).toBe(3);
+    expect(report.artifacts[1].success).toBe(false);
+    expect(report.manifests[0].success).toBe(true);
+    expect(report.manifests[1].message).toContain('artifact failed validation');
+    expect(report.manifests[2].message).toContain('no artifact with this key');
+  });
+});
@@ -0,0 +1,48 @@
+import { describe, test, expect } from '@jest/globals';
+import * as crypto from 'crypto';
+import { canonicalizeJSON, hashCanonicalJSON } from '../core/canonical-json.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+
+function stringDigest(value: any): string {
+  return crypto.createHash('sha256').update(canonicalizeJSON(value)).digest('hex');
+}
+
+function streamingDigest(value: any): string {
+  return hashCanonicalJSON(value, crypto.createHash('sha256')).digest('hex');
+}
+
+describe('Canonical JSON Hashing', () => {
+  test('matches the string encoding on edge cases', () => {
+    const values = [
+      null,
+      0,
+      'text with "quotes" and é',
+      [],
+      {},
+      [1, null, undefined, () => 1, { z: undefined, y: NaN }],
+      { b: 1, a: { d: [true, false], c: 'x' }, date: new Date(0) },
+    ];
+    for (const value of values) {
+      expect(streamingDigest(value)).toBe(stringDigest(value));
+    }
+  });
+
+  test('matches the string encoding across chunk boundaries', () => {
+    const large: Record<string, any> = {};
+    for (let i = 0; i < 5000; i++) {
+      large[`key${(i * 7919) % 5000}`] = { values: [i, i / 3, `value-${i}`], nested: { i } };
+    }
+    expect(canonicalizeJSON(large).length).toBeGreaterThan(64 * 1024);
+    expect(streamingDigest(large)).toBe(stringDigest(large));
+  });
+
+  test('rejects values without a JSON encoding', () => {
+    expect(() => streamingDigest(undefined)).toThrow(TypeError);
+  });
+
+  test('generates the same CID as before', () => {
+    const store = new ArtifactStore('/tmp/test-canonical-json-artifacts');
+    const content = { namespace: 'hologram.test', list: [3, 1, 2], meta: { b: 2, a: 1 } };
+    expect(store.generateCID(content)).toBe(`cid:${stringDigest(content)}`);
+  });
+});
@@ -0,0 +1,29 @@
+import { describe, test, expect } from '@jest/globals';
+import { mapConcurrent, yieldToEventLoop } from '../core/concurrency.js';
+
+describe('Concurrency', () => {
+  test('mapConcurrent keeps order and never exceeds the limit', async () => {
+    let inFlight = 0;
+    let peak = 0;
+    const items = Array.from({ length: 25 }, (_, i) => i);
+
+    const results = await mapConcurrent(items, 3, async item => {
+      inFlight++;
+      peak = Math.max(peak, inFlight);
+      await new Promise(resolve => setTimeout(resolve, (item * 7) % 5));
+      inFlight--;
+      return item * 2;
+    });
+
+    expect(results).toEqual(items.map(i => i * 2));
+    expect(peak).toBe(3);
+    expect(await mapConcurrent([], 3, async () => 1)).toEqual([]);
+  });
+
+  test('yieldToEventLoop lets pending timers run', async () => {
+    let fired = false;
+    setImmediate(() => { fired = true; });
+    await yieldToEventLoop();
+    expect(fired).toBe(true);
+  });
+});
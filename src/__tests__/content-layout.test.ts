@@ -0,0 +1,90 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { ContentLayout } from '../core/content-layout.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+
+const testSpecDir = '/tmp/test-content-layout-spec';
+const testArtifactDir = '/tmp/test-content-layout-artifacts';
+
+function writeArtifact(namespace: string, content: any): { ref: string; hash: string } {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  return { ref: `${namespace}.${hash}`, hash };
+}
+
+describe('Content Layout', () => {
+  beforeEach(() => {
+    for (const dir of [testSpecDir, testArtifactDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    for (const dir of [testSpecDir, testArtifactDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+  });
+
+  test('shards only content-addressed files', () => {
+    const hash = 'ab'.padEnd(64, '0');
+    expect(ContentLayout.shardOf(`hologram.x.${hash}.json`)).toBe('ab');
+    expect(ContentLayout.shardOf(`cid:${hash}`)).toBe('ab');
+    expect(ContentLayout.shardOf('hologram.x.index.json')).toBeNull();
+    expect(ContentLayout.shardOf('validation-ledger.json')).toBeNull();
+  });
+
+  test('catalog reads a tree before and after migration', () => {
+    const { ref, hash } = writeArtifact('hologram.widget', { namespace: 'hologram.widget' });
+    fs.writeFileSync(
+      path.join(testSpecDir, 'hologram.widget.index.json'),
+      JSON.stringify({ namespace: 'hologram.widget', artifacts: { spec: ref } })
+    );
+
+    const layout = new ContentLayout(testSpecDir);
+    expect(layout.getMode()).toBe('flat');
+    expect(layout.migrate('sharded')).toBe(1);
+
+    const shardedPath = path.join(testSpecDir, hash.slice(0, 2), `${ref}.json`);
+    expect(fs.existsSync(shardedPath)).toBe(true);
+    expect(fs.existsSync(path.join(testSpecDir, 'hologram.widget.index.json'))).toBe(true);
+
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getLayout().isSharded()).toBe(true);
+    expect(catalog.hasArtifact(ref)).toBe(true);
+    expect(catalog.getArtifact(ref)).toEqual({ namespace: 'hologram.widget' });
+    expect(catalog.artifactPath(ref)).toBe(shardedPath);
+
+    expect(new ContentLayout(testSpecDir).migrate('flat')).toBe(1);
+    expect(fs.existsSync(path.join(testSpecDir, hash.slice(0, 2)))).toBe(false);
+    expect(new SpecCatalog(testSpecDir).getArtifact(ref)).toEqual({ namespace: 'hologram.widget' });
+  });
+
+  test('resolves files left in the other layout', () => {
+    const { ref } = writeArtifact('hologram.stray', { namespace: 'hologram.stray' });
+    fs.writeFileSync(path.join(testSpecDir, '.layout'), 'sharded\n');
+
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getArtifact(ref)).toEqual({ namespace: 'hologram.stray' });
+  });
+
+  test('artifact store writes into shards once migrated', () => {
+    fs.mkdirSync(testArtifactDir, { recursive: true });
+    new ContentLayout(testArtifactDir).migrate('sharded');
+
+    const store = new ArtifactStore(testArtifactDir, { maxEntries: 0 });
+    const cid = store.storeArtifact({ namespace: 'hologram.sharded' });
+    const shard = cid.slice('cid:'.length, 'cid:'.length + 2);
+
+    expect(fs.existsSync(path.join(testArtifactDir, shard, cid))).toBe(true);
+    expect(store.getArtifact(cid)).toEqual({ namespace: 'hologram.sharded' });
+  });
+});
@@ -0,0 +1,90 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { DependencyIndex } from '../core/dependency-index.js';
+import { deleteOperation } from '../operations/delete.js';
+
+const testSpecDir = '/tmp/test-dependency-index-spec';
+const testIndexFile = '/tmp/test-dependency-index/dependents.json';
+
+function writeComponent(namespace: string, spec: any): void {
+  const json = JSON.stringify(spec, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts: { spec: `${namespace}.${hash}` } }, null, 2)
+  );
+}
+
+describe('Dependency Index', () => {
+  beforeEach(() => {
+    for (const dir of [testSpecDir, path.dirname(testIndexFile)]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+
+    writeComponent('hologram.base', { $id: 'hologram.base.spec', type: 'object' });
+    writeComponent('hologram.child', { parent: 'hologram.base' });
+    writeComponent('hologram.user', { $ref: 'hologram.child.spec#/definitions/x' });
+    writeComponent('hologram.baseline', { type: 'object' });
+  });
+
+  afterEach(() => {
+    for (const dir of [testSpecDir, path.dirname(testIndexFile)]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+  });
+
+  test('matches references on namespace boundaries', () => {
+    expect(DependencyIndex.referenceTargets('hologram.child.spec#/definitions/x'))
+      .toEqual(['hologram', 'hologram.child', 'hologram.child.spec']);
+  });
+
+  test('finds dependents through parent and $ref', () => {
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getDependents('hologram.base')).toEqual(['hologram.child']);
+    expect(catalog.getDependents('hologram.child')).toEqual(['hologram.user']);
+    expect(catalog.getDependents('hologram.baseline')).toEqual([]);
+  });
+
+  test('tracks components rewritten through the catalog', () => {
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getDependents('hologram.baseline')).toEqual([]);
+
+    writeComponent('hologram.child', { parent: 'hologram.baseline' });
+    catalog.invalidateNamespace('hologram.child');
+
+    expect(catalog.getDependents('hologram.base')).toEqual([]);
+    expect(catalog.getDependents('hologram.baseline')).toEqual(['hologram.child']);
+  });
+
+  test('reloads a persisted index and rescans changed components', () => {
+    const first = new SpecCatalog(testSpecDir, { dependencyIndexFile: testIndexFile });
+    expect(first.getDependents('hologram.base')).toEqual(['hologram.child']);
+    expect(fs.existsSync(testIndexFile)).toBe(true);
+
+    // Changed by another process: the index file stamp no longer matches
+    writeComponent('hologram.extra', { parent: 'hologram.base' });
+    fs.rmSync(path.join(testSpecDir, 'hologram.user.index.json'));
+
+    const second = new SpecCatalog(testSpecDir, { dependencyIndexFile: testIndexFile });
+    expect(second.getDependents('hologram.base')).toEqual(['hologram.child', 'hologram.extra']);
+    expect(second.getDependents('hologram.child')).toEqual([]);
+  });
+
+  test('delete refuses to remove a component with dependents', async () => {
+    const blocked = await deleteOperation('hologram.base', testSpecDir);
+    expect(blocked.content[0].text).toContain('hologram.child');
+    expect(fs.existsSync(path.join(testSpecDir, 'hologram.base.index.json'))).toBe(true);
+
+    const removed = await deleteOperation('hologram.user', testSpecDir);
+    expect(removed.content[0].text).toContain('Successfully deleted');
+  });
+});
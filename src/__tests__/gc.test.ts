@@ -0,0 +1,203 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { analyzeSpec, cleanOrphans } from '../utils/gc.js';
+import { SpecPack, PACK_FILE } from '../core/spec-pack.js';
+
+const testRoot = '/tmp/test-gc';
+const testSpecDir = path.join(testRoot, 'spec');
+const testStateFile = path.join(testRoot, '.artifacts', 'gc-state.json');
+
+// Fixed mtime, in whole seconds so the recorded stamp survives utimes exactly
+const MTIME = 1700000000;
+
+function writeArtifact(namespace: string, content: any): string {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  return `${namespace}.${hash}`;
+}
+
+/**
+ * Write an index with a fixed mtime; artifact references all have the same
+ * length, so pointing an index elsewhere keeps its size and thus its stamp
+ */
+function writeIndex(namespace: string, artifacts: Record<string, string>, mtime: number = MTIME): void {
+  const indexPath = path.join(testSpecDir, `${namespace}.index.json`);
+  fs.writeFileSync(indexPath, JSON.stringify({ namespace, artifacts }, null, 2));
+  fs.utimesSync(indexPath, mtime, mtime);
+}
+
+function sizeOf(artifactRef: string): number {
+  return fs.statSync(path.join(testSpecDir, `${artifactRef}.json`)).size;
+}
+
+function analyze() {
+  return analyzeSpec({ specDir: testSpecDir, stateFile: testStateFile });
+}
+
+function editState(edit: (state: any) => void): void {
+  const state = JSON.parse(fs.readFileSync(testStateFile, 'utf-8'));
+  edit(state);
+  fs.writeFileSync(testStateFile, JSON.stringify(state));
+}
+
+describe('GC', () => {
+  let first: string;
+  let second: string;
+
+  beforeEach(() => {
+    fs.rmSync(testRoot, { recursive: true, force: true });
+    fs.mkdirSync(testSpecDir, { recursive: true });
+
+    first = writeArtifact('hologram.alpha', { version: 1 });
+    second = writeArtifact('hologram.alpha', { version: 2 });
+    writeIndex('hologram.alpha', { spec: first });
+  });
+
+  afterEach(() => {
+    fs.rmSync(testRoot, { recursive: true, force: true });
+  });
+
+  test('should persist the state of every index and referenced file', () => {
+    const result = analyze();
+    expect(result.orphanedFiles).toEqual([`${second}.json`]);
+
+    const state = JSON.parse(fs.readFileSync(testStateFile, 'utf-8'));
+    expect(state.specDir).toBe(path.resolve(testSpecDir));
+    expect(state.components['hologram.alpha.index.json'].artifacts).toEqual({ spec: first });
+    expect(Object.keys(state.files)).toEqual([`${first}.json`]);
+  });
+
+  test('should reuse the state on an unchanged rerun', () => {
+    analyze();
+
+    // Same size and mtime: the recorded artifacts stand in for the index
+    writeIndex('hologram.alpha', { spec: second });
+    const result = analyze();
+
+    expect(result.orphanedFiles).toEqual([`${second}.json`]);
+  });
+
+  test('should re-read an index whose stamp changed', () => {
+    analyze();
+
+    writeIndex('hologram.alpha', { spec: second }, MTIME + 1);
+    const result = analyze();
+
+    expect(result.orphanedFiles).toEqual([`${first}.json`]);
+    const state = JSON.parse(fs.readFileSync(testStateFile, 'utf-8'));
+    expect(state.components['hologram.alpha.index.json'].artifacts).toEqual({ spec: second });
+    expect(Object.keys(state.files)).toEqual([`${second}.json`]);
+  });
+
+  test('should drop the state of removed files', () => {
+    analyze();
+
+    fs.unlinkSync(path.join(testSpecDir, 'hologram.alpha.index.json'));
+    analyze();
+
+    const state = JSON.parse(fs.readFileSync(testStateFile, 'utf-8'));
+    expect(state.components).toEqual({});
+    expect(state.files).toEqual({});
+  });
+
+  test('should ignore state recorded for another spec directory', () => {
+    analyze();
+    editState(state => { state.specDir = '/elsewhere/spec'; });
+
+    writeIndex('hologram.alpha', { spec: second });
+    const result = analyze();
+
+    expect(result.orphanedFiles).toEqual([`${first}.json`]);
+  });
+
+  test('should ignore state of another format', () => {
+    analyze();
+    editState(state => { state.format = 0; });
+
+    writeIndex('hologram.alpha', { spec: second });
+    const result = analyze();
+
+    expect(result.orphanedFiles).toEqual([`${first}.json`]);
+  });
+
+  test('should ignore an unreadable state file', () => {
+    analyze();
+    fs.writeFileSync(testStateFile, '{ not json');
+
+    writeIndex('hologram.alpha', { spec: second });
+    const result = analyze();
+
+    expect(result.orphanedFiles).toEqual([`${first}.json`]);
+  });
+
+  test('should report reclaimable bytes per namespace', () => {
+    const betaKept = writeArtifact('hologram.beta', { kept: true });
+    const betaOrphans = [
+      writeArtifact('hologram.beta', { orphan: 1 }),
+      writeArtifact('hologram.beta', { orphan: 'much longer than the first' }),
+    ];
+    writeIndex('hologram.beta', { spec: betaKept });
+
+    const result = analyze();
+
+    expect(result.reclaimable.get('hologram.alpha')).toEqual({ files: 1, bytes: sizeOf(second) });
+    expect(result.reclaimable.get('hologram.beta')).toEqual({
+      files: 2,
+      bytes: sizeOf(betaOrphans[0]) + sizeOf(betaOrphans[1]),
+    });
+    expect(result.reclaimable.size).toBe(2);
+    expect(result.reclaimableBytes).toBe(sizeOf(second) + sizeOf(betaOrphans[0]) + sizeOf(betaOrphans[1]));
+  });
+
+  test('should report the same reclaimable bytes from the state', () => {
+    writeArtifact('hologram.beta', { orphan: 1 });
+    const cold = analyze();
+    const warm = analyze();
+
+    expect(warm.reclaimable).toEqual(cold.reclaimable);
+    expect(warm.reclaimableBytes).toBe(cold.reclaimableBytes);
+  });
+
+  test('should report unreferenced packed artifacts and repack on clean', () => {
+    SpecPack.build(testSpecDir);
+    const packBytes = fs.statSync(path.join(testSpecDir, PACK_FILE)).size;
+
+    const result = analyze();
+    expect(result.packBytes).toBe(packBytes);
+    expect(result.packedOrphans).toEqual([second]);
+    expect(result.packReclaimableBytes).toBe(`${second}\n`.length + sizeOf(second));
+    expect(analyze().packedOrphans).toEqual([second]);
+
+    const cleaned = cleanOrphans({ specDir: testSpecDir, stateFile: testStateFile });
+    expect(cleaned.deleted).toEqual([`${second}.json`]);
+    expect(cleaned.pack).toEqual({
+      before: packBytes,
+      after: fs.statSync(path.join(testSpecDir, PACK_FILE)).size,
+    });
+    expect(cleaned.pack!.after).toBeLessThan(packBytes);
+
+    const pack = SpecPack.open(testSpecDir)!;
+    try {
+      expect(pack.has(first)).toBe(true);
+      expect(pack.has(second)).toBe(false);
+    } finally {
+      pack.close();
+    }
+    expect(analyze().packedOrphans).toEqual([]);
+  });
+
+  test('should not repack without packed orphans', () => {
+    const cleaned = cleanOrphans({ specDir: testSpecDir, stateFile: testStateFile });
+    expect(cleaned.deleted).toEqual([`${second}.json`]);
+    expect(cleaned.pack).toBeNull();
+    expect(fs.existsSync(path.join(testSpecDir, PACK_FILE))).toBe(false);
+  });
+
+  test('should not persist anything with the state disabled', () => {
+    analyzeSpec({ specDir: testSpecDir, stateFile: null });
+    expect(fs.existsSync(testStateFile)).toBe(false);
+  });
+});
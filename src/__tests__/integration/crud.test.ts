@@ -12,6 +12,7 @@ import { deleteOperation } from '../../operations/delete';
 import { ComponentFiles } from '../../types';
 import * as fs from 'fs';
 import * as path from 'path';
+import * as crypto from 'crypto';
 
 describe('MCP Server - CRUD Operations', () => {
   const testSpecDir = '/tmp/test-spec-crud';
@@ -205,6 +206,20 @@ describe('MCP Server - CRUD Operations', () => {
       expect(result.content[0].text).toContain('hologram.component');
     });
 
+    it('should return the file as stored, not re-serialized', async () => {
+      // Compact JSON, unlike the pretty-printed form of the parsed content
+      const raw = JSON.stringify({ namespace: 'hologram.rawread', description: 'stored compact' });
+      const hash = crypto.createHash('sha256').update(raw).digest('hex');
+      fs.writeFileSync(path.join(testSpecDir, `hologram.rawread.${hash}.json`), raw);
+      fs.writeFileSync(
+        path.join(testSpecDir, 'hologram.rawread.index.json'),
+        JSON.stringify({ namespace: 'hologram.rawread', artifacts: { spec: `hologram.rawread.${hash}` } }, null, 2)
+      );
+
+      const result = await readOperation('hologram.rawread', 'spec', testSpecDir);
+      expect(result.content[0].text).toBe(raw);
+    });
+
     it('should read test conformance file', async () => {
       const result = await readOperation('hologram.component', 'test', testSpecDir);
       expect(result.content[0].text).toContain('test');
@@ -216,6 +231,18 @@ describe('MCP Server - CRUD Operations', () => {
       expect(response.spec).toBeDefined();
     });
 
+    it('should return only the requested fields', async () => {
+      const result = await readOperation('hologram.component', undefined, testSpecDir, {
+        fields: ['/spec/$id', '/spec/no-such-field'],
+      });
+      const response = JSON.parse(result.content[0].text);
+      expect(Object.keys(response.fields)).toEqual(['/spec/$id']);
+      expect(response.missing).toEqual(['/spec/no-such-field']);
+
+      const single = await readOperation('hologram.component', 'spec', testSpecDir, { fields: ['/$id'] });
+      expect(JSON.parse(single.content[0].text).fields['/$id']).toBe(response.fields['/spec/$id']);
+    });
+
     it('should return error for non-existent file', async () => {
       const result = await readOperation('hologram.nonexistent', undefined, testSpecDir);
       expect(result.content[0].text).toContain('not found');
@@ -283,6 +310,32 @@ describe('MCP Server - CRUD Operations', () => {
     });
   });
 
+  describe('Concurrent Updates', () => {
+    it('should keep the changes of concurrent updates to one component', async () => {
+      const namespace = 'hologram.component';
+      const spec = JSON.parse((await readOperation(namespace, 'spec', testSpecDir)).content[0].text);
+      const docs = JSON.parse((await readOperation(namespace, 'docs', testSpecDir)).content[0].text);
+
+      const results = await Promise.all([
+        updateOperation(namespace, { spec: { ...spec, description: 'Concurrent spec update' } }, testSpecDir),
+        updateOperation(namespace, { docs: { ...docs, description: 'Concurrent docs update' } }, testSpecDir),
+      ]);
+      for (const result of results) {
+        expect(result.content[0].text).toContain('✅');
+      }
+
+      // Both changes landed, and every file the index references exists
+      const index = JSON.parse(fs.readFileSync(path.join(testSpecDir, `${namespace}.index.json`), 'utf-8'));
+      for (const artifactRef of Object.values(index.artifacts) as string[]) {
+        expect(fs.existsSync(path.join(testSpecDir, `${artifactRef}.json`))).toBe(true);
+      }
+      const specAfter = JSON.parse((await readOperation(namespace, 'spec', testSpecDir)).content[0].text);
+      const docsAfter = JSON.parse((await readOperation(namespace, 'docs', testSpecDir)).content[0].text);
+      expect(specAfter.description).toBe('Concurrent spec update');
+      expect(docsAfter.description).toBe('Concurrent docs update');
+    });
+  });
+
   describe('Delete Operation', () => {
     it('should delete component with no dependencies', async () => {
       // First create a test component using the lifecycle pattern
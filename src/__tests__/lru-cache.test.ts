@@ -0,0 +1,64 @@
+import { describe, test, expect, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import { LRUCache } from '../core/lru-cache.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+
+const testArtifactDir = '/tmp/test-lru-artifacts';
+
+describe('LRU Cache', () => {
+  afterEach(() => {
+    if (fs.existsSync(testArtifactDir)) {
+      fs.rmSync(testArtifactDir, { recursive: true });
+    }
+  });
+
+  test('evicts the least recently used entry when full', () => {
+    const cache = new LRUCache<string, number>({ maxEntries: 2, maxBytes: 1000 });
+    cache.set('a', 1, 10);
+    cache.set('b', 2, 10);
+    expect(cache.get('a')).toBe(1);
+    cache.set('c', 3, 10);
+
+    expect(cache.has('a')).toBe(true);
+    expect(cache.has('b')).toBe(false);
+    expect(cache.getStats()).toEqual({ entries: 2, bytes: 20, hits: 1, misses: 0, evictions: 1 });
+  });
+
+  test('stays within the byte budget', () => {
+    const cache = new LRUCache<string, string>({ maxEntries: 100, maxBytes: 100 });
+    for (let i = 0; i < 10; i++) {
+      cache.set(`k${i}`, 'x', 30);
+    }
+    cache.set('huge', 'x', 500);
+
+    const stats = cache.getStats();
+    expect(stats.bytes).toBeLessThanOrEqual(100);
+    expect(stats.entries).toBe(3);
+    expect(cache.has('huge')).toBe(false);
+    expect(cache.get('k0')).toBeUndefined();
+    expect(cache.getStats().misses).toBe(1);
+  });
+
+  test('replacing an entry updates its size', () => {
+    const cache = new LRUCache<string, string>({ maxEntries: 10, maxBytes: 100 });
+    cache.set('a', 'old', 60);
+    cache.set('a', 'new', 20);
+    expect(cache.getStats().bytes).toBe(20);
+    expect(cache.get('a')).toBe('new');
+  });
+
+  test('artifact store reads evicted artifacts back from disk', () => {
+    const store = new ArtifactStore(testArtifactDir, { maxEntries: 1 });
+    const first = store.storeArtifact({ namespace: 'hologram.first' });
+    const second = store.storeArtifact({ namespace: 'hologram.second' });
+
+    expect(store.getCacheStats().evictions).toBe(1);
+    expect(store.getArtifact(second)).toEqual({ namespace: 'hologram.second' });
+    expect(store.getArtifact(first)).toEqual({ namespace: 'hologram.first' });
+
+    const stats = store.getCacheStats();
+    expect(stats.entries).toBe(1);
+    expect(stats.hits).toBe(1);
+    expect(stats.misses).toBe(1);
+  });
+});
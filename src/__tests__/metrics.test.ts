@@ -0,0 +1,57 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { Metrics, metrics } from '../core/metrics.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+
+const testSpecDir = '/tmp/test-metrics-spec';
+
+describe('Metrics', () => {
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('buckets tool latencies and reports percentiles', () => {
+    const m = new Metrics();
+    for (let i = 0; i < 90; i++) m.recordTool('read', 0.5, true);
+    for (let i = 0; i < 9; i++) m.recordTool('read', 40, true);
+    m.recordTool('read', 12000, false);
+
+    const read = m.snapshot().tools.read;
+    expect(read.count).toBe(100);
+    expect(read.errors).toBe(1);
+    expect(read.p50Ms).toBe(1);
+    expect(read.p95Ms).toBe(50);
+    expect(read.p99Ms).toBe(50);
+    expect(read.maxMs).toBe(12000);
+    expect(read.buckets).toEqual({ '1': 90, '50': 9, '+Inf': 1 });
+    expect(m.snapshot().tools.validate).toBeUndefined();
+  });
+
+  test('counts catalog reads, bytes parsed and cache hits', () => {
+    const json = JSON.stringify({ namespace: 'hologram.metric' }, null, 2);
+    const hash = crypto.createHash('sha256').update(json).digest('hex');
+    fs.writeFileSync(path.join(testSpecDir, `hologram.metric.${hash}.json`), json);
+
+    const before = metrics.snapshot();
+    const catalog = new SpecCatalog(testSpecDir);
+    catalog.getArtifact(`hologram.metric.${hash}`);
+    catalog.getArtifact(`hologram.metric.${hash}`);
+    const after = metrics.snapshot();
+
+    expect(after.io.filesRead - before.io.filesRead).toBe(1);
+    expect(after.io.bytesParsed - before.io.bytesParsed).toBe(json.length);
+    expect(after.catalog.hits - before.catalog.hits).toBe(1);
+    expect(after.catalog.misses - before.catalog.misses).toBe(1);
+  });
+});
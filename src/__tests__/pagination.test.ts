@@ -0,0 +1,62 @@
+import { describe, test, expect } from '@jest/globals';
+import { paginate, matchesPrefix, decodeCursor } from '../core/pagination.js';
+import { resolvePointer, projectPointers } from '../core/json-pointer.js';
+
+describe('Pagination', () => {
+  const namespaces = [
+    'hologram.interface', 'hologram.interface.spec', 'hologram.interfaces',
+    'hologram.docs', 'hologram.test', 'hologram', 'other.component',
+  ];
+
+  test('matches prefixes on namespace boundaries', () => {
+    expect(namespaces.filter(ns => matchesPrefix(ns, 'hologram.interface')))
+      .toEqual(['hologram.interface', 'hologram.interface.spec']);
+    expect(namespaces.filter(ns => matchesPrefix(ns, 'hologram.')).length).toBe(5);
+    expect(namespaces.filter(ns => matchesPrefix(ns, undefined)).length).toBe(namespaces.length);
+  });
+
+  test('walks every namespace once in sorted order', () => {
+    const seen: string[] = [];
+    let cursor: string | undefined;
+    do {
+      const page = paginate(namespaces, { cursor, limit: 2 });
+      expect(page.total).toBe(namespaces.length);
+      expect(page.items.length).toBeLessThanOrEqual(2);
+      seen.push(...page.items);
+      cursor = page.nextCursor ?? undefined;
+    } while (cursor);
+
+    expect(seen).toEqual([...namespaces].sort());
+  });
+
+  test('cursors survive components added before them', () => {
+    const first = paginate(namespaces, { prefix: 'hologram', limit: 3 });
+    const grown = [...namespaces, 'hologram.aaa'];
+    const second = paginate(grown, { prefix: 'hologram', cursor: first.nextCursor!, limit: 3 });
+
+    expect(second.items[0] > first.items[2]).toBe(true);
+    expect(second.items).not.toContain('hologram.aaa');
+    expect(() => decodeCursor('not-a-cursor')).toThrow('Invalid cursor');
+  });
+});
+
+describe('JSON pointers', () => {
+  const doc = { a: { 'b/c': [10, { 'd~e': true }] }, empty: null };
+
+  test('resolves escaped tokens and array indexes', () => {
+    expect(resolvePointer(doc, '')).toBe(doc);
+    expect(resolvePointer(doc, '/a/b~1c/0')).toBe(10);
+    expect(resolvePointer(doc, '/a/b~1c/1/d~0e')).toBe(true);
+    expect(resolvePointer(doc, '/empty')).toBeNull();
+    expect(resolvePointer(doc, '/a/b~1c/01')).toBeUndefined();
+    expect(resolvePointer(doc, '/a/missing')).toBeUndefined();
+    expect(() => resolvePointer(doc, 'a')).toThrow('Invalid JSON pointer');
+  });
+
+  test('projects found fields and lists missing ones', () => {
+    expect(projectPointers(doc, ['/a/b~1c/0', '/nope'])).toEqual({
+      fields: { '/a/b~1c/0': 10 },
+      missing: ['/nope'],
+    });
+  });
+});
@@ -0,0 +1,125 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { SchemaValidator } from '../core/schema-validator.js';
+
+const testSpecDir = '/tmp/test-spec-catalog';
+
+function writeSpec(namespace: string, content: any): string {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  const ref = `${namespace}.${hash}`;
+  fs.writeFileSync(path.join(testSpecDir, `${ref}.json`), json);
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts: { spec: ref } }, null, 2)
+  );
+  return ref;
+}
+
+function numberSchema(id: string, minimum: number) {
+  return {
+    $schema: 'http://json-schema.org/draft-07/schema#',
+    $id: id,
+    type: 'object',
+    properties: { value: { type: 'number', minimum } },
+  };
+}
+
+describe('Spec Catalog', () => {
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    SchemaValidator.setShared(null);
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('serves indexes and artifacts from memory after first read', () => {
+    const ref = writeSpec('hologram.cached', numberSchema('hologram.cached.spec', 0));
+    const catalog = new SpecCatalog(testSpecDir);
+
+    expect(catalog.listNamespaces()).toEqual(['hologram.cached']);
+    expect(catalog.getIndex('hologram.cached')?.artifacts.spec).toBe(ref);
+    expect(catalog.getArtifact(ref).$id).toBe('hologram.cached.spec');
+
+    fs.unlinkSync(path.join(testSpecDir, `${ref}.json`));
+    fs.unlinkSync(path.join(testSpecDir, 'hologram.cached.index.json'));
+
+    expect(catalog.getIndex('hologram.cached')?.artifacts.spec).toBe(ref);
+    expect(catalog.getArtifact(ref)).not.toBeNull();
+  });
+
+  test('prefetch reads indexes and artifacts into the synchronous caches', async () => {
+    const refs = Array.from({ length: 20 }, (_, i) =>
+      writeSpec(`hologram.async${i}`, numberSchema(`hologram.async${i}.spec`, i))
+    );
+    const catalog = new SpecCatalog(testSpecDir);
+
+    const namespaces = await catalog.listNamespacesAsync();
+    expect(namespaces.sort()).toEqual(refs.map((_, i) => `hologram.async${i}`).sort());
+    await catalog.prefetch([...namespaces, 'hologram.missing'], 4);
+    expect(await catalog.getIndexAsync('hologram.missing')).toBeNull();
+
+    fs.rmSync(testSpecDir, { recursive: true });
+    fs.mkdirSync(testSpecDir);
+    refs.forEach((ref, i) => {
+      expect(catalog.getIndex(`hologram.async${i}`)?.artifacts.spec).toBe(ref);
+      expect(catalog.getArtifact(ref).$id).toBe(`hologram.async${i}.spec`);
+    });
+  });
+
+  test('re-reads an index after invalidation', () => {
+    writeSpec('hologram.changing', numberSchema('hologram.changing.spec', 0));
+    const catalog = new SpecCatalog(testSpecDir);
+    catalog.getIndex('hologram.changing');
+
+    const newRef = writeSpec('hologram.changing', numberSchema('hologram.changing.spec', 10));
+    expect(catalog.getIndex('hologram.changing')?.artifacts.spec).not.toBe(newRef);
+
+    catalog.invalidateNamespace('hologram.changing');
+    expect(catalog.getIndex('hologram.changing')?.artifacts.spec).toBe(newRef);
+  });
+
+  test('hands out the shared validator only for its spec directory', () => {
+    const shared = new SchemaValidator(testSpecDir);
+    SchemaValidator.setShared(shared);
+
+    expect(SchemaValidator.forSpecDir(testSpecDir)).toBe(shared);
+    expect(SchemaValidator.forSpecDir(`${testSpecDir}/`)).toBe(shared);
+    expect(SchemaValidator.forSpecDir('/tmp/some-other-spec')).not.toBe(shared);
+  });
+
+  test('re-registers a component schema in place when it changes', async () => {
+    writeSpec('hologram.ranged', numberSchema('hologram.ranged.spec', 0));
+    const validator = new SchemaValidator(testSpecDir);
+
+    const before = await validator.validateAgainstSchema({ value: 5 }, 'hologram.ranged.spec');
+    expect(before.valid).toBe(true);
+
+    writeSpec('hologram.ranged', numberSchema('hologram.ranged.spec', 10));
+    validator.invalidate('hologram.ranged');
+
+    const after = await validator.validateAgainstSchema({ value: 5 }, 'hologram.ranged.spec');
+    expect(after.valid).toBe(false);
+  });
+
+  test('compiles candidate schemas without registering their $id', async () => {
+    const validator = new SchemaValidator(testSpecDir);
+
+    expect(() => validator.compileDetached(numberSchema('hologram.draft.spec', 0))).not.toThrow();
+    expect(() => validator.compileDetached(numberSchema('hologram.draft.spec', 1))).not.toThrow();
+
+    const result = await validator.validateAgainstSchema({ value: 1 }, 'hologram.draft.spec');
+    expect(result.valid).toBe(false);
+    expect(result.errors[0].message).toContain('not found');
+  });
+});
@@ -0,0 +1,191 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import { spawn, ChildProcess } from 'child_process';
+import { SpecJournal } from '../core/spec-journal.js';
+
+const testSpecDir = '/tmp/test-spec-journal';
+const journalDir = path.join(testSpecDir, '.journal');
+
+// A second writer process, idle until killed
+function startWriter(): ChildProcess {
+  return spawn(process.execPath, ['-e', 'setInterval(() => {}, 1000)'], { stdio: 'ignore' });
+}
+
+function stopWriter(child: ChildProcess): Promise<void> {
+  return new Promise(resolve => {
+    child.once('exit', () => resolve());
+    child.kill('SIGKILL');
+  });
+}
+
+// Txid of a writer process that has exited
+async function deadTxid(): Promise<string> {
+  const writer = startWriter();
+  await stopWriter(writer);
+  return `${Date.now().toString(36)}-${writer.pid}-${crypto.randomBytes(4).toString('hex')}`;
+}
+
+describe('Spec Journal', () => {
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('commit writes every file, removes others and leaves no record', async () => {
+    const stale = path.join(testSpecDir, 'test.old.json');
+    fs.writeFileSync(stale, '{}');
+
+    await new SpecJournal(testSpecDir).commit({
+      writes: [
+        { path: path.join(testSpecDir, 'test.abc.json'), data: '{"a":1}' },
+        { path: path.join(testSpecDir, 'ab', 'test.def.json'), data: '{"b":2}' },
+        { path: path.join(testSpecDir, 'test.index.json'), data: '{"namespace":"test"}' },
+      ],
+      removes: [stale],
+    });
+
+    expect(fs.readFileSync(path.join(testSpecDir, 'test.abc.json'), 'utf-8')).toBe('{"a":1}');
+    expect(fs.readFileSync(path.join(testSpecDir, 'ab', 'test.def.json'), 'utf-8')).toBe('{"b":2}');
+    expect(fs.existsSync(path.join(testSpecDir, 'test.index.json'))).toBe(true);
+    expect(fs.existsSync(stale)).toBe(false);
+    expect(fs.readdirSync(journalDir)).toEqual([]);
+    expect(fs.readdirSync(testSpecDir).some(f => f.endsWith('.tmp'))).toBe(false);
+  });
+
+  test('recover completes a journaled commit interrupted before its renames', () => {
+    // State after a crash between writing the record and renaming
+    const finalPath = path.join(testSpecDir, 'test.index.json');
+    const tempPath = `${finalPath}.tx1.tmp`;
+    const stale = path.join(testSpecDir, 'test.old.json');
+    fs.writeFileSync(tempPath, '{"namespace":"test"}');
+    fs.writeFileSync(stale, '{}');
+    fs.mkdirSync(journalDir);
+    fs.writeFileSync(
+      path.join(journalDir, 'tx1.json'),
+      JSON.stringify({ txid: 'tx1', renames: [[tempPath, finalPath]], removes: [stale] })
+    );
+
+    expect(new SpecJournal(testSpecDir).recover()).toBe(1);
+    expect(fs.readFileSync(finalPath, 'utf-8')).toBe('{"namespace":"test"}');
+    expect(fs.existsSync(tempPath)).toBe(false);
+    expect(fs.existsSync(stale)).toBe(false);
+    expect(fs.readdirSync(journalDir)).toEqual([]);
+  });
+
+  test('recover discards temp files of commits that never reached the journal', async () => {
+    const txid = await deadTxid();
+    const indexPath = path.join(testSpecDir, 'test.index.json');
+    fs.writeFileSync(indexPath, '{"namespace":"test","artifacts":{}}');
+    fs.writeFileSync(`${indexPath}.${txid}.tmp`, '{"namespace":"test","artifacts":{"spec":"x"}}');
+    fs.mkdirSync(path.join(testSpecDir, 'ab'));
+    fs.writeFileSync(path.join(testSpecDir, 'ab', `test.def.json.${txid}.tmp`), '{}');
+
+    expect(new SpecJournal(testSpecDir).recover()).toBe(0);
+    expect(fs.readFileSync(indexPath, 'utf-8')).toBe('{"namespace":"test","artifacts":{}}');
+    expect(fs.readdirSync(testSpecDir).sort()).toEqual(['ab', 'test.index.json']);
+    expect(fs.readdirSync(path.join(testSpecDir, 'ab'))).toEqual([]);
+  });
+
+  test('recover rolls back a commit whose record is torn', async () => {
+    const txid = await deadTxid();
+    const indexPath = path.join(testSpecDir, 'test.index.json');
+    fs.writeFileSync(indexPath, 'old');
+    fs.writeFileSync(`${indexPath}.${txid}.tmp`, 'new');
+    fs.mkdirSync(journalDir);
+    fs.writeFileSync(path.join(journalDir, `${txid}.json`), `{"txid":"${txid}","renam`);
+
+    expect(new SpecJournal(testSpecDir).recover()).toBe(0);
+    expect(fs.readFileSync(indexPath, 'utf-8')).toBe('old');
+    expect(fs.existsSync(`${indexPath}.${txid}.tmp`)).toBe(false);
+    expect(fs.readdirSync(journalDir)).toEqual([]);
+  });
+
+  test('recover leaves temp files it did not stage alone', async () => {
+    // Shaped like other writers' temp files: a pid, or no txid at all
+    const foreign = [
+      path.join(testSpecDir, `.pack.${process.pid}.tmp`),
+      path.join(testSpecDir, 'notes.tmp'),
+      path.join(testSpecDir, `test.index.json.${process.pid}.tmp`),
+      path.join(testSpecDir, 'test.index.json.not-a-txid.tmp'),
+      path.join(journalDir, 'other.lock.1234.tmp'),
+    ];
+    fs.mkdirSync(journalDir);
+    for (const file of foreign) {
+      fs.writeFileSync(file, 'foreign');
+    }
+    const staged = path.join(testSpecDir, `test.index.json.${await deadTxid()}.tmp`);
+    fs.writeFileSync(staged, 'abandoned');
+
+    expect(new SpecJournal(testSpecDir).recover()).toBe(0);
+    for (const file of foreign) {
+      expect(fs.readFileSync(file, 'utf-8')).toBe('foreign');
+    }
+    expect(fs.existsSync(staged)).toBe(false);
+  });
+
+  test('recover leaves a live writer\'s commit alone and completes it once the writer is gone', async () => {
+    const writer = startWriter();
+    const txid = `${Date.now().toString(36)}-${writer.pid}-0badf00d`;
+    const finalPath = path.join(testSpecDir, 'test.index.json');
+    const tempPath = `${finalPath}.${txid}.tmp`;
+    const stagedPath = path.join(testSpecDir, `test.abc.json.${txid}.tmp`);
+    const recordPath = path.join(journalDir, `${txid}.json`);
+    fs.writeFileSync(tempPath, 'new');
+    fs.writeFileSync(stagedPath, '{}');
+    fs.mkdirSync(journalDir);
+    fs.writeFileSync(recordPath, JSON.stringify({ txid, pid: writer.pid, renames: [[tempPath, finalPath]], removes: [] }));
+    // A record the writer is still writing: it must not be taken for torn
+    const partialTxid = `${Date.now().toString(36)}-${writer.pid}-0000beef`;
+    fs.writeFileSync(path.join(journalDir, `${partialTxid}.json`), '{"txid":');
+
+    try {
+      expect(new SpecJournal(testSpecDir).recover()).toBe(0);
+      expect(fs.existsSync(tempPath)).toBe(true);
+      expect(fs.existsSync(stagedPath)).toBe(true);
+      expect(fs.existsSync(recordPath)).toBe(true);
+      expect(fs.existsSync(path.join(journalDir, `${partialTxid}.json`))).toBe(true);
+    } finally {
+      await stopWriter(writer);
+    }
+
+    expect(new SpecJournal(testSpecDir).recover()).toBe(1);
+    expect(fs.readFileSync(finalPath, 'utf-8')).toBe('new');
+    expect(fs.existsSync(stagedPath)).toBe(false);
+    expect(fs.readdirSync(journalDir)).toEqual([]);
+  });
+
+  test('lock serializes writers and breaks the locks of dead processes', async () => {
+    const first = new SpecJournal(testSpecDir);
+    const second = new SpecJournal(testSpecDir);
+    const order: string[] = [];
+
+    const release = await first.lock('test');
+    const waiting = second.lock('test').then(release2 => {
+      order.push('second');
+      return release2;
+    });
+    await new Promise(resolve => setTimeout(resolve, 50));
+    order.push('first');
+    await release();
+    await (await waiting)();
+    expect(order).toEqual(['first', 'second']);
+
+    // A lock whose owner died is taken over
+    const writer = startWriter();
+    const deadPid = writer.pid;
+    await stopWriter(writer);
+    fs.writeFileSync(path.join(journalDir, 'test.lock'), `${deadPid} 0-${deadPid}-00000000`);
+    await (await first.lock('test'))();
+    expect(fs.readdirSync(journalDir)).toEqual([]);
+  });
+});
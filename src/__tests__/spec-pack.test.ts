@@ -0,0 +1,164 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SpecPack, PACK_FILE } from '../core/spec-pack.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+
+const testSpecDir = '/tmp/test-spec-pack';
+
+function writeArtifact(namespace: string, content: any): string {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  return `${namespace}.${hash}`;
+}
+
+describe('Spec Pack', () => {
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('packs content-addressed artifacts and reads them back by reference', () => {
+    const refs = Array.from({ length: 50 }, (_, i) => writeArtifact(`test.ns${i % 5}`, { i }));
+    fs.writeFileSync(path.join(testSpecDir, 'test.ns0.index.json'), '{}');
+    fs.writeFileSync(path.join(testSpecDir, `test.bad.${'0'.repeat(64)}.json`), '{}');
+
+    expect(SpecPack.build(testSpecDir)).toBe(50);
+
+    const pack = SpecPack.open(testSpecDir)!;
+    try {
+      for (const ref of refs) {
+        expect(JSON.parse(pack.read(ref)!)).toEqual(
+          JSON.parse(fs.readFileSync(path.join(testSpecDir, `${ref}.json`), 'utf-8'))
+        );
+      }
+      // Hash mismatch stays loose; index files are never packed
+      expect(pack.has(`test.bad.${'0'.repeat(64)}`)).toBe(false);
+      expect(pack.has('test.ns0.index')).toBe(false);
+    } finally {
+      pack.close();
+    }
+  });
+
+  test('opens and reads asynchronously the same as synchronously', async () => {
+    const refs = Array.from({ length: 10 }, (_, i) => writeArtifact(`test.ns${i % 3}`, { i }));
+    SpecPack.build(testSpecDir);
+
+    const sync = SpecPack.open(testSpecDir)!;
+    const pack = (await SpecPack.openAsync(testSpecDir))!;
+    try {
+      expect(pack.size()).toBe(sync.size());
+      for (const ref of refs) {
+        expect(await pack.readAsync(ref)).toBe(sync.read(ref));
+        expect(await sync.readAsync(ref)).toBe(sync.read(ref));
+        expect(pack.read(ref)).toBe(sync.read(ref));
+      }
+      expect(await pack.readAsync(`test.ns0.${'1'.repeat(64)}`)).toBeNull();
+    } finally {
+      sync.close();
+      pack.close();
+    }
+
+    fs.writeFileSync(path.join(testSpecDir, PACK_FILE), 'not a pack');
+    expect(await SpecPack.openAsync(testSpecDir)).toBeNull();
+  });
+
+  test('catalog async getters read the pack opened asynchronously', async () => {
+    const ref = writeArtifact('test.a', { packed: true });
+    SpecPack.build(testSpecDir);
+    fs.unlinkSync(path.join(testSpecDir, `${ref}.json`));
+
+    const catalog = new SpecCatalog(testSpecDir);
+    const [pack, again] = await Promise.all([catalog.getPackAsync(), catalog.getPackAsync()]);
+    expect(pack).not.toBeNull();
+    expect(again).toBe(pack);
+    expect(catalog.getPack()).toBe(pack);
+    expect(await catalog.getArtifactTextAsync(ref)).toBe(JSON.stringify({ packed: true }, null, 2));
+    expect(await catalog.getArtifactAsync(ref)).toEqual({ packed: true });
+    catalog.invalidateAll();
+  });
+
+  test('does not serve identical content under another namespace', () => {
+    const ref = writeArtifact('test.a', { same: true });
+    const otherRef = writeArtifact('test.b', { same: true });
+    SpecPack.build(testSpecDir);
+
+    const pack = SpecPack.open(testSpecDir)!;
+    try {
+      expect(pack.has(ref)).toBe(true);
+      expect(pack.has(otherRef)).toBe(true);
+      expect(pack.has(`test.c.${ref.split('.').pop()}`)).toBe(false);
+    } finally {
+      pack.close();
+    }
+  });
+
+  test('has() is answered from the table without reading records', () => {
+    const ref = writeArtifact('test.a', { table: true });
+    SpecPack.build(testSpecDir);
+
+    const pack = SpecPack.open(testSpecDir)!;
+    try {
+      // Blank every record behind the already loaded table
+      const packPath = path.join(testSpecDir, PACK_FILE);
+      const fd = fs.openSync(packPath, 'r+');
+      const recordsStart = 16 + pack.size() * 44;
+      fs.writeSync(fd, Buffer.alloc(fs.statSync(packPath).size - recordsStart), 0, undefined, recordsStart);
+      fs.closeSync(fd);
+
+      expect(pack.has(ref)).toBe(true);
+      expect(pack.read(ref)).toBeNull();
+    } finally {
+      pack.close();
+    }
+  });
+
+  test('catalog reads packed artifacts and falls back to loose files', () => {
+    const packed = writeArtifact('test.a', { packed: true });
+    SpecPack.build(testSpecDir);
+    fs.unlinkSync(path.join(testSpecDir, `${packed}.json`));
+    const loose = writeArtifact('test.b', { loose: true });
+
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.hasArtifact(packed)).toBe(true);
+    expect(catalog.getArtifact(packed)).toEqual({ packed: true });
+    expect(catalog.getArtifact(loose)).toEqual({ loose: true });
+    expect(catalog.getArtifact(`test.c.${'1'.repeat(64)}`)).toBeNull();
+    catalog.getPack()?.close();
+  });
+
+  test('catalog stops serving a packed artifact once it is forgotten', async () => {
+    const ref = writeArtifact('test.a', { removed: true });
+    SpecPack.build(testSpecDir);
+
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getArtifact(ref)).toEqual({ removed: true });
+    fs.unlinkSync(path.join(testSpecDir, `${ref}.json`));
+    catalog.forgetArtifact(ref);
+
+    expect(catalog.hasArtifact(ref)).toBe(false);
+    expect(catalog.getArtifact(ref)).toBeNull();
+    expect(await catalog.getArtifactAsync(ref)).toBeNull();
+    expect(await catalog.getArtifactTextAsync(ref)).toBeNull();
+    catalog.getPack()?.close();
+  });
+
+  test('ignores a corrupt pack', () => {
+    const ref = writeArtifact('test.a', { ok: true });
+    fs.writeFileSync(path.join(testSpecDir, PACK_FILE), 'not a pack');
+
+    const catalog = new SpecCatalog(testSpecDir);
+    expect(catalog.getPack()).toBeNull();
+    expect(catalog.getArtifact(ref)).toEqual({ ok: true });
+  });
+});
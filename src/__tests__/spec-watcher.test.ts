@@ -0,0 +1,88 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { SpecWatcher } from '../core/spec-watcher.js';
+
+const testSpecDir = '/tmp/test-spec-watcher';
+
+// File timestamps are coarse; make sure rewrites land on a new mtime
+const tick = () => new Promise(resolve => setTimeout(resolve, 20));
+
+function writeSpec(namespace: string, minimum: number): string {
+  const schema = {
+    $schema: 'http://json-schema.org/draft-07/schema#',
+    $id: `${namespace}.spec`,
+    type: 'object',
+    properties: { value: { type: 'number', minimum } },
+  };
+  const json = JSON.stringify(schema, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  const ref = `${namespace}.${hash}`;
+  fs.writeFileSync(path.join(testSpecDir, `${ref}.json`), json);
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts: { spec: ref } }, null, 2)
+  );
+  return ref;
+}
+
+describe('Spec Watcher', () => {
+  let validator: SchemaValidator;
+  let watcher: SpecWatcher;
+
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+    writeSpec('hologram.watched', 0);
+    validator = new SchemaValidator(testSpecDir);
+    watcher = new SpecWatcher(validator, { mode: 'poll', intervalMs: 60000 });
+    watcher.start();
+  });
+
+  afterEach(() => {
+    watcher.close();
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('picks up a component rewritten by another process', async () => {
+    const before = await validator.validateAgainstSchema({ value: 5 }, 'hologram.watched.spec');
+    expect(before.valid).toBe(true);
+
+    await tick();
+    writeSpec('hologram.watched', 10);
+    watcher.poll();
+
+    const after = await validator.validateAgainstSchema({ value: 5 }, 'hologram.watched.spec');
+    expect(after.valid).toBe(false);
+  });
+
+  test('sees components created and removed externally', async () => {
+    await validator.loadSchemas();
+    expect(validator.getCatalog().listNamespaces()).toEqual(['hologram.watched']);
+
+    writeSpec('hologram.added', 0);
+    fs.unlinkSync(path.join(testSpecDir, 'hologram.watched.index.json'));
+    watcher.poll();
+
+    expect(validator.getCatalog().listNamespaces()).toEqual(['hologram.added']);
+    const added = await validator.validateAgainstSchema({ value: 1 }, 'hologram.added.spec');
+    expect(added.valid).toBe(true);
+    const removed = await validator.validateAgainstSchema({ value: 1 }, 'hologram.watched.spec');
+    expect(removed.valid).toBe(false);
+  });
+
+  test('keeps the compiled schema when the spec reference is unchanged', async () => {
+    await validator.loadSchemas();
+    const compiled = (validator as any).ajv.getSchema('hologram.watched.spec');
+
+    watcher.applyChanges(['hologram.watched.index.json']);
+
+    expect((validator as any).ajv.getSchema('hologram.watched.spec')).toBe(compiled);
+  });
+});
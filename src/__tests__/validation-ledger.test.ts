@@ -0,0 +1,121 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { ValidationLedger } from '../core/validation-ledger.js';
+
+const testSpecDir = '/tmp/test-validation-ledger-spec';
+const testLedgerFile = '/tmp/test-validation-ledger/ledger.json';
+
+function writeArtifact(namespace: string, content: any): string {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  return `${namespace}.${hash}`;
+}
+
+function writeIndex(namespace: string, artifacts: Record<string, string>): void {
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts }, null, 2)
+  );
+}
+
+function writeDocsSpec(required: string[]): void {
+  writeIndex('hologram.docs', {
+    spec: writeArtifact('hologram.docs', {
+      $schema: 'http://json-schema.org/draft-07/schema#',
+      $id: 'hologram.docs.spec',
+      type: 'object',
+      required,
+    }),
+  });
+}
+
+function newValidator(): { validator: SchemaValidator; ledger: ValidationLedger } {
+  const ledger = new ValidationLedger(testLedgerFile);
+  const validator = new SchemaValidator(testSpecDir, new SpecCatalog(testSpecDir), { ledger });
+  return { validator, ledger };
+}
+
+describe('Validation Ledger', () => {
+  beforeEach(() => {
+    for (const dir of [testSpecDir, path.dirname(testLedgerFile)]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+
+    writeIndex('hologram', {
+      spec: writeArtifact('hologram', {
+        $schema: 'http://json-schema.org/draft-07/schema#',
+        $id: 'hologram.spec',
+        type: 'object',
+      }),
+    });
+    writeIndex('hologram.component', {
+      spec: writeArtifact('hologram.component', {
+        namespace: 'hologram.component',
+        conformance_requirements: { docs: { required: true } },
+      }),
+    });
+    writeDocsSpec(['docs']);
+    writeIndex('hologram.widget', {
+      spec: writeArtifact('hologram.widget', {
+        $schema: 'http://json-schema.org/draft-07/schema#',
+        $id: 'hologram.widget.spec',
+        type: 'object',
+      }),
+      docs: writeArtifact('hologram.widget', { docs: 'Widget documentation' }),
+    });
+  });
+
+  afterEach(() => {
+    for (const dir of [testSpecDir, path.dirname(testLedgerFile)]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+  });
+
+  test('reuses verdicts for unchanged artifacts across runs', async () => {
+    const first = newValidator();
+    const cold = await first.validator.validateAllComponents();
+    expect(first.ledger.stats.hits).toBe(0);
+    expect(fs.existsSync(testLedgerFile)).toBe(true);
+
+    const second = newValidator();
+    const warm = await second.validator.validateAllComponents();
+    expect(second.ledger.stats.misses).toBe(0);
+    expect(second.ledger.stats.hits).toBeGreaterThan(0);
+    expect(warm).toEqual(cold);
+    expect(warm.componentResults.get('hologram.widget')?.valid).toBe(true);
+  });
+
+  test('re-validates dependents of a changed spec', async () => {
+    await newValidator().validator.validateAllComponents();
+
+    writeDocsSpec(['docs', 'summary']);
+
+    const { validator, ledger } = newValidator();
+    const result = await validator.validateComponent('hologram.widget');
+    expect(ledger.stats.misses).toBe(1);
+    expect(result.valid).toBe(false);
+    expect(result.errors[0].message).toContain('summary');
+  });
+
+  test('prunes verdicts no longer reachable after a full run', async () => {
+    await newValidator().validator.validateAllComponents();
+    const before = Object.keys(JSON.parse(fs.readFileSync(testLedgerFile, 'utf-8')).verdicts);
+
+    writeDocsSpec(['docs', 'summary']);
+    await newValidator().validator.validateAllComponents();
+    const after = Object.keys(JSON.parse(fs.readFileSync(testLedgerFile, 'utf-8')).verdicts);
+
+    expect(after.length).toBe(before.length);
+    expect(after).not.toEqual(before);
+  });
+});
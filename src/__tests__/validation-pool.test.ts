@@ -0,0 +1,95 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { groupComponents, poolSize } from '../core/validation-pool.js';
+
+const testSpecDir = '/tmp/test-validation-pool';
+const workerScript = path.join(process.cwd(), 'dist', 'core', 'validation-worker.js');
+
+function writeArtifact(namespace: string, content: any): string {
+  const json = JSON.stringify(content, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  fs.writeFileSync(path.join(testSpecDir, `${namespace}.${hash}.json`), json);
+  return `${namespace}.${hash}`;
+}
+
+function writeIndex(namespace: string, artifacts: Record<string, string>): void {
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts }, null, 2)
+  );
+}
+
+describe('Parallel Validation', () => {
+  beforeEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+
+    writeIndex('hologram.component', {
+      spec: writeArtifact('hologram.component', {
+        namespace: 'hologram.component',
+        conformance: false,
+        conformance_requirements: { docs: { required: false } },
+      }),
+    });
+
+    for (let i = 0; i < 6; i++) {
+      const namespace = `hologram.comp${i}`;
+      writeIndex(namespace, {
+        spec: writeArtifact(namespace, {
+          $schema: 'http://json-schema.org/draft-07/schema#',
+          $id: `${namespace}.spec`,
+          type: 'object',
+        }),
+      });
+    }
+    writeIndex('hologram.broken', { spec: 'hologram.broken.0000' });
+  });
+
+  afterEach(() => {
+    if (fs.existsSync(testSpecDir)) {
+      fs.rmSync(testSpecDir, { recursive: true });
+    }
+  });
+
+  test('does not start workers for small trees', () => {
+    expect(poolSize(10)).toBe(1);
+    expect(poolSize(100, { workers: 4, minComponentsPerWorker: 16 })).toBe(4);
+    expect(poolSize(40, { workers: 4, minComponentsPerWorker: 16 })).toBe(2);
+  });
+
+  test('groups components that share artifacts', () => {
+    const shared = writeArtifact('hologram.shared', { namespace: 'hologram.shared.docs' });
+    writeIndex('hologram.comp0', { spec: 'hologram.comp0.x', docs: shared });
+    writeIndex('hologram.comp1', { spec: 'hologram.comp1.x', docs: shared });
+
+    const catalog = new SpecCatalog(testSpecDir);
+    const groups = groupComponents(catalog, catalog.listNamespaces());
+
+    expect(groups[0].sort()).toEqual(['hologram.comp0', 'hologram.comp1']);
+    expect(groups.length).toBe(catalog.listNamespaces().length - 1);
+  });
+
+  test('matches sequential validation results', async () => {
+    const sequential = await new SchemaValidator(testSpecDir).validateAllComponents();
+    const parallel = await new SchemaValidator(testSpecDir).validateAllComponentsParallel({
+      workers: 3,
+      minComponentsPerWorker: 1,
+      workerScript,
+    });
+
+    expect(parallel.valid).toBe(false);
+    expect(parallel.valid).toBe(sequential.valid);
+    expect([...parallel.componentResults.keys()]).toEqual([...sequential.componentResults.keys()]);
+    for (const [namespace, result] of sequential.componentResults) {
+      expect(parallel.componentResults.get(namespace)).toEqual(result);
+    }
+    expect(parallel.componentResults.get('hologram.broken')?.valid).toBe(false);
+    expect(parallel.componentResults.get('hologram.comp3')?.valid).toBe(true);
+  });
+});
@@ -0,0 +1,114 @@
+import { describe, test, expect, beforeEach, afterEach } from '@jest/globals';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as crypto from 'crypto';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { CompiledValidatorCache } from '../core/validator-cache.js';
+
+const testSpecDir = '/tmp/test-validator-cache-spec';
+const testCacheDir = '/tmp/test-validator-cache';
+
+function writeSpec(namespace: string, schema: any): string {
+  const json = JSON.stringify(schema, null, 2);
+  const hash = crypto.createHash('sha256').update(json).digest('hex');
+  const ref = `${namespace}.${hash}`;
+  fs.writeFileSync(path.join(testSpecDir, `${ref}.json`), json);
+  fs.writeFileSync(
+    path.join(testSpecDir, `${namespace}.index.json`),
+    JSON.stringify({ namespace, artifacts: { spec: ref } }, null, 2)
+  );
+  return hash;
+}
+
+function newValidator(): { validator: SchemaValidator; cache: CompiledValidatorCache } {
+  const cache = new CompiledValidatorCache(testCacheDir, {
+    resolveFrom: path.join(process.cwd(), 'package.json'),
+  });
+  const validator = new SchemaValidator(testSpecDir, new SpecCatalog(testSpecDir), {
+    compiledCache: cache,
+  });
+  return { validator, cache };
+}
+
+describe('Compiled Validator Cache', () => {
+  beforeEach(() => {
+    for (const dir of [testSpecDir, testCacheDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+    fs.mkdirSync(testSpecDir, { recursive: true });
+  });
+
+  afterEach(() => {
+    for (const dir of [testSpecDir, testCacheDir]) {
+      if (fs.existsSync(dir)) {
+        fs.rmSync(dir, { recursive: true });
+      }
+    }
+  });
+
+  test('reuses compiled validators across validator instances', async () => {
+    const hash = writeSpec('hologram.cached', {
+      $schema: 'http://json-schema.org/draft-07/schema#',
+      $id: 'hologram.cached.spec',
+      type: 'object',
+      properties: {
+        namespace: { type: 'string', pattern: '^hologram' },
+        created: { type: 'string', format: 'date-time' },
+      },
+      required: ['namespace'],
+    });
+
+    const first = newValidator();
+    const cold = await first.validator.validateAgainstSchema(
+      { namespace: 'hologram.x' },
+      'hologram.cached.spec'
+    );
+    expect(cold.valid).toBe(true);
+    expect(first.cache.stats.writes).toBe(1);
+    expect(fs.readdirSync(testCacheDir).some(f => f.startsWith(hash))).toBe(true);
+
+    const second = newValidator();
+    const valid = await second.validator.validateAgainstSchema(
+      { namespace: 'hologram.y', created: '2024-01-01T00:00:00Z' },
+      'hologram.cached.spec'
+    );
+    const invalid = await second.validator.validateAgainstSchema(
+      { namespace: 'other', created: 'yesterday' },
+      'hologram.cached.spec'
+    );
+
+    expect(second.cache.stats.hits).toBe(1);
+    expect(second.cache.stats.writes).toBe(0);
+    expect(valid.valid).toBe(true);
+    expect(invalid.valid).toBe(false);
+    expect(invalid.errors.length).toBe(2);
+  });
+
+  test('recompiles when a cached module is corrupt', async () => {
+    writeSpec('hologram.corrupt', {
+      $schema: 'http://json-schema.org/draft-07/schema#',
+      $id: 'hologram.corrupt.spec',
+      type: 'object',
+    });
+
+    await newValidator().validator.validateAgainstSchema({}, 'hologram.corrupt.spec');
+    for (const file of fs.readdirSync(testCacheDir)) {
+      fs.writeFileSync(path.join(testCacheDir, file), 'this is not javascript {');
+    }
+
+    const { validator, cache } = newValidator();
+    const result = await validator.validateAgainstSchema({}, 'hologram.corrupt.spec');
+    expect(result.valid).toBe(true);
+    expect(cache.stats.hits).toBe(0);
+    expect(cache.stats.writes).toBe(1);
+  });
+
+  test('does not cache schemas with external references', () => {
+    const cache = new CompiledValidatorCache(testCacheDir);
+    expect(cache.isCacheable({ properties: { a: { $ref: '#/definitions/a' } } })).toBe(true);
+    expect(cache.isCacheable({ properties: { a: { $ref: 'hologram.spec' } } })).toBe(false);
+  });
+});
@@ -0,0 +1,78 @@
+#!/usr/bin/env node
+/**
+ * Compare the streaming canonical-JSON hasher with the string-building
+ * encoder on large nested documents.
+ *
+ * Usage: node dist/bench/canonical-json.js [iterations]
+ */
+
+import * as crypto from 'crypto';
+import { canonicalizeJSON, hashCanonicalJSON } from '../core/canonical-json.js';
+
+/**
+ * Certificate-shaped document: many records of vectors of exact rationals
+ * stored as strings, nested a few levels deep
+ */
+function makeDocument(records: number, width: number, depth: number): any {
+  const node = (level: number, seed: number): any => {
+    if (level === 0) {
+      return Array.from({ length: width }, (_, i) => `${seed * 31 + i}/${(i % 7) + 1}`);
+    }
+    const children: Record<string, any> = {};
+    for (let i = width - 1; i >= 0; i--) {
+      children[`k${(seed + i) % width}_${i}`] = node(level - 1, seed * width + i);
+    }
+    return children;
+  };
+  return {
+    certificate: 'bench',
+    records: Array.from({ length: records }, (_, i) => ({ id: i, data: node(depth, i) })),
+  };
+}
+
+function measure(label: string, iterations: number, hashOnce: () => string): { digest: string } {
+  if (global.gc) global.gc();
+  const heapBefore = process.memoryUsage().heapUsed;
+  let sampledHeap = heapBefore;
+  let digest = '';
+
+  const start = process.hrtime.bigint();
+  for (let i = 0; i < iterations; i++) {
+    digest = hashOnce();
+    sampledHeap = Math.max(sampledHeap, process.memoryUsage().heapUsed);
+  }
+  const elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+
+  console.log(JSON.stringify({
+    encoder: label,
+    iterations,
+    msPerHash: +(elapsedMs / iterations).toFixed(3),
+    heapGrowthMB: +((sampledHeap - heapBefore) / 1024 / 1024).toFixed(1),
+  }));
+  return { digest };
+}
+
+function main(): void {
+  const iterations = parseInt(process.argv[2] ?? '20', 10);
+  const sizes: Array<[string, any]> = [
+    ['small', makeDocument(10, 4, 2)],
+    ['medium', makeDocument(200, 6, 2)],
+    ['large', makeDocument(500, 8, 3)],
+  ];
+
+  for (const [name, doc] of sizes) {
+    console.log(`\n${name}: ${canonicalizeJSON(doc).length} canonical chars`);
+    const legacy = measure('string', iterations, () =>
+      crypto.createHash('sha256').update(canonicalizeJSON(doc)).digest('hex')
+    );
+    const streaming = measure('streaming', iterations, () =>
+      hashCanonicalJSON(doc, crypto.createHash('sha256')).digest('hex')
+    );
+    if (legacy.digest !== streaming.digest) {
+      console.error(`❌ Digest mismatch for ${name} document`);
+      process.exit(1);
+    }
+  }
+}
+
+main();
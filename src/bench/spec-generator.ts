@@ -0,0 +1,123 @@
+/**
+ * Synthesise large spec/ trees for benchmarks.
+ *
+ * The base tree (the real spec/) is copied as is, then `count` components
+ * are added by cloning a template component under new namespaces. Every
+ * artifact type hologram.component requires is present; types the template
+ * lacks are borrowed from hologram.component itself. Artifacts are written
+ * exactly as submitManifest writes them, so every file is correctly
+ * content-addressed.
+ */
+
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import { ContentLayout } from '../core/content-layout.js';
+
+export interface GeneratedSpec {
+  specDir: string;
+  /** Namespaces of the generated components */
+  namespaces: string[];
+  /** Component the generated ones were cloned from */
+  template: string;
+  /** Namespace every generated component names as its parent */
+  parent: string | null;
+  files: number;
+  bytes: number;
+}
+
+// Core components validate against themselves or define the model
+const CORE_NAMESPACE = /^hologram(\.(component|spec|interface|docs|test|manager|dependency|build|log|view))?$/;
+
+/**
+ * Namespace of the i-th generated component
+ */
+export function generatedNamespace(i: number): string {
+  return `bench.component${i}`;
+}
+
+function readIndex(specDir: string, namespace: string): Record<string, string> {
+  const index = JSON.parse(fs.readFileSync(path.join(specDir, `${namespace}.index.json`), 'utf-8'));
+  return index.artifacts ?? {};
+}
+
+/**
+ * Smallest non-core component of the base tree
+ */
+function pickTemplate(baseDir: string, files: Map<string, string>): string {
+  let best: { namespace: string; bytes: number } | null = null;
+  for (const filename of files.keys()) {
+    if (!filename.endsWith('.index.json')) continue;
+    const namespace = filename.replace('.index.json', '');
+    if (CORE_NAMESPACE.test(namespace)) continue;
+
+    let bytes = 0;
+    for (const ref of Object.values(readIndex(baseDir, namespace))) {
+      const artifact = files.get(`${ref}.json`);
+      bytes += artifact ? fs.statSync(artifact).size : 0;
+    }
+    if (!best || bytes < best.bytes) best = { namespace, bytes };
+  }
+  if (!best) {
+    throw new Error(`No component in ${baseDir} to use as a template`);
+  }
+  return best.namespace;
+}
+
+export function generateSpec(baseDir: string, targetDir: string, count: number): GeneratedSpec {
+  fs.rmSync(targetDir, { recursive: true, force: true });
+  fs.mkdirSync(targetDir, { recursive: true });
+
+  // Copy the base tree flat
+  const baseFiles = new ContentLayout(baseDir).listFiles();
+  let files = 0;
+  let bytes = 0;
+  for (const [filename, filePath] of baseFiles) {
+    if (!filename.endsWith('.json')) continue;
+    fs.copyFileSync(filePath, path.join(targetDir, filename));
+    files++;
+    bytes += fs.statSync(filePath).size;
+  }
+
+  // Template artifacts as text, completed with hologram.component's own
+  const template = pickTemplate(baseDir, baseFiles);
+  const model = JSON.parse(fs.readFileSync(
+    baseFiles.get(`${readIndex(baseDir, 'hologram.component').spec}.json`)!, 'utf-8'
+  ));
+  const templateArtifacts = readIndex(baseDir, template);
+  const componentArtifacts = readIndex(baseDir, 'hologram.component');
+  const texts: Array<[string, string, string]> = [];
+  for (const type of ['spec', ...Object.keys(model.conformance_requirements ?? {})]) {
+    const [source, ref] = templateArtifacts[type]
+      ? [template, templateArtifacts[type]]
+      : [`hologram.component`, componentArtifacts[type]];
+    if (!ref) continue;
+    texts.push([type, source, fs.readFileSync(baseFiles.get(`${ref}.json`)!, 'utf-8')]);
+  }
+
+  const templateSpec = JSON.parse(texts.find(([type]) => type === 'spec')![2]);
+  const parent = typeof templateSpec.parent === 'string' ? templateSpec.parent : null;
+
+  // Clone under new namespaces; namespaces are plain dotted names, so a
+  // textual replacement inside the JSON keeps it valid and canonical
+  const namespaces: string[] = [];
+  for (let i = 0; i < count; i++) {
+    const namespace = generatedNamespace(i);
+    const artifacts: Record<string, string> = {};
+    for (const [type, source, text] of texts) {
+      const json = text.split(`"${source}`).join(`"${namespace}`);
+      const hash = crypto.createHash('sha256').update(json).digest('hex');
+      fs.writeFileSync(path.join(targetDir, `${namespace}.${hash}.json`), json);
+      artifacts[type] = `${namespace}.${hash}`;
+      files++;
+      bytes += Buffer.byteLength(json);
+    }
+    const index = JSON.stringify({ namespace, artifacts }, null, 2);
+    fs.writeFileSync(path.join(targetDir, `${namespace}.index.json`), index);
+    files++;
+    bytes += Buffer.byteLength(index);
+    namespaces.push(namespace);
+  }
+
+  return { specDir: targetDir, namespaces, template, parent, files, bytes };
+}
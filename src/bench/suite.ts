@@ -0,0 +1,212 @@
+#!/usr/bin/env node
+/**
+ * Benchmark suite for the component manager.
+ *
+ * For each size, synthesises a spec/ tree with that many extra components
+ * and times cold and warm runs of validateAllComponents, submitManifest,
+ * delete dependency checks, analyzeSpec and generateCID. Results are
+ * printed and written as JSON so runs can be compared between releases.
+ *
+ * Usage: node dist/bench/suite.js [--sizes 1000,10000,100000] [--spec <dir>]
+ *                                 [--out <file>] [--work <dir>] [--keep]
+ */
+
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+import { SpecCatalog } from '../core/spec-catalog.js';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+import { ValidationLedger } from '../core/validation-ledger.js';
+import { submitManifestOperation } from '../operations/manifest.js';
+import { analyzeSpec } from '../utils/gc.js';
+import { generateSpec, GeneratedSpec } from './spec-generator.js';
+
+// Bump when benchmarks are added, removed or change what they measure
+const RESULTS_FORMAT = 1;
+
+// Manifests submitted per size; each one writes and validates a component
+const MANIFESTS = 20;
+
+interface BenchResult {
+  size: number;
+  benchmark: string;
+  /** Total wall time */
+  ms: number;
+  /** Operations timed, when more than one */
+  ops?: number;
+  msPerOp?: number;
+  [detail: string]: any;
+}
+
+function argValue(args: string[], flag: string): string | undefined {
+  const at = args.indexOf(flag);
+  return at >= 0 ? args[at + 1] : undefined;
+}
+
+function defaultBaseSpec(): string {
+  const candidates = [path.join(process.cwd(), 'spec'), path.join(process.cwd(), '..', 'spec')];
+  return candidates.find(dir => fs.existsSync(path.join(dir, 'hologram.component.index.json'))) ?? candidates[0];
+}
+
+async function time<T>(fn: () => Promise<T> | T): Promise<{ ms: number; value: T }> {
+  if (global.gc) global.gc();
+  const start = process.hrtime.bigint();
+  const value = await fn();
+  return { ms: Number(process.hrtime.bigint() - start) / 1e6, value };
+}
+
+function round(ms: number): number {
+  return +ms.toFixed(3);
+}
+
+async function benchSize(size: number, baseSpec: string, workDir: string): Promise<BenchResult[]> {
+  const results: BenchResult[] = [];
+  const record = (result: BenchResult) => {
+    const rounded = {
+      ...result,
+      ms: round(result.ms),
+      ...(result.ops ? { msPerOp: round(result.ms / result.ops) } : {}),
+    };
+    results.push(rounded);
+    console.log(JSON.stringify(rounded));
+  };
+
+  const specDir = path.join(workDir, `spec-${size}`);
+  const artifactDir = path.join(workDir, `artifacts-${size}`);
+  const stateDir = path.join(workDir, `state-${size}`);
+  fs.rmSync(artifactDir, { recursive: true, force: true });
+  fs.rmSync(stateDir, { recursive: true, force: true });
+
+  const generated = await time(() => generateSpec(baseSpec, specDir, size));
+  const spec: GeneratedSpec = generated.value;
+  record({
+    size, benchmark: 'generate', ms: generated.ms,
+    template: spec.template, files: spec.files, bytes: spec.bytes,
+  });
+
+  // validateAllComponents: cold process, same process again, and a new
+  // process reusing the verdict ledger of the first
+  const ledgerFile = path.join(stateDir, 'validation-ledger.json');
+  const validator = new SchemaValidator(specDir, new SpecCatalog(specDir), {
+    ledger: new ValidationLedger(ledgerFile),
+  });
+  const cold = await time(() => validator.validateAllComponents());
+  const valid = [...cold.value.componentResults.values()].filter(r => r.valid).length;
+  record({ size, benchmark: 'validateAll.cold', ms: cold.ms, components: cold.value.componentResults.size, valid });
+
+  const warm = await time(() => validator.validateAllComponents());
+  record({ size, benchmark: 'validateAll.warm', ms: warm.ms, components: warm.value.componentResults.size });
+
+  const restarted = new SchemaValidator(specDir, new SpecCatalog(specDir), {
+    ledger: new ValidationLedger(ledgerFile),
+  });
+  const ledgered = await time(() => restarted.validateAllComponents());
+  record({ size, benchmark: 'validateAll.ledger', ms: ledgered.ms, components: ledgered.value.componentResults.size });
+
+  // delete dependency check: building the reverse index, then answering
+  const catalog = new SpecCatalog(specDir, {
+    dependencyIndexFile: path.join(stateDir, 'dependents.json'),
+  });
+  const dependencyTarget = spec.parent ?? spec.namespaces[0];
+  const dependentsCold = await time(() => catalog.getDependents(dependencyTarget));
+  record({
+    size, benchmark: 'dependents.cold', ms: dependentsCold.ms,
+    namespace: dependencyTarget, dependents: dependentsCold.value.length,
+  });
+  const dependentsWarm = await time(() => {
+    for (const namespace of spec.namespaces.slice(0, 100)) catalog.getDependents(namespace);
+    return catalog.getDependents(dependencyTarget);
+  });
+  record({ size, benchmark: 'dependents.warm', ms: dependentsWarm.ms, ops: Math.min(100, spec.namespaces.length) + 1 });
+  const dependentsReload = await time(() =>
+    new SpecCatalog(specDir, { dependencyIndexFile: path.join(stateDir, 'dependents.json') })
+      .getDependents(dependencyTarget)
+  );
+  record({ size, benchmark: 'dependents.persisted', ms: dependentsReload.ms });
+
+  // analyzeSpec: without state, then with the state the first run saved
+  const gcState = path.join(stateDir, 'gc-state.json');
+  const gcCold = await time(() => analyzeSpec({ specDir, stateFile: gcState }));
+  record({ size, benchmark: 'analyzeSpec.cold', ms: gcCold.ms, files: gcCold.value.totalFiles });
+  const gcWarm = await time(() => analyzeSpec({ specDir, stateFile: gcState }));
+  record({ size, benchmark: 'analyzeSpec.warm', ms: gcWarm.ms, files: gcWarm.value.totalFiles });
+
+  // generateCID over every generated artifact's content
+  const contents = spec.namespaces.slice(0, Math.min(spec.namespaces.length, 1000)).flatMap(namespace => {
+    const index = catalog.getIndex(namespace);
+    return Object.values(index?.artifacts ?? {}).map(ref => catalog.getArtifact(ref!));
+  });
+  const store = new ArtifactStore(artifactDir);
+  const cids = await time(() => contents.map(content => store.generateCID(content)));
+  record({ size, benchmark: 'generateCID', ms: cids.ms, ops: contents.length });
+
+  // submitManifest: new components next to the generated ones, through a
+  // shared validator as the MCP server runs it
+  ArtifactStore.setShared(store);
+  const shared = new SchemaValidator(specDir, new SpecCatalog(specDir));
+  SchemaValidator.setShared(shared);
+  await shared.loadSchemas();
+  const templateIndex = catalog.getIndex(spec.namespaces[0])!;
+  const submissions: Array<{ namespace: string; artifacts: Record<string, string> }> = [];
+  for (let i = 0; i < MANIFESTS; i++) {
+    const namespace = `bench.submitted${i}`;
+    const artifacts: Record<string, string> = {};
+    for (const [type, ref] of Object.entries(templateIndex.artifacts)) {
+      const text = JSON.stringify(catalog.getArtifact(ref!))
+        .split(`"${spec.namespaces[0]}`).join(`"${namespace}`);
+      artifacts[type] = await store.storeArtifactAsync(JSON.parse(text));
+    }
+    submissions.push({ namespace, artifacts });
+  }
+  let accepted = 0;
+  const manifests = await time(async () => {
+    for (const { namespace, artifacts } of submissions) {
+      const result = await submitManifestOperation(namespace, artifacts, specDir);
+      if (result.content[0].text.includes('"success": true')) accepted++;
+    }
+  });
+  record({ size, benchmark: 'submitManifest', ms: manifests.ms, ops: MANIFESTS, accepted });
+  SchemaValidator.setShared(null);
+  ArtifactStore.setShared(null);
+
+  return results;
+}
+
+async function main(): Promise<void> {
+  const args = process.argv.slice(2);
+  const sizes = (argValue(args, '--sizes') ?? '1000,10000')
+    .split(',').map(s => parseInt(s, 10)).filter(n => n > 0);
+  const baseSpec = path.resolve(argValue(args, '--spec') ?? defaultBaseSpec());
+  const workDir = path.resolve(argValue(args, '--work') ?? path.join(os.tmpdir(), 'hologram-bench'));
+  const outFile = path.resolve(argValue(args, '--out') ?? 'bench-results.json');
+  const keep = args.includes('--keep');
+
+  console.log(`⏱️  Hologram benchmark: sizes ${sizes.join(', ')} over ${baseSpec}\n`);
+
+  const results: BenchResult[] = [];
+  try {
+    for (const size of sizes) {
+      results.push(...await benchSize(size, baseSpec, workDir));
+    }
+  } finally {
+    if (!keep) fs.rmSync(workDir, { recursive: true, force: true });
+  }
+
+  const report = {
+    format: RESULTS_FORMAT,
+    date: new Date().toISOString(),
+    node: process.version,
+    platform: `${os.platform()} ${os.arch()}`,
+    cpus: os.cpus().length,
+    sizes,
+    results,
+  };
+  fs.writeFileSync(outFile, JSON.stringify(report, null, 2));
+  console.log(`\n✅ Results written to ${outFile}`);
+}
+
+main().catch(error => {
+  console.error('Benchmark failed:', error);
+  process.exit(1);
+});
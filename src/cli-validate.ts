@@ -1,9 +1,21 @@
 #!/usr/bin/env node
+import * as path from 'path';
 import { validateOperation } from './operations/validate.js';
+import { SchemaValidator } from './core/schema-validator.js';
+import { CompiledValidatorCache } from './core/validator-cache.js';
+import { ValidationLedger } from './core/validation-ledger.js';
 
 async function main() {
   const namespace = process.argv[2];
 
+  // Reuse validators compiled, and verdicts reached, by earlier runs for
+  // unchanged specs and artifacts
+  const specDir = path.join(process.cwd(), 'spec');
+  SchemaValidator.setShared(new SchemaValidator(specDir, undefined, {
+    compiledCache: new CompiledValidatorCache(),
+    ledger: new ValidationLedger(),
+  }));
+
   console.log('🔍 Validating Hologram components...\n');
 
   const result = await validateOperation(namespace);
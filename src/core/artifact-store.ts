@@ -1,14 +1,65 @@
 import * as crypto from 'crypto';
 import * as fs from 'fs';
 import * as path from 'path';
+import { hashCanonicalJSON } from './canonical-json.js';
+import { LRUCache, LRUCacheStats } from './lru-cache.js';
+import { ContentLayout } from './content-layout.js';
+import { metrics } from './metrics.js';
+
+export interface ArtifactStoreOptions {
+  /** Maximum number of artifacts kept in memory (default: 1000) */
+  maxEntries?: number;
+  /** Maximum serialized size of artifacts kept in memory (default: 64 MiB) */
+  maxBytes?: number;
+}
 
 export class ArtifactStore {
+  private static shared: ArtifactStore | null = null;
+
   private artifactDir: string;
-  private artifacts: Map<string, any> = new Map();
+  private layout: ContentLayout;
+  private artifacts: LRUCache<string, any>;
 
-  constructor(artifactDir: string = path.join(process.cwd(), '.artifacts')) {
+  constructor(
+    artifactDir: string = path.join(process.cwd(), '.artifacts'),
+    options: ArtifactStoreOptions = {}
+  ) {
     this.artifactDir = artifactDir;
+    this.artifacts = new LRUCache({
+      maxEntries: options.maxEntries ?? 1000,
+      maxBytes: options.maxBytes ?? 64 * 1024 * 1024,
+    });
     this.ensureArtifactDir();
+    this.layout = new ContentLayout(artifactDir);
+  }
+
+  public getLayout(): ContentLayout {
+    return this.layout;
+  }
+
+  /**
+   * Install a process-wide store, so artifacts submitted by one operation
+   * are still cached when another reads them back
+   */
+  public static setShared(store: ArtifactStore | null): void {
+    ArtifactStore.shared = store;
+  }
+
+  /**
+   * Get the process-wide store, creating one for .artifacts/ if none is set
+   */
+  public static getShared(): ArtifactStore {
+    if (!ArtifactStore.shared) {
+      ArtifactStore.shared = new ArtifactStore();
+    }
+    return ArtifactStore.shared;
+  }
+
+  /**
+   * In-memory cache occupancy and hit/miss/eviction counters
+   */
+  public getCacheStats(): LRUCacheStats {
+    return this.artifacts.getStats();
   }
 
   /**
@@ -24,52 +75,42 @@ export class ArtifactStore {
    * Generate CID for content using SHA256
    */
   public generateCID(content: any): string {
-    // Canonical JSON encoding with recursively sorted keys
-    const canonical = this.canonicalizeJSON(content);
-    const hash = crypto.createHash('sha256');
-    hash.update(canonical);
+    // Canonical JSON encoding with recursively sorted keys, streamed into the hash
+    const hash = hashCanonicalJSON(content, crypto.createHash('sha256'));
     return `cid:${hash.digest('hex')}`;
   }
 
   /**
-   * Recursively sort object keys for canonical JSON
+   * Store artifact with CID
    */
-  private canonicalizeJSON(obj: any): string {
-    if (obj === null || obj === undefined) {
-      return JSON.stringify(obj);
-    }
-
-    if (typeof obj !== 'object') {
-      return JSON.stringify(obj);
-    }
+  public storeArtifact(content: any): string {
+    const cid = this.generateCID(content);
+    const artifactPath = this.layout.writePath(cid);
 
-    if (Array.isArray(obj)) {
-      return '[' + obj.map(item => this.canonicalizeJSON(item)).join(',') + ']';
-    }
+    // Store on disk
+    const serialized = JSON.stringify(content, null, 2);
+    fs.writeFileSync(artifactPath, serialized);
+    metrics.recordWrite(serialized.length);
 
-    // Object: sort keys recursively
-    const sortedKeys = Object.keys(obj).sort();
-    const pairs = sortedKeys.map(key => {
-      const value = this.canonicalizeJSON(obj[key]);
-      return `${JSON.stringify(key)}:${value}`;
-    });
+    // Store in memory, sized by its serialized form
+    this.artifacts.set(cid, content, Buffer.byteLength(serialized));
 
-    return '{' + pairs.join(',') + '}';
+    return cid;
   }
 
   /**
-   * Store artifact with CID
+   * storeArtifact() without blocking the event loop
    */
-  public storeArtifact(content: any): string {
+  public async storeArtifactAsync(content: any): Promise<string> {
     const cid = this.generateCID(content);
-    const artifactPath = path.join(this.artifactDir, cid);
-
-    // Store in memory
-    this.artifacts.set(cid, content);
+    const artifactPath = this.layout.targetPath(cid);
 
-    // Store on disk
-    fs.writeFileSync(artifactPath, JSON.stringify(content, null, 2));
+    const serialized = JSON.stringify(content, null, 2);
+    await fs.promises.mkdir(path.dirname(artifactPath), { recursive: true });
+    await fs.promises.writeFile(artifactPath, serialized);
+    metrics.recordWrite(serialized.length);
 
+    this.artifacts.set(cid, content, Buffer.byteLength(serialized));
     return cid;
   }
 
@@ -78,19 +119,39 @@ export class ArtifactStore {
    */
   public getArtifact(cid: string): any | null {
     // Check memory first
-    if (this.artifacts.has(cid)) {
-      return this.artifacts.get(cid);
+    const cached = this.artifacts.get(cid);
+    if (cached !== undefined) {
+      return cached;
     }
 
     // Check disk
-    const artifactPath = path.join(this.artifactDir, cid);
-    if (fs.existsSync(artifactPath)) {
-      const content = JSON.parse(fs.readFileSync(artifactPath, 'utf-8'));
-      this.artifacts.set(cid, content);
+    const artifactPath = this.layout.resolve(cid);
+    if (artifactPath) {
+      const serialized = fs.readFileSync(artifactPath, 'utf-8');
+      metrics.recordRead(serialized.length);
+      const content = JSON.parse(serialized);
+      this.artifacts.set(cid, content, Buffer.byteLength(serialized));
       return content;
     }
 
     return null;
   }
 
-}
\ No newline at end of file
+  /**
+   * getArtifact() without blocking the event loop
+   */
+  public async getArtifactAsync(cid: string): Promise<any | null> {
+    const cached = this.artifacts.get(cid);
+    if (cached !== undefined) {
+      return cached;
+    }
+
+    const serialized = await this.layout.readFile(cid);
+    if (serialized === null) return null;
+
+    metrics.recordRead(serialized.length);
+    const content = JSON.parse(serialized);
+    this.artifacts.set(cid, content, Buffer.byteLength(serialized));
+    return content;
+  }
+}
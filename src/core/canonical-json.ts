@@ -0,0 +1,91 @@
+import * as crypto from 'crypto';
+
+// Buffered output is handed to the hash in chunks of about this many chars
+const CHUNK_SIZE = 16 * 1024;
+
+/**
+ * Canonical JSON with recursively sorted keys, built as one string.
+ * This is the encoding CIDs have always been computed over; hashCanonicalJSON
+ * must produce exactly the same bytes.
+ */
+export function canonicalizeJSON(obj: any): string {
+  if (obj === null || obj === undefined) {
+    return JSON.stringify(obj);
+  }
+
+  if (typeof obj !== 'object') {
+    return JSON.stringify(obj);
+  }
+
+  if (Array.isArray(obj)) {
+    return '[' + obj.map(item => canonicalizeJSON(item)).join(',') + ']';
+  }
+
+  // Object: sort keys recursively
+  const sortedKeys = Object.keys(obj).sort();
+  const pairs = sortedKeys.map(key => {
+    const value = canonicalizeJSON(obj[key]);
+    return `${JSON.stringify(key)}:${value}`;
+  });
+
+  return '{' + pairs.join(',') + '}';
+}
+
+/**
+ * Feed the canonical JSON encoding of a value into a hash while walking it,
+ * without materialising the whole string. Output is buffered into small
+ * chunks so large documents cost one bounded buffer rather than a string
+ * per subtree.
+ */
+export function hashCanonicalJSON(value: any, hash: crypto.Hash): crypto.Hash {
+  if (typeof value !== 'object' && JSON.stringify(value) === undefined) {
+    // Matches canonicalizeJSON, whose result cannot be hashed either
+    throw new TypeError(`Cannot hash canonical JSON of ${typeof value}`);
+  }
+
+  let buffer = '';
+  const write = (text: string): void => {
+    buffer += text;
+    if (buffer.length >= CHUNK_SIZE) {
+      hash.update(buffer);
+      buffer = '';
+    }
+  };
+
+  // Leaves are encoded as canonicalizeJSON does: JSON.stringify, which yields
+  // undefined for undefined and functions. That joins as '' inside arrays and
+  // interpolates as 'undefined' inside objects.
+  const visit = (node: any, inObject: boolean): void => {
+    if (node === null || typeof node !== 'object') {
+      const encoded = JSON.stringify(node);
+      write(encoded === undefined ? (inObject ? 'undefined' : '') : encoded);
+      return;
+    }
+
+    if (Array.isArray(node)) {
+      write('[');
+      for (let i = 0; i < node.length; i++) {
+        if (i > 0) write(',');
+        visit(node[i], false);
+      }
+      write(']');
+      return;
+    }
+
+    write('{');
+    const keys = Object.keys(node).sort();
+    for (let i = 0; i < keys.length; i++) {
+      if (i > 0) write(',');
+      write(JSON.stringify(keys[i]));
+      write(':');
+      visit(node[keys[i]], true);
+    }
+    write('}');
+  };
+
+  visit(value, false);
+  if (buffer.length > 0) {
+    hash.update(buffer);
+  }
+  return hash;
+}
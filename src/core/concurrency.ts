@@ -0,0 +1,35 @@
+// Files read at once by a single operation; enough to keep the disk busy
+// without exhausting file descriptors
+export const IO_CONCURRENCY = 16;
+
+/**
+ * Map items through an async function with at most `limit` calls in flight.
+ * Results keep the order of the items.
+ */
+export async function mapConcurrent<T, R>(
+  items: readonly T[],
+  limit: number,
+  fn: (item: T, index: number) => Promise<R>
+): Promise<R[]> {
+  const results: R[] = new Array(items.length);
+  let next = 0;
+
+  const worker = async (): Promise<void> => {
+    while (next < items.length) {
+      const index = next++;
+      results[index] = await fn(items[index], index);
+    }
+  };
+
+  const workers = Math.max(1, Math.min(limit, items.length));
+  await Promise.all(Array.from({ length: workers }, worker));
+  return results;
+}
+
+/**
+ * Let pending I/O callbacks and other requests run before continuing a long
+ * CPU-bound loop
+ */
+export function yieldToEventLoop(): Promise<void> {
+  return new Promise(resolve => setImmediate(resolve));
+}
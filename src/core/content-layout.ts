@@ -0,0 +1,190 @@
+import * as fs from 'fs';
+import * as path from 'path';
+
+export type LayoutMode = 'flat' | 'sharded';
+
+// Marker file recording the layout of a directory; absent means flat
+const LAYOUT_MARKER = '.layout';
+
+/**
+ * On-disk placement of content-addressed files in spec/ or .artifacts/.
+ *
+ * The flat layout keeps every file at the top of the directory. The sharded
+ * layout moves content-addressed files into a subdirectory named after the
+ * first two hex digits of their hash, as git does for loose objects:
+ * `spec/ab/hologram.foo.abcd….json`, `.artifacts/ab/cid:abcd…`. Files whose
+ * names carry no hash (index files, caches) always stay at the top level.
+ *
+ * Readers resolve through both locations, so a tree can be read while it is
+ * being migrated; writers use the directory's recorded layout.
+ */
+export class ContentLayout {
+  private rootDir: string;
+  private mode: LayoutMode;
+
+  constructor(rootDir: string, mode?: LayoutMode) {
+    this.rootDir = rootDir;
+    this.mode = mode ?? ContentLayout.detect(rootDir);
+  }
+
+  /**
+   * Read the layout recorded in a directory
+   */
+  public static detect(rootDir: string): LayoutMode {
+    try {
+      const marker = fs.readFileSync(path.join(rootDir, LAYOUT_MARKER), 'utf-8').trim();
+      return marker === 'sharded' ? 'sharded' : 'flat';
+    } catch {
+      return 'flat';
+    }
+  }
+
+  /**
+   * Shard directory for a filename, or null if it is not content-addressed.
+   * The hash is the last dot-separated segment before `.json`
+   * (`namespace.<hash>.json`) or the part after `cid:`.
+   */
+  public static shardOf(filename: string): string | null {
+    const stem = filename.replace(/\.json$/, '');
+    if (stem.endsWith('.index')) return null;
+    const hash = stem.startsWith('cid:') ? stem.slice(4) : stem.slice(stem.lastIndexOf('.') + 1);
+    return /^[0-9a-f]{64}$/.test(hash) ? hash.slice(0, 2) : null;
+  }
+
+  public getRootDir(): string {
+    return this.rootDir;
+  }
+
+  public getMode(): LayoutMode {
+    return this.mode;
+  }
+
+  public isSharded(): boolean {
+    return this.mode === 'sharded';
+  }
+
+  /**
+   * Path a file is written to under the current layout. Creates the shard
+   * directory when needed.
+   */
+  public writePath(filename: string): string {
+    const target = this.targetPath(filename);
+    if (this.mode === 'sharded' && ContentLayout.shardOf(filename)) {
+      fs.mkdirSync(path.dirname(target), { recursive: true });
+    }
+    return target;
+  }
+
+  /**
+   * Path a file belongs at under the current layout, without touching disk
+   */
+  public targetPath(filename: string): string {
+    const shard = this.mode === 'sharded' ? ContentLayout.shardOf(filename) : null;
+    return shard ? path.join(this.rootDir, shard, filename) : path.join(this.rootDir, filename);
+  }
+
+  /**
+   * Path of an existing file in either layout, or null if it does not exist
+   */
+  public resolve(filename: string): string | null {
+    for (const candidate of this.candidates(filename)) {
+      if (fs.existsSync(candidate)) return candidate;
+    }
+    return null;
+  }
+
+  /**
+   * Contents of a file in either layout, or null if it does not exist.
+   * Reads without blocking the event loop.
+   */
+  public async readFile(filename: string): Promise<string | null> {
+    for (const candidate of this.candidates(filename)) {
+      try {
+        return await fs.promises.readFile(candidate, 'utf-8');
+      } catch (error: any) {
+        if (error?.code !== 'ENOENT') throw error;
+      }
+    }
+    return null;
+  }
+
+  /**
+   * Where a file may be, the current layout's location first
+   */
+  private candidates(filename: string): string[] {
+    const flatPath = path.join(this.rootDir, filename);
+    const shard = ContentLayout.shardOf(filename);
+    if (!shard) return [flatPath];
+    const shardedPath = path.join(this.rootDir, shard, filename);
+    return this.mode === 'sharded' ? [shardedPath, flatPath] : [flatPath, shardedPath];
+  }
+
+  /**
+   * Path to use for reading a file: where it exists, or where it would be
+   * written if it does not
+   */
+  public pathFor(filename: string): string {
+    return this.resolve(filename) ?? this.targetPath(filename);
+  }
+
+  /**
+   * Filenames of every file in the directory, top level and shards, mapped
+   * to their full paths
+   */
+  public listFiles(): Map<string, string> {
+    const files = new Map<string, string>();
+    if (!fs.existsSync(this.rootDir)) return files;
+
+    for (const entry of fs.readdirSync(this.rootDir, { withFileTypes: true })) {
+      if (entry.isFile() && entry.name !== LAYOUT_MARKER) {
+        // A copy in its own shard wins over a stray flat copy
+        if (!files.has(entry.name)) {
+          files.set(entry.name, path.join(this.rootDir, entry.name));
+        }
+      } else if (entry.isDirectory() && /^[0-9a-f]{2}$/.test(entry.name)) {
+        const shardDir = path.join(this.rootDir, entry.name);
+        for (const name of fs.readdirSync(shardDir)) {
+          files.set(name, path.join(shardDir, name));
+        }
+      }
+    }
+    return files;
+  }
+
+  /**
+   * Move every content-addressed file to the given layout and record it.
+   * Safe to re-run after an interruption. Returns the number of files moved.
+   */
+  public migrate(target: LayoutMode): number {
+    let moved = 0;
+    for (const [filename, current] of this.listFiles()) {
+      const shard = ContentLayout.shardOf(filename);
+      if (!shard) continue;
+
+      const destination = target === 'sharded'
+        ? path.join(this.rootDir, shard, filename)
+        : path.join(this.rootDir, filename);
+      if (destination === current) continue;
+
+      fs.mkdirSync(path.dirname(destination), { recursive: true });
+      fs.renameSync(current, destination);
+      moved++;
+    }
+
+    if (target === 'flat') {
+      // Remove shard directories left empty
+      for (const entry of fs.readdirSync(this.rootDir, { withFileTypes: true })) {
+        const shardDir = path.join(this.rootDir, entry.name);
+        if (entry.isDirectory() && /^[0-9a-f]{2}$/.test(entry.name) && fs.readdirSync(shardDir).length === 0) {
+          fs.rmdirSync(shardDir);
+        }
+      }
+      fs.rmSync(path.join(this.rootDir, LAYOUT_MARKER), { force: true });
+    } else {
+      fs.writeFileSync(path.join(this.rootDir, LAYOUT_MARKER), 'sharded\n');
+    }
+
+    this.mode = target;
+    return moved;
+  }
+}
@@ -0,0 +1,223 @@
+import * as fs from 'fs';
+import * as path from 'path';
+import { SpecCatalog } from './spec-catalog.js';
+
+// Bump when the way dependency targets are extracted changes
+const INDEX_FORMAT = 1;
+
+interface ComponentEdges {
+  /** mtime:size of the component's index file when its edges were read */
+  stamp: string;
+  /** Namespaces this component depends on */
+  targets: string[];
+}
+
+interface IndexFile {
+  format: number;
+  specDir: string;
+  components: Record<string, ComponentEdges>;
+}
+
+/**
+ * Reverse-dependency index of a spec/ directory: namespace → components
+ * that reference it through `parent`, a schema `$ref` or a conformance
+ * requirement's `schema`.
+ *
+ * Each component's outgoing edges are read once and kept together with the
+ * stamp of its index file. Since artifacts are content-addressed, a
+ * component can only change by rewriting its index, so edges are re-read
+ * only for namespaces the catalog invalidates or whose stamp no longer
+ * matches when a persisted index is loaded.
+ */
+export class DependencyIndex {
+  private catalog: SpecCatalog;
+  private indexFile: string | null;
+  private components: Map<string, ComponentEdges> | null = null;
+  private dependents: Map<string, Set<string>> = new Map();
+  private stale: Set<string> = new Set();
+  private needsVerify: boolean = true;
+  private dirty: boolean = false;
+
+  constructor(catalog: SpecCatalog, indexFile: string | null = null) {
+    this.catalog = catalog;
+    this.indexFile = indexFile;
+  }
+
+  /**
+   * Namespaces a reference string points at. References are matched on
+   * namespace boundaries: `hologram.interface.spec#/x` targets
+   * `hologram`, `hologram.interface` and `hologram.interface.spec`.
+   */
+  public static referenceTargets(reference: string): string[] {
+    const name = reference.split('#')[0].replace(/\.json$/, '');
+    const parts = name.split('.');
+    return parts.map((_, i) => parts.slice(0, i + 1).join('.')).filter(Boolean);
+  }
+
+  /**
+   * Components that depend on a namespace, excluding itself
+   */
+  public getDependents(namespace: string): string[] {
+    this.refresh();
+    const dependents = this.dependents.get(namespace);
+    if (!dependents) return [];
+    return [...dependents].filter(ns => ns !== namespace).sort();
+  }
+
+  /**
+   * Re-read a component's edges on next access
+   */
+  public markStale(namespace: string): void {
+    this.stale.add(namespace);
+  }
+
+  /**
+   * Re-check every component's stamp on next access
+   */
+  public invalidateAll(): void {
+    this.needsVerify = true;
+  }
+
+  private refresh(): void {
+    if (!this.components) {
+      this.components = this.load();
+      for (const [namespace, edges] of this.components) {
+        this.link(namespace, edges.targets);
+      }
+    }
+
+    if (this.needsVerify) {
+      this.needsVerify = false;
+      const namespaces = new Set(this.catalog.listNamespaces());
+      for (const namespace of this.components.keys()) {
+        if (!namespaces.has(namespace)) this.stale.add(namespace);
+      }
+      for (const namespace of namespaces) {
+        const edges = this.components.get(namespace);
+        if (!edges || edges.stamp !== this.stampOf(namespace)) this.stale.add(namespace);
+      }
+    }
+
+    if (this.stale.size > 0) {
+      for (const namespace of this.stale) {
+        this.rescan(namespace);
+      }
+      this.stale.clear();
+    }
+
+    if (this.dirty) {
+      this.save();
+    }
+  }
+
+  private rescan(namespace: string): void {
+    const previous = this.components!.get(namespace);
+    if (previous) {
+      this.unlink(namespace, previous.targets);
+      this.components!.delete(namespace);
+    }
+
+    let index;
+    try {
+      index = this.catalog.getIndex(namespace);
+    } catch {
+      // Unreadable index: no edges until it is rewritten
+      index = null;
+    }
+    this.dirty = true;
+    if (!index) return;
+
+    const targets = new Set<string>();
+    for (const artifactRef of Object.values(index.artifacts)) {
+      if (!artifactRef) continue;
+      let content;
+      try {
+        content = this.catalog.getArtifact(artifactRef);
+      } catch {
+        continue;
+      }
+      if (!content || typeof content !== 'object') continue;
+
+      if (typeof content.parent === 'string') {
+        targets.add(content.parent);
+      }
+      if (typeof content.$ref === 'string') {
+        DependencyIndex.referenceTargets(content.$ref).forEach(t => targets.add(t));
+      }
+      const requirements = content.component?.conformance_requirements;
+      if (requirements && typeof requirements === 'object') {
+        for (const req of Object.values(requirements) as any[]) {
+          if (req && typeof req === 'object' && typeof req.schema === 'string') {
+            DependencyIndex.referenceTargets(req.schema).forEach(t => targets.add(t));
+          }
+        }
+      }
+    }
+
+    const edges = { stamp: this.stampOf(namespace), targets: [...targets] };
+    this.components!.set(namespace, edges);
+    this.link(namespace, edges.targets);
+  }
+
+  private link(namespace: string, targets: string[]): void {
+    for (const target of targets) {
+      if (!this.dependents.has(target)) this.dependents.set(target, new Set());
+      this.dependents.get(target)!.add(namespace);
+    }
+  }
+
+  private unlink(namespace: string, targets: string[]): void {
+    for (const target of targets) {
+      const dependents = this.dependents.get(target);
+      dependents?.delete(namespace);
+      if (dependents?.size === 0) this.dependents.delete(target);
+    }
+  }
+
+  private stampOf(namespace: string): string {
+    try {
+      const stat = fs.statSync(this.catalog.indexPath(namespace));
+      return `${stat.mtimeMs}:${stat.size}`;
+    } catch {
+      return '';
+    }
+  }
+
+  private load(): Map<string, ComponentEdges> {
+    const components = new Map<string, ComponentEdges>();
+    if (!this.indexFile) return components;
+
+    try {
+      const file: IndexFile = JSON.parse(fs.readFileSync(this.indexFile, 'utf-8'));
+      const specDir = path.resolve(this.catalog.getSpecDir());
+      if (file.format === INDEX_FORMAT && file.specDir === specDir && file.components) {
+        for (const [namespace, edges] of Object.entries(file.components)) {
+          components.set(namespace, edges);
+        }
+      }
+    } catch {
+      // Missing or unreadable: rebuilt from spec/ on first use
+    }
+    return components;
+  }
+
+  private save(): void {
+    this.dirty = false;
+    if (!this.indexFile || !this.components) return;
+
+    const file: IndexFile = {
+      format: INDEX_FORMAT,
+      specDir: path.resolve(this.catalog.getSpecDir()),
+      components: Object.fromEntries(this.components),
+    };
+    try {
+      fs.mkdirSync(path.dirname(this.indexFile), { recursive: true });
+      const tempPath = `${this.indexFile}.${process.pid}.tmp`;
+      fs.writeFileSync(tempPath, JSON.stringify(file));
+      fs.renameSync(tempPath, this.indexFile);
+    } catch (error) {
+      // The index is an optimisation; it is rebuilt if it cannot be saved
+      console.error(`Failed to save dependency index ${this.indexFile}:`, error);
+    }
+  }
+}
@@ -0,0 +1,54 @@
+/**
+ * RFC 6901 JSON pointers, used to project parts of a component out of a
+ * response instead of returning it whole.
+ */
+
+/**
+ * Reference tokens of a pointer ("" is the whole document)
+ */
+export function parsePointer(pointer: string): string[] {
+  if (pointer === '') return [];
+  if (!pointer.startsWith('/')) {
+    throw new Error(`Invalid JSON pointer "${pointer}": must be empty or start with "/"`);
+  }
+  return pointer.substring(1).split('/').map(token => token.replace(/~1/g, '/').replace(/~0/g, '~'));
+}
+
+/**
+ * Value a pointer refers to, or undefined if the document has none there
+ */
+export function resolvePointer(document: any, pointer: string): any {
+  let value = document;
+  for (const token of parsePointer(pointer)) {
+    if (Array.isArray(value)) {
+      if (!/^(0|[1-9][0-9]*)$/.test(token)) return undefined;
+      value = value[Number(token)];
+    } else if (value !== null && typeof value === 'object' && Object.prototype.hasOwnProperty.call(value, token)) {
+      value = value[token];
+    } else {
+      return undefined;
+    }
+  }
+  return value;
+}
+
+/**
+ * Values at each pointer, keyed by pointer. Pointers the document does not
+ * contain are listed in `missing`.
+ */
+export function projectPointers(document: any, pointers: string[]): {
+  fields: Record<string, any>;
+  missing: string[];
+} {
+  const fields: Record<string, any> = {};
+  const missing: string[] = [];
+  for (const pointer of pointers) {
+    const value = resolvePointer(document, pointer);
+    if (value === undefined) {
+      missing.push(pointer);
+    } else {
+      fields[pointer] = value;
+    }
+  }
+  return { fields, missing };
+}
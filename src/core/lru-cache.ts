@@ -0,0 +1,92 @@
+export interface LRUCacheOptions {
+  /** Maximum number of entries kept */
+  maxEntries: number;
+  /** Maximum total size of entries, as reported by the caller */
+  maxBytes: number;
+}
+
+export interface LRUCacheStats {
+  entries: number;
+  bytes: number;
+  hits: number;
+  misses: number;
+  evictions: number;
+}
+
+/**
+ * Least-recently-used cache bounded by entry count and approximate size.
+ * Relies on Map preserving insertion order: every hit re-inserts its entry,
+ * so the first key is always the least recently used.
+ */
+export class LRUCache<K, V> {
+  private entries: Map<K, { value: V; bytes: number }> = new Map();
+  private maxEntries: number;
+  private maxBytes: number;
+  private bytes = 0;
+  private hits = 0;
+  private misses = 0;
+  private evictions = 0;
+
+  constructor(options: LRUCacheOptions) {
+    this.maxEntries = options.maxEntries;
+    this.maxBytes = options.maxBytes;
+  }
+
+  public get(key: K): V | undefined {
+    const entry = this.entries.get(key);
+    if (!entry) {
+      this.misses++;
+      return undefined;
+    }
+    this.hits++;
+    this.entries.delete(key);
+    this.entries.set(key, entry);
+    return entry.value;
+  }
+
+  public has(key: K): boolean {
+    return this.entries.has(key);
+  }
+
+  /**
+   * Insert or replace an entry. Entries larger than the whole byte budget
+   * are not cached at all.
+   */
+  public set(key: K, value: V, bytes: number): void {
+    this.delete(key);
+    if (bytes > this.maxBytes || this.maxEntries <= 0) {
+      return;
+    }
+
+    this.entries.set(key, { value, bytes });
+    this.bytes += bytes;
+    while (this.entries.size > this.maxEntries || this.bytes > this.maxBytes) {
+      const oldest = this.entries.keys().next().value as K;
+      this.delete(oldest);
+      this.evictions++;
+    }
+  }
+
+  public delete(key: K): boolean {
+    const entry = this.entries.get(key);
+    if (!entry) return false;
+    this.entries.delete(key);
+    this.bytes -= entry.bytes;
+    return true;
+  }
+
+  public clear(): void {
+    this.entries.clear();
+    this.bytes = 0;
+  }
+
+  public getStats(): LRUCacheStats {
+    return {
+      entries: this.entries.size,
+      bytes: this.bytes,
+      hits: this.hits,
+      misses: this.misses,
+      evictions: this.evictions,
+    };
+  }
+}
@@ -0,0 +1,143 @@
+/**
+ * Process-wide counters and latency histograms, cheap enough to leave on in
+ * production. Core classes count I/O and compilation; the MCP server times
+ * each tool call. Reported by the diagnostics tool and, when enabled, as
+ * periodic JSON log lines.
+ *
+ * Sizes are string lengths of the JSON read or written, which equal bytes
+ * for the ASCII JSON spec/ holds; measuring exact UTF-8 bytes would cost a
+ * second pass over every file.
+ */
+
+// Upper bounds (ms) of the latency buckets; the last bucket is unbounded
+const BUCKET_BOUNDS = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000];
+
+export interface LatencySnapshot {
+  count: number;
+  errors: number;
+  totalMs: number;
+  maxMs: number;
+  /** Upper bound of the bucket holding the median / 95th / 99th percentile */
+  p50Ms: number | null;
+  p95Ms: number | null;
+  p99Ms: number | null;
+  /** Calls per bucket, keyed by upper bound ("+Inf" for the last) */
+  buckets: Record<string, number>;
+}
+
+class LatencyHistogram {
+  private counts: number[] = new Array(BUCKET_BOUNDS.length + 1).fill(0);
+  private count = 0;
+  private errors = 0;
+  private totalMs = 0;
+  private maxMs = 0;
+
+  public record(ms: number, ok: boolean): void {
+    let bucket = 0;
+    while (bucket < BUCKET_BOUNDS.length && ms > BUCKET_BOUNDS[bucket]) bucket++;
+    this.counts[bucket]++;
+    this.count++;
+    if (!ok) this.errors++;
+    this.totalMs += ms;
+    this.maxMs = Math.max(this.maxMs, ms);
+  }
+
+  public snapshot(): LatencySnapshot {
+    const buckets: Record<string, number> = {};
+    this.counts.forEach((n, i) => {
+      if (n > 0) buckets[i < BUCKET_BOUNDS.length ? String(BUCKET_BOUNDS[i]) : '+Inf'] = n;
+    });
+    return {
+      count: this.count,
+      errors: this.errors,
+      totalMs: round(this.totalMs),
+      maxMs: round(this.maxMs),
+      p50Ms: this.percentile(0.5),
+      p95Ms: this.percentile(0.95),
+      p99Ms: this.percentile(0.99),
+      buckets,
+    };
+  }
+
+  private percentile(q: number): number | null {
+    if (this.count === 0) return null;
+    const rank = Math.ceil(q * this.count);
+    let seen = 0;
+    for (let i = 0; i < this.counts.length; i++) {
+      seen += this.counts[i];
+      if (seen >= rank) return i < BUCKET_BOUNDS.length ? BUCKET_BOUNDS[i] : round(this.maxMs);
+    }
+    return round(this.maxMs);
+  }
+}
+
+export interface MetricsSnapshot {
+  uptimeMs: number;
+  tools: Record<string, LatencySnapshot>;
+  io: { filesRead: number; filesWritten: number; bytesParsed: number; bytesWritten: number };
+  schemas: { compiles: number; compileMs: number };
+  catalog: { hits: number; misses: number; hitRate: number | null };
+}
+
+export class Metrics {
+  private started = Date.now();
+  private tools: Map<string, LatencyHistogram> = new Map();
+
+  public readonly io = { filesRead: 0, filesWritten: 0, bytesParsed: 0, bytesWritten: 0 };
+  public readonly schemas = { compiles: 0, compileMs: 0 };
+  public readonly catalog = { hits: 0, misses: 0 };
+
+  public recordTool(tool: string, ms: number, ok: boolean): void {
+    let histogram = this.tools.get(tool);
+    if (!histogram) {
+      histogram = new LatencyHistogram();
+      this.tools.set(tool, histogram);
+    }
+    histogram.record(ms, ok);
+  }
+
+  /**
+   * A file read from disk and parsed as JSON
+   */
+  public recordRead(bytes: number): void {
+    this.io.filesRead++;
+    this.io.bytesParsed += bytes;
+  }
+
+  public recordWrite(bytes: number): void {
+    this.io.filesWritten++;
+    this.io.bytesWritten += bytes;
+  }
+
+  public recordCompile(ms: number): void {
+    this.schemas.compiles++;
+    this.schemas.compileMs += ms;
+  }
+
+  public snapshot(): MetricsSnapshot {
+    const lookups = this.catalog.hits + this.catalog.misses;
+    return {
+      uptimeMs: Date.now() - this.started,
+      tools: Object.fromEntries([...this.tools].map(([tool, h]) => [tool, h.snapshot()])),
+      io: { ...this.io },
+      schemas: { compiles: this.schemas.compiles, compileMs: round(this.schemas.compileMs) },
+      catalog: {
+        ...this.catalog,
+        hitRate: lookups > 0 ? round(this.catalog.hits / lookups) : null,
+      },
+    };
+  }
+}
+
+export const metrics = new Metrics();
+
+/**
+ * Milliseconds since a process.hrtime.bigint() reading
+ */
+export function elapsedMs(start: bigint): number {
+  return Number(process.hrtime.bigint() - start) / 1e6;
+}
+
+function round(value: number): number {
+  return Math.round(value * 1000) / 1000;
+}
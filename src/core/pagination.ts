@@ -0,0 +1,74 @@
+/**
+ * Cursor pagination over namespaces.
+ *
+ * A cursor names the last namespace of the previous page rather than an
+ * offset, so components created or deleted between calls never shift a
+ * page or repeat an entry.
+ */
+
+export const DEFAULT_PAGE_SIZE = 50;
+export const MAX_PAGE_SIZE = 1000;
+
+export interface PageRequest {
+  /** Only namespaces equal to this or below it (`prefix.*`) */
+  prefix?: string;
+  /** Opaque cursor from a previous page */
+  cursor?: string;
+  /** Page size (default 50, at most 1000) */
+  limit?: number;
+}
+
+export interface Page {
+  items: string[];
+  /** Namespaces matching the prefix, across all pages */
+  total: number;
+  /** Cursor of the next page, or null on the last one */
+  nextCursor: string | null;
+}
+
+export function encodeCursor(after: string): string {
+  return Buffer.from(JSON.stringify({ after }), 'utf-8').toString('base64url');
+}
+
+export function decodeCursor(cursor: string): string {
+  try {
+    const decoded = JSON.parse(Buffer.from(cursor, 'base64url').toString('utf-8'));
+    if (typeof decoded?.after === 'string') return decoded.after;
+  } catch {
+    // Reported below
+  }
+  throw new Error(`Invalid cursor: ${cursor}`);
+}
+
+/**
+ * Whether a namespace is at or below a prefix, on namespace boundaries:
+ * `hologram.interface` matches `hologram.interface.spec` but not
+ * `hologram.interfaces`. A prefix ending in "." matches below it only.
+ */
+export function matchesPrefix(namespace: string, prefix: string | undefined): boolean {
+  if (!prefix) return true;
+  if (prefix.endsWith('.')) return namespace.startsWith(prefix);
+  return namespace === prefix || namespace.startsWith(`${prefix}.`);
+}
+
+/**
+ * One page of the namespaces matching a request, in sorted order
+ */
+export function paginate(namespaces: string[], request: PageRequest): Page {
+  const matching = namespaces.filter(ns => matchesPrefix(ns, request.prefix)).sort();
+  const limit = Math.min(Math.max(1, Math.floor(request.limit ?? DEFAULT_PAGE_SIZE)), MAX_PAGE_SIZE);
+
+  let start = 0;
+  if (request.cursor) {
+    const after = decodeCursor(request.cursor);
+    while (start < matching.length && matching[start] <= after) start++;
+  }
+
+  const items = matching.slice(start, start + limit);
+  const hasMore = start + limit < matching.length;
+  return {
+    items,
+    total: matching.length,
+    nextCursor: hasMore ? encodeCursor(items[items.length - 1]) : null,
+  };
+}
@@ -3,61 +3,243 @@ import addFormats from 'ajv-formats';
 import * as fs from 'fs';
 import * as path from 'path';
 import { ValidationError, HologramBase, HologramComponent, ComponentIndex } from '../types.js';
+import { SpecCatalog } from './spec-catalog.js';
+import { CompiledValidatorCache, hasExternalRef } from './validator-cache.js';
+import { ValidationLedger } from './validation-ledger.js';
+import { yieldToEventLoop } from './concurrency.js';
+import { metrics, elapsedMs } from './metrics.js';
+import {
+  ValidationPoolOptions,
+  defaultWorkerScript,
+  groupComponents,
+  poolSize,
+  runValidationPool,
+} from './validation-pool.js';
+
+export interface SchemaValidatorOptions {
+  /** Persist compiled validators across processes, keyed by spec content hash */
+  compiledCache?: CompiledValidatorCache;
+  /** Persist per-artifact verdicts so unchanged artifacts are not re-validated */
+  ledger?: ValidationLedger;
+}
 
 export class SchemaValidator {
+  private static shared: SchemaValidator | null = null;
+
   private ajv: any;
   private schemasLoaded: boolean = false;
   private schemaCache: Map<string, any> = new Map();
+  private schemaIds: Map<string, string> = new Map();
+  private schemaRefs: Map<string, string> = new Map();
+  private schemaArtifacts: Map<string, string> = new Map();
+  private compiled: Map<string, any> = new Map();
   private specDir: string;
-
-  constructor(specDir: string = path.join(process.cwd(), 'spec')) {
+  private catalog: SpecCatalog;
+  private compiledCache: CompiledValidatorCache | null;
+  private ledger: ValidationLedger | null;
+
+  constructor(
+    specDir: string = path.join(process.cwd(), 'spec'),
+    catalog: SpecCatalog = new SpecCatalog(specDir),
+    options: SchemaValidatorOptions = {}
+  ) {
     this.specDir = specDir;
+    this.catalog = catalog;
+    this.compiledCache = options.compiledCache ?? null;
+    this.ledger = options.ledger ?? null;
     this.ajv = new (Ajv as any)({
       allErrors: true,
       strict: false,  // Allow custom keywords like namespace, parent, etc.
       validateFormats: true,
       validateSchema: true,
       verbose: true,
+      // Standalone source is only retained when it will be persisted
+      code: { source: this.compiledCache !== null },
     });
     (addFormats as any)(this.ajv);
   }
 
+  /**
+   * Install a process-wide validator. Operations obtain it through
+   * forSpecDir() so its catalog and compiled schemas stay warm across calls.
+   */
+  public static setShared(validator: SchemaValidator | null): void {
+    SchemaValidator.shared = validator;
+  }
+
+  /**
+   * Get the shared validator if it serves specDir, otherwise a fresh one
+   */
+  public static forSpecDir(specDir: string = path.join(process.cwd(), 'spec')): SchemaValidator {
+    const shared = SchemaValidator.shared;
+    if (shared && path.resolve(shared.specDir) === path.resolve(specDir)) {
+      return shared;
+    }
+    return new SchemaValidator(specDir);
+  }
+
+  public getCatalog(): SpecCatalog {
+    return this.catalog;
+  }
+
+  public getLedger(): ValidationLedger | null {
+    return this.ledger;
+  }
+
+  public getCompiledCache(): CompiledValidatorCache | null {
+    return this.compiledCache;
+  }
+
+  /**
+   * Write verdicts recorded since the last save to the ledger, if any
+   */
+  public saveLedger(options: { prune?: boolean } = {}): void {
+    this.ledger?.save(options);
+  }
+
   /**
    * Load all schemas from spec/ directory
    */
   public async loadSchemas(): Promise<void> {
     if (this.schemasLoaded) return;
 
+    // Read every index and artifact without blocking, then register from cache
+    const namespaces = await this.catalog.listNamespacesAsync();
+    await this.catalog.prefetch(namespaces);
+    if (this.schemasLoaded) return;
+
     // Load schemas from index files
-    const files = fs.readdirSync(this.specDir);
-    const indexFiles = files.filter(f => f.endsWith('.index.json'));
+    for (const namespace of namespaces) {
+      this.loadNamespaceSchema(namespace);
+    }
 
-    for (const indexFile of indexFiles) {
-      const indexPath = path.join(this.specDir, indexFile);
-      try {
-        const index: ComponentIndex = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
-
-        // Load spec file if it exists in the index
-        if (index.artifacts.spec) {
-          // Add .json extension to artifact reference
-          const filename = `${index.artifacts.spec}.json`;
-          const specPath = path.join(this.specDir, filename);
-          if (fs.existsSync(specPath)) {
-            const schema = JSON.parse(fs.readFileSync(specPath, 'utf-8'));
-            const schemaId = schema.$id || `${index.namespace}.spec`;
-            // Check if schema already exists before adding
-            if (!this.ajv.getSchema(schemaId)) {
-              this.ajv.addSchema(schema, schemaId);
-              this.schemaCache.set(schemaId, schema);
-            }
+    this.schemasLoaded = true;
+  }
+
+  /**
+   * Register the spec schema of one component with Ajv
+   */
+  private loadNamespaceSchema(namespace: string): void {
+    try {
+      const index = this.catalog.getIndex(namespace);
+
+      // Load spec file if it exists in the index
+      if (index?.artifacts.spec) {
+        const schema = this.catalog.getArtifact(index.artifacts.spec);
+        if (schema) {
+          const schemaId = schema.$id || `${index.namespace}.spec`;
+          // Check if schema already exists before adding (getSchema would compile it)
+          if (!this.schemaCache.has(schemaId)) {
+            this.ajv.addSchema(schema, schemaId);
+            this.schemaCache.set(schemaId, schema);
+            this.schemaIds.set(namespace, schemaId);
+            this.schemaRefs.set(namespace, index.artifacts.spec);
+            this.schemaArtifacts.set(schemaId, index.artifacts.spec);
           }
         }
-      } catch (error) {
-        console.error(`Failed to load schema from index ${indexFile}:`, error);
+      }
+    } catch (error) {
+      console.error(`Failed to load schema from index ${namespace}.index.json:`, error);
+    }
+  }
+
+  /**
+   * Drop the Ajv registration of one component's schema
+   */
+  private unloadNamespaceSchema(namespace: string): void {
+    const schemaId = this.schemaIds.get(namespace);
+    if (schemaId) {
+      this.ajv.removeSchema(schemaId);
+      this.schemaCache.delete(schemaId);
+      this.schemaArtifacts.delete(schemaId);
+      this.compiled.delete(schemaId);
+      this.schemaIds.delete(namespace);
+    }
+    this.schemaRefs.delete(namespace);
+  }
+
+  /**
+   * Forget cached state for a component after its index changed on disk.
+   * The index is re-read; if it now points at a different spec artifact the
+   * old schema is removed from Ajv and the new one added in its place, so
+   * every other compiled schema stays warm.
+   */
+  public invalidate(namespace: string): void {
+    const previousRef = this.schemaRefs.get(namespace);
+    this.catalog.invalidateNamespace(namespace);
+
+    let currentRef: string | undefined;
+    try {
+      currentRef = this.catalog.getIndex(namespace)?.artifacts.spec;
+    } catch {
+      // Unreadable (e.g. mid-write): treat as changed and retry on next access
+      currentRef = undefined;
+    }
+    if (previousRef !== undefined && previousRef === currentRef) {
+      return;
+    }
+
+    this.unloadNamespaceSchema(namespace);
+    if (this.schemasLoaded) {
+      this.loadNamespaceSchema(namespace);
+    }
+  }
+
+  /**
+   * Forget a cached artifact after its file changed on disk. If it is the
+   * registered spec of a component, that schema is reloaded as well.
+   */
+  public invalidateArtifact(artifactRef: string): void {
+    this.catalog.forgetArtifact(artifactRef);
+    for (const [namespace, specRef] of this.schemaRefs) {
+      if (specRef === artifactRef) {
+        this.unloadNamespaceSchema(namespace);
+        if (this.schemasLoaded) {
+          this.loadNamespaceSchema(namespace);
+        }
       }
     }
+  }
 
-    this.schemasLoaded = true;
+  /**
+   * Forget everything; used when a change cannot be attributed to a file
+   */
+  public invalidateAll(): void {
+    for (const namespace of [...this.schemaIds.keys()]) {
+      this.unloadNamespaceSchema(namespace);
+    }
+    this.catalog.invalidateAll();
+    this.schemasLoaded = false;
+  }
+
+  /**
+   * Compile a candidate schema without registering its $id, so repeated
+   * submissions of unsaved specs never collide in a long-lived Ajv instance.
+   * Throws if the schema is invalid.
+   */
+  public compileDetached(schema: any): any {
+    const anonymous = { ...schema };
+    delete anonymous.$id;
+    const start = process.hrtime.bigint();
+    try {
+      return this.ajv.compile(anonymous);
+    } finally {
+      metrics.recordCompile(elapsedMs(start));
+      this.ajv.removeSchema(anonymous);
+    }
+  }
+
+  /**
+   * Validate data against a schema that is not (yet) registered
+   */
+  public async validateAgainstDetached(
+    data: any,
+    schema: any,
+    schemaId: string
+  ): Promise<{ valid: boolean; errors: ValidationError[] }> {
+    await this.loadSchemas();
+    const validate = this.compileDetached(schema);
+    return this.collectErrors(validate, data, schemaId);
   }
 
   /**
@@ -69,7 +251,7 @@ export class SchemaValidator {
   ): Promise<{ valid: boolean; errors: ValidationError[] }> {
     await this.loadSchemas();
 
-    const validate = this.ajv.getSchema(schemaId);
+    const validate = this.getValidateFunction(schemaId);
     if (!validate) {
       return {
         valid: false,
@@ -77,6 +259,60 @@ export class SchemaValidator {
       };
     }
 
+    return this.collectErrors(validate, data, schemaId);
+  }
+
+  /**
+   * Get the compiled validator for a registered schema. Component specs are
+   * loaded from the compiled-validator cache when one is configured, and
+   * compiled by Ajv (then persisted) otherwise.
+   */
+  private getValidateFunction(schemaId: string): any {
+    const compiled = this.compiled.get(schemaId);
+    if (compiled) return compiled;
+
+    const artifactRef = this.schemaArtifacts.get(schemaId);
+    const schema = this.schemaCache.get(schemaId);
+    let validate: any = null;
+
+    if (this.compiledCache && artifactRef && schema) {
+      validate = this.compiledCache.load(artifactRef, this.ajv, schema);
+      if (!validate) {
+        validate = this.compileRegistered(schemaId);
+        if (validate) {
+          this.compiledCache.store(artifactRef, this.ajv, schema, validate);
+        }
+      }
+    } else {
+      validate = this.compileRegistered(schemaId);
+    }
+
+    if (validate) {
+      this.compiled.set(schemaId, validate);
+    }
+    return validate;
+  }
+
+  /**
+   * Have Ajv compile a registered schema, counting the compile
+   */
+  private compileRegistered(schemaId: string): any {
+    const start = process.hrtime.bigint();
+    try {
+      return this.ajv.getSchema(schemaId);
+    } finally {
+      metrics.recordCompile(elapsedMs(start));
+    }
+  }
+
+  /**
+   * Run a compiled validator and convert Ajv errors to ValidationErrors
+   */
+  private collectErrors(
+    validate: any,
+    data: any,
+    schemaId: string
+  ): { valid: boolean; errors: ValidationError[] } {
     const valid = validate(data);
     const errors: ValidationError[] = [];
 
@@ -121,18 +357,18 @@ export class SchemaValidator {
    */
   public async getComponentRequirements(): Promise<any | null> {
     // Look for hologram.component through its index
-    const indexPath = path.join(this.specDir, 'hologram.component.index.json');
-    if (!fs.existsSync(indexPath)) {
+    if (!this.catalog.hasIndex('hologram.component')) {
       return null;
     }
 
     try {
-      const index: ComponentIndex = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
-      if (index.artifacts.spec) {
+      const index = this.catalog.getIndex('hologram.component');
+      if (index?.artifacts.spec) {
         // Load the spec file which contains conformance requirements
-        const filename = `${index.artifacts.spec}.json`;
-        const specPath = path.join(this.specDir, filename);
-        const spec = JSON.parse(fs.readFileSync(specPath, 'utf-8'));
+        const spec = this.catalog.getArtifact(index.artifacts.spec);
+        if (!spec) {
+          throw new Error(`Artifact not found: ${index.artifacts.spec}`);
+        }
         // Return the spec directly - it already has the component structure
         return spec;
       }
@@ -143,13 +379,32 @@ export class SchemaValidator {
     return null;
   }
 
+  /**
+   * Key identifying the outcome of checking one artifact: its content hash
+   * plus the spec artifacts it is checked against. Returns null when the
+   * outcome also depends on schemas not captured in the key.
+   */
+  private verdictKey(type: string, artifactRef: string, content: any, required: boolean): string | null {
+    if (type === 'spec') {
+      return hasExternalRef(content) ? null : `spec:${artifactRef}`;
+    }
+    const baseRef = this.schemaArtifacts.get('hologram.spec') ?? '-';
+    const conformanceRef = required
+      ? this.schemaArtifacts.get(`hologram.${type}.spec`) ?? '-'
+      : '';
+    return `${type}:${artifactRef}:${baseRef}:${conformanceRef}`;
+  }
+
   /**
    * Validate a complete component (all 6 files)
    */
   public async validateComponent(
-    namespace: string
+    namespace: string,
+    sharedResults?: Map<string, ValidationError[]>
   ): Promise<{ valid: boolean; errors: ValidationError[] }> {
     const errors: ValidationError[] = [];
+    await this.loadSchemas();
+    await this.catalog.prefetch(['hologram.component', namespace]);
 
     // Get component requirements from model
     const componentModel = await this.getComponentRequirements();
@@ -167,8 +422,7 @@ export class SchemaValidator {
       .filter(key => conformanceReqs[key].required);
 
     // Load component index
-    const indexPath = path.join(this.specDir, `${namespace}.index.json`);
-    if (!fs.existsSync(indexPath)) {
+    if (!this.catalog.hasIndex(namespace)) {
       errors.push({
         file: `${namespace}.index.json`,
         message: 'Component index not found',
@@ -178,7 +432,11 @@ export class SchemaValidator {
 
     let index: ComponentIndex;
     try {
-      index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
+      const loaded = this.catalog.getIndex(namespace);
+      if (!loaded) {
+        throw new Error('Index file disappeared');
+      }
+      index = loaded;
     } catch (e) {
       errors.push({
         file: `${namespace}.index.json`,
@@ -217,8 +475,7 @@ export class SchemaValidator {
       if (artifactRef) {
         // Add .json extension to artifact reference to get actual filename
         const filename = `${artifactRef}.json`;
-        const filePath = path.join(this.specDir, filename);
-        if (!fs.existsSync(filePath)) {
+        if (!this.catalog.hasArtifact(artifactRef)) {
           errors.push({
             file: filename,
             message: `Artifact referenced in index not found`,
@@ -226,7 +483,7 @@ export class SchemaValidator {
           continue;
         }
         try {
-          const content = JSON.parse(fs.readFileSync(filePath, 'utf-8'));
+          const content = this.catalog.getArtifact(artifactRef);
           componentFiles[type] = { file: filename, artifactRef, content };
         } catch (e) {
           errors.push({
@@ -241,6 +498,22 @@ export class SchemaValidator {
     for (const [type, fileInfo] of Object.entries(componentFiles)) {
       const { file, content } = fileInfo;
 
+      // Checks depend only on the artifact and the specs it is checked
+      // against, so an artifact shared by several components is checked once
+      // per run, and one unchanged since a previous run not at all
+      const sharedKey = this.verdictKey(
+        type, fileInfo.artifactRef, content, requiredConformance.includes(type)
+      );
+      const shared = sharedKey
+        ? sharedResults?.get(sharedKey) ?? this.ledger?.get(sharedKey)
+        : undefined;
+      if (shared) {
+        sharedResults?.set(sharedKey!, shared);
+        errors.push(...shared);
+        continue;
+      }
+      const errorsBefore = errors.length;
+
       try {
         // Skip base schema validation for spec files - they're JSON Schemas
         if (type !== 'spec') {
@@ -282,11 +555,10 @@ export class SchemaValidator {
         } else {
           // For spec files, validate they're valid JSON Schemas
           try {
-            const ajv = this.ajv;
             // Check if schema is already compiled
             const schemaId = content.$id || `${namespace}.spec`;
-            if (!ajv.getSchema(schemaId)) {
-              ajv.compile(content);
+            if (!this.getValidateFunction(schemaId)) {
+              this.compileDetached(content);
             }
           } catch (error) {
             errors.push({
@@ -301,6 +573,12 @@ export class SchemaValidator {
           message: `Validation error: ${error instanceof Error ? error.message : 'Unknown error'}`,
         });
       }
+
+      if (sharedKey) {
+        const verdict = errors.slice(errorsBefore);
+        sharedResults?.set(sharedKey, verdict);
+        this.ledger?.set(sharedKey, verdict);
+      }
     }
 
     // Handle self-referential validation (e.g., test.test.json)
@@ -329,28 +607,83 @@ export class SchemaValidator {
   }
 
   /**
-   * Validate all components in spec/
+   * Validate all components in spec/ (or the given subset)
    */
-  public async validateAllComponents(): Promise<{
+  public async validateAllComponents(namespaces?: string[]): Promise<{
     valid: boolean;
     componentResults: Map<string, { valid: boolean; errors: ValidationError[] }>;
   }> {
-    const files = fs.readdirSync(this.specDir);
-    const namespaces = new Set<string>();
-
     // Collect components by looking for index files
-    for (const file of files) {
-      if (file.endsWith('.index.json')) {
-        const namespace = file.replace('.index.json', '');
-        namespaces.add(namespace);
+    const targets = namespaces ?? await this.catalog.listNamespacesAsync();
+    await this.catalog.prefetch(targets);
+
+    const componentResults = new Map<string, { valid: boolean; errors: ValidationError[] }>();
+    const sharedResults = new Map<string, ValidationError[]>();
+    let allValid = true;
+
+    for (const namespace of targets) {
+      // Validation is CPU-bound once files are cached; let other requests in
+      await yieldToEventLoop();
+      const result = await this.validateComponent(namespace, sharedResults);
+      componentResults.set(namespace, result);
+      if (!result.valid) {
+        allValid = false;
       }
     }
 
+    // A run over every component knows which verdicts are still reachable
+    this.saveLedger({ prune: namespaces === undefined });
+
+    return {
+      valid: allValid,
+      componentResults,
+    };
+  }
+
+  /**
+   * Validate all components across a pool of worker threads.
+   * Falls back to validateAllComponents() when the tree is too small to
+   * benefit or the worker script is unavailable (e.g. running from source).
+   */
+  public async validateAllComponentsParallel(options: ValidationPoolOptions = {}): Promise<{
+    valid: boolean;
+    componentResults: Map<string, { valid: boolean; errors: ValidationError[] }>;
+  }> {
+    const namespaces = await this.catalog.listNamespacesAsync();
+    const workerScript = options.workerScript ?? defaultWorkerScript();
+    const workers = poolSize(namespaces.length, options);
+    const haveWorker = await fs.promises.access(workerScript).then(() => true, () => false);
+    if (workers <= 1 || !haveWorker) {
+      return this.validateAllComponents();
+    }
+
+    // Compile every schema once here so workers load them from the cache
+    await this.loadSchemas();
+    for (const schemaId of this.schemaCache.keys()) {
+      try {
+        this.getValidateFunction(schemaId);
+      } catch {
+        // Reported per component by the workers
+      }
+    }
+
+    const groups = groupComponents(this.catalog, namespaces);
+    const results = await runValidationPool(workerScript, workers, {
+      specDir: this.specDir,
+      cacheDir: this.compiledCache?.getCacheDir() ?? null,
+      resolveFrom: this.compiledCache?.getResolveFrom() ?? null,
+      ledgerFile: this.ledger?.getLedgerFile() ?? null,
+    }, groups, verdicts => this.ledger?.merge(verdicts));
+    this.saveLedger({ prune: true });
+
+    // Merge in catalog order so output is independent of scheduling
     const componentResults = new Map<string, { valid: boolean; errors: ValidationError[] }>();
     let allValid = true;
-
     for (const namespace of namespaces) {
-      const result = await this.validateComponent(namespace);
+      const result = results.get(namespace) ?? {
+        valid: false,
+        errors: [{ file: `${namespace}.index.json`, message: 'Component was not validated' }],
+      };
       componentResults.set(namespace, result);
       if (!result.valid) {
         allValid = false;
@@ -362,4 +695,4 @@ export class SchemaValidator {
       componentResults,
     };
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,362 @@
+import * as fs from 'fs';
+import * as path from 'path';
+import { ComponentIndex } from '../types.js';
+import { ContentLayout } from './content-layout.js';
+import { DependencyIndex } from './dependency-index.js';
+import { SpecJournal } from './spec-journal.js';
+import { SpecPack } from './spec-pack.js';
+import { IO_CONCURRENCY, mapConcurrent } from './concurrency.js';
+import { metrics } from './metrics.js';
+
+export interface SpecCatalogOptions {
+  /** Persist the reverse-dependency index here across processes */
+  dependencyIndexFile?: string;
+}
+
+/**
+ * In-memory catalog of a spec/ directory.
+ *
+ * Index files are cached per namespace and artifacts per reference
+ * (`namespace.<sha256>`). Artifacts are content-addressed and never change
+ * once written, so only index entries need invalidating when a component is
+ * created, updated or deleted. Returned objects are shared between callers
+ * and must be treated as read-only. Artifact files are located through the
+ * directory's ContentLayout, so flat and sharded trees read the same, and
+ * are served from the directory's SpecPack first when one has been built.
+ * A pack is not updated when artifacts are removed, so once an artifact is
+ * forgotten its packed copy is never used again and only the loose file
+ * counts; removals by other processes are seen once the pack is rebuilt.
+ *
+ * The Async variants read through fs/promises, the pack included, and fill
+ * the same caches, so operations can load what they need without blocking
+ * the event loop and then use the synchronous getters as cache lookups.
+ */
+export class SpecCatalog {
+  private specDir: string;
+  private layout: ContentLayout;
+  private dependencies: DependencyIndex;
+  private journal: SpecJournal;
+  private pack: SpecPack | null | undefined = undefined;
+  private packOpening: Promise<SpecPack | null> | null = null;
+  private namespaces: Set<string> | null = null;
+  private indexes: Map<string, ComponentIndex> = new Map();
+  private artifacts: Map<string, any> = new Map();
+  // Forgotten artifacts, whose packed copies may be stale
+  private unpacked: Set<string> = new Set();
+  // Bumped on invalidation so reads that started earlier are not cached
+  private epoch: number = 0;
+
+  constructor(
+    specDir: string = path.join(process.cwd(), 'spec'),
+    options: SpecCatalogOptions = {}
+  ) {
+    this.specDir = specDir;
+    this.layout = new ContentLayout(specDir);
+    this.dependencies = new DependencyIndex(this, options.dependencyIndexFile ?? null);
+    this.journal = new SpecJournal(specDir);
+  }
+
+  public getSpecDir(): string {
+    return this.specDir;
+  }
+
+  public getLayout(): ContentLayout {
+    return this.layout;
+  }
+
+  /**
+   * Journal through which all multi-file writes to spec/ are committed
+   */
+  public getJournal(): SpecJournal {
+    return this.journal;
+  }
+
+  /**
+   * Pack of this directory, opened on first use; null if there is none
+   */
+  public getPack(): SpecPack | null {
+    if (this.pack === undefined) {
+      this.pack = SpecPack.open(this.specDir);
+    }
+    return this.pack;
+  }
+
+  /**
+   * getPack() without blocking the event loop
+   */
+  public getPackAsync(): Promise<SpecPack | null> {
+    if (this.pack !== undefined) return Promise.resolve(this.pack);
+    if (!this.packOpening) {
+      const opening: Promise<SpecPack | null> = SpecPack.openAsync(this.specDir).then(pack => {
+        if (this.packOpening !== opening) {
+          // Invalidated while opening
+          pack?.close();
+          return this.getPackAsync();
+        }
+        this.packOpening = null;
+        if (this.pack !== undefined) {
+          // Opened by getPack() meanwhile
+          pack?.close();
+          return this.pack;
+        }
+        this.pack = pack;
+        return pack;
+      });
+      this.packOpening = opening;
+    }
+    return this.packOpening;
+  }
+
+  /**
+   * The pack, if one exists and its copy of an artifact can be trusted
+   */
+  private packFor(artifactRef: string): SpecPack | null {
+    return this.unpacked.has(artifactRef) ? null : this.getPack();
+  }
+
+  /**
+   * packFor() without blocking the event loop
+   */
+  private async packForAsync(artifactRef: string): Promise<SpecPack | null> {
+    return this.unpacked.has(artifactRef) ? null : this.getPackAsync();
+  }
+
+  /**
+   * List component namespaces (one per `*.index.json` file)
+   */
+  public listNamespaces(): string[] {
+    if (!this.namespaces) {
+      this.namespaces = new Set(
+        fs.readdirSync(this.specDir)
+          .filter(f => f.endsWith('.index.json'))
+          .map(f => f.replace('.index.json', ''))
+      );
+    }
+    return [...this.namespaces];
+  }
+
+  /**
+   * listNamespaces() without blocking the event loop
+   */
+  public async listNamespacesAsync(): Promise<string[]> {
+    if (!this.namespaces) {
+      const epoch = this.epoch;
+      const namespaces = new Set(
+        (await fs.promises.readdir(this.specDir))
+          .filter(f => f.endsWith('.index.json'))
+          .map(f => f.replace('.index.json', ''))
+      );
+      if (epoch !== this.epoch || this.namespaces) return [...namespaces];
+      this.namespaces = namespaces;
+    }
+    return [...this.namespaces];
+  }
+
+  /**
+   * Check whether a component index exists
+   */
+  public hasIndex(namespace: string): boolean {
+    if (this.indexes.has(namespace)) return true;
+    if (this.namespaces) return this.namespaces.has(namespace);
+    return fs.existsSync(this.indexPath(namespace));
+  }
+
+  /**
+   * Get a component index, or null if it does not exist.
+   * Throws if the index exists but cannot be parsed; failures are not cached.
+   */
+  public getIndex(namespace: string): ComponentIndex | null {
+    const cached = this.indexes.get(namespace);
+    if (cached) {
+      metrics.catalog.hits++;
+      return cached;
+    }
+    metrics.catalog.misses++;
+
+    const indexPath = this.indexPath(namespace);
+    if (!fs.existsSync(indexPath)) return null;
+
+    const json = fs.readFileSync(indexPath, 'utf-8');
+    metrics.recordRead(json.length);
+    const index: ComponentIndex = JSON.parse(json);
+    this.indexes.set(namespace, index);
+    return index;
+  }
+
+  /**
+   * getIndex() without blocking the event loop
+   */
+  public async getIndexAsync(namespace: string): Promise<ComponentIndex | null> {
+    const cached = this.indexes.get(namespace);
+    if (cached) {
+      metrics.catalog.hits++;
+      return cached;
+    }
+    metrics.catalog.misses++;
+
+    const epoch = this.epoch;
+    let json: string;
+    try {
+      json = await fs.promises.readFile(this.indexPath(namespace), 'utf-8');
+    } catch (error: any) {
+      if (error?.code === 'ENOENT') return null;
+      throw error;
+    }
+
+    metrics.recordRead(json.length);
+    const index: ComponentIndex = JSON.parse(json);
+    if (epoch === this.epoch) {
+      this.indexes.set(namespace, index);
+    }
+    return index;
+  }
+
+  /**
+   * Check whether an artifact file exists
+   */
+  public hasArtifact(artifactRef: string): boolean {
+    return this.artifacts.has(artifactRef)
+      || this.packFor(artifactRef)?.has(artifactRef) === true
+      || this.layout.resolve(`${artifactRef}.json`) !== null;
+  }
+
+  /**
+   * Get parsed artifact content by reference (without .json), or null if missing.
+   * Throws if the artifact exists but cannot be parsed; failures are not cached.
+   */
+  public getArtifact(artifactRef: string): any | null {
+    if (this.artifacts.has(artifactRef)) {
+      metrics.catalog.hits++;
+      return this.artifacts.get(artifactRef);
+    }
+    metrics.catalog.misses++;
+
+    let json = this.packFor(artifactRef)?.read(artifactRef) ?? null;
+    if (json === null) {
+      const artifactPath = this.layout.resolve(`${artifactRef}.json`);
+      if (!artifactPath) return null;
+      json = fs.readFileSync(artifactPath, 'utf-8');
+    }
+
+    metrics.recordRead(json.length);
+    const content = JSON.parse(json);
+    this.artifacts.set(artifactRef, content);
+    return content;
+  }
+
+  /**
+   * getArtifact() without blocking the event loop
+   */
+  public async getArtifactAsync(artifactRef: string): Promise<any | null> {
+    if (this.artifacts.has(artifactRef)) {
+      metrics.catalog.hits++;
+      return this.artifacts.get(artifactRef);
+    }
+    metrics.catalog.misses++;
+
+    const pack = await this.packForAsync(artifactRef);
+    let json = pack ? await pack.readAsync(artifactRef) : null;
+    if (json === null) {
+      json = await this.layout.readFile(`${artifactRef}.json`);
+      if (json === null) return null;
+    }
+
+    metrics.recordRead(json.length);
+    const content = JSON.parse(json);
+    this.artifacts.set(artifactRef, content);
+    return content;
+  }
+
+  /**
+   * Artifact JSON exactly as stored, unparsed, or null if missing. Always
+   * read from the pack or file; the parsed cache cannot reproduce the bytes.
+   */
+  public async getArtifactTextAsync(artifactRef: string): Promise<string | null> {
+    const pack = await this.packForAsync(artifactRef);
+    const json = (pack ? await pack.readAsync(artifactRef) : null)
+      ?? await this.layout.readFile(`${artifactRef}.json`);
+    if (json !== null) metrics.recordRead(json.length);
+    return json;
+  }
+
+  /**
+   * Read the indexes of the given components and every artifact they
+   * reference into the caches, a bounded number of files at a time.
+   * Unreadable files are left for the synchronous getters to report.
+   */
+  public async prefetch(namespaces: string[], concurrency: number = IO_CONCURRENCY): Promise<void> {
+    const indexes = await mapConcurrent(namespaces, concurrency, ns =>
+      this.getIndexAsync(ns).catch(() => null)
+    );
+
+    const refs = new Set<string>();
+    for (const index of indexes) {
+      for (const artifactRef of Object.values(index?.artifacts ?? {})) {
+        if (artifactRef && !this.artifacts.has(artifactRef)) refs.add(artifactRef);
+      }
+    }
+    await mapConcurrent([...refs], concurrency, ref =>
+      this.getArtifactAsync(ref).catch(() => null)
+    );
+  }
+
+  /**
+   * Components that depend on a namespace (via parent, $ref or a
+   * conformance requirement schema)
+   */
+  public getDependents(namespace: string): string[] {
+    return this.dependencies.getDependents(namespace);
+  }
+
+  /**
+   * Drop the cached index for a namespace after it has been written or removed
+   */
+  public invalidateNamespace(namespace: string): void {
+    this.epoch++;
+    this.indexes.delete(namespace);
+    this.dependencies.markStale(namespace);
+    if (this.namespaces) {
+      if (fs.existsSync(this.indexPath(namespace))) {
+        this.namespaces.add(namespace);
+      } else {
+        this.namespaces.delete(namespace);
+      }
+    }
+  }
+
+  /**
+   * Drop a cached artifact after its file has been removed. Its packed copy
+   * is not used from now on either, so a removed artifact reads as missing
+   * rather than being served from a pack built before the removal.
+   */
+  public forgetArtifact(artifactRef: string): void {
+    this.artifacts.delete(artifactRef);
+    this.unpacked.add(artifactRef);
+  }
+
+  /**
+   * Drop everything
+   */
+  public invalidateAll(): void {
+    this.epoch++;
+    this.namespaces = null;
+    this.indexes.clear();
+    this.artifacts.clear();
+    this.dependencies.invalidateAll();
+    // Pick up a rebuilt pack
+    this.pack?.close();
+    this.pack = undefined;
+    this.packOpening = null;
+  }
+
+  public indexPath(namespace: string): string {
+    return path.join(this.specDir, `${namespace}.index.json`);
+  }
+
+  /**
+   * Where an artifact is, or would be written if it does not exist
+   */
+  public artifactPath(artifactRef: string): string {
+    return this.layout.pathFor(`${artifactRef}.json`);
+  }
+}
@@ -0,0 +1,353 @@
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import { metrics } from './metrics.js';
+
+// Journal records live here, inside the directory they describe
+const JOURNAL_DIR = '.journal';
+const TEMP_SUFFIX = '.tmp';
+const RECORD_SUFFIX = '.json';
+const LOCK_SUFFIX = '.lock';
+// `<base36 time>-<pid>-<hex>`, see newTxid()
+const TXID_PATTERN = /^[0-9a-z]+-(\d+)-[0-9a-f]+$/;
+// Poll interval while another writer holds a namespace lock
+const LOCK_RETRY_MS = 5;
+
+// Transactions and locks in flight in this process, telling them apart
+// from leftovers of an earlier process that had the same pid
+const ownTransactions = new Set<string>();
+
+export interface JournalWrite {
+  /** Final path of the file */
+  path: string;
+  data: string;
+}
+
+export interface JournalCommit {
+  /** Files to write, renamed into place in this order (put indexes last) */
+  writes: JournalWrite[];
+  /** Files to remove once every write is in place */
+  removes?: string[];
+}
+
+interface JournalRecord {
+  txid: string;
+  /** Process that wrote the record */
+  pid: number;
+  renames: Array<[string, string]>;
+  removes: string[];
+}
+
+/**
+ * Crash-safe multi-file commits for spec/.
+ *
+ * A commit stages every file as `<path>.<txid>.tmp` and fsyncs them, then
+ * writes and fsyncs one journal record listing the renames. Only then are
+ * the files renamed into place and the record deleted. A crash before the
+ * record exists leaves only temp files, which recovery deletes; a crash
+ * after it leaves a record whose renames recovery completes. Either way no
+ * reader ever sees a torn component, because each index file is replaced
+ * by a single rename after the artifacts it references. Recovery only
+ * touches temp files named `<path>.<txid>.tmp` with a well-formed txid;
+ * any other temp file in spec/ belongs to someone else and is left alone.
+ *
+ * Writers that read an index and commit its successor must hold the
+ * namespace's lock() from the read to the commit, or concurrent updates
+ * lose changes and remove files the other writer's index references.
+ * Locks and journal records carry the pid of their writer, so recovery and
+ * lock breaking only touch those of processes that are gone; spec/ must
+ * therefore not be shared between hosts or pid namespaces.
+ */
+export class SpecJournal {
+  private specDir: string;
+  private journalDir: string;
+
+  constructor(specDir: string) {
+    this.specDir = specDir;
+    this.journalDir = path.join(specDir, JOURNAL_DIR);
+  }
+
+  /**
+   * Take the exclusive commit lock of a namespace, waiting while a live
+   * writer in this or another process holds it. Resolves to its release.
+   */
+  public async lock(namespace: string): Promise<() => Promise<void>> {
+    const lockPath = path.join(this.journalDir, `${namespace}${LOCK_SUFFIX}`);
+    await fs.promises.mkdir(this.journalDir, { recursive: true });
+
+    // Link a complete temp file into place, so a lock is never seen empty.
+    // The txid in it stays owned until release, telling this lock apart
+    // from one left by an earlier process with the same pid.
+    const txid = newTxid();
+    const tempPath = `${lockPath}.${txid}${TEMP_SUFFIX}`;
+    ownTransactions.add(txid);
+    try {
+      await fs.promises.writeFile(tempPath, `${process.pid} ${txid}`);
+      for (;;) {
+        try {
+          await fs.promises.link(tempPath, lockPath);
+          break;
+        } catch (error: any) {
+          if (error?.code !== 'EEXIST') throw error;
+        }
+        const owner = await readLock(lockPath);
+        if (owner !== null && !isOwnerAlive(owner.pid, ownTransactions.has(owner.txid))) {
+          await breakLock(lockPath, owner.content);
+        } else {
+          await new Promise(resolve => setTimeout(resolve, LOCK_RETRY_MS));
+        }
+      }
+    } catch (error) {
+      ownTransactions.delete(txid);
+      throw error;
+    } finally {
+      await fs.promises.rm(tempPath, { force: true });
+    }
+
+    let released = false;
+    return async () => {
+      if (released) return;
+      released = true;
+      await fs.promises.rm(lockPath, { force: true });
+      ownTransactions.delete(txid);
+    };
+  }
+
+  public async commit(commit: JournalCommit): Promise<void> {
+    const txid = newTxid();
+    ownTransactions.add(txid);
+    try {
+      await this.commitAs(txid, commit);
+    } finally {
+      ownTransactions.delete(txid);
+    }
+  }
+
+  private async commitAs(txid: string, commit: JournalCommit): Promise<void> {
+    const renames: Array<[string, string]> = commit.writes.map(write =>
+      [`${write.path}.${txid}${TEMP_SUFFIX}`, write.path]
+    );
+
+    // Stage: write and fsync every temp file
+    try {
+      await Promise.all(commit.writes.map(async (write, i) => {
+        await fs.promises.mkdir(path.dirname(write.path), { recursive: true });
+        await writeDurably(renames[i][0], write.data);
+        metrics.recordWrite(write.data.length);
+      }));
+    } catch (error) {
+      await Promise.all(renames.map(([tempPath]) => fs.promises.rm(tempPath, { force: true })));
+      throw error;
+    }
+
+    // Journal: from here on the commit completes, now or during recovery
+    const record: JournalRecord = { txid, pid: process.pid, renames, removes: commit.removes ?? [] };
+    const recordPath = path.join(this.journalDir, `${txid}${RECORD_SUFFIX}`);
+    await fs.promises.mkdir(this.journalDir, { recursive: true });
+    await writeDurably(recordPath, JSON.stringify(record));
+    await syncDirectory(this.journalDir);
+
+    // Renames in order, so each index lands after the artifacts it references
+    const dirs = new Set<string>();
+    for (const [tempPath, finalPath] of renames) {
+      await fs.promises.rename(tempPath, finalPath);
+      dirs.add(path.dirname(finalPath));
+    }
+    await Promise.all([...dirs].map(syncDirectory));
+    await Promise.all(record.removes.map(removePath => fs.promises.rm(removePath, { force: true })));
+    await fs.promises.rm(recordPath, { force: true });
+  }
+
+  /**
+   * Complete journaled commits and discard unjournaled temp files left by a
+   * crash. Commits whose writer is still running, here or in another
+   * process, are left alone. Run at startup, before spec/ is read and any
+   * request is served, so it is synchronous. Returns the number of commits
+   * completed.
+   */
+  public recover(): number {
+    let replayed = 0;
+    const journaled = new Set<string>();
+
+    if (fs.existsSync(this.journalDir)) {
+      for (const file of fs.readdirSync(this.journalDir)) {
+        if (file.endsWith(TEMP_SUFFIX)) {
+          // Left by a lock() that crashed before linking it into place
+          const txid = stagedTxid(file);
+          if (txid !== null && !isInFlight(txid)) fs.rmSync(path.join(this.journalDir, file), { force: true });
+          continue;
+        }
+        if (!file.endsWith(RECORD_SUFFIX)) continue;
+        // Decided from the name, as a live writer's record may be half written
+        if (isInFlight(file.slice(0, -RECORD_SUFFIX.length))) continue;
+        const recordPath = path.join(this.journalDir, file);
+        let record: JournalRecord;
+        try {
+          record = JSON.parse(fs.readFileSync(recordPath, 'utf-8'));
+        } catch {
+          // Torn record: its temp files are discarded below
+          fs.rmSync(recordPath, { force: true });
+          continue;
+        }
+        record.renames.forEach(([tempPath]) => journaled.add(tempPath));
+        this.apply(record);
+        fs.rmSync(recordPath, { force: true });
+        replayed++;
+      }
+    }
+
+    for (const tempPath of this.findTempFiles(this.specDir)) {
+      const txid = stagedTxid(path.basename(tempPath))!;
+      if (!journaled.has(tempPath) && !isInFlight(txid)) {
+        fs.rmSync(tempPath, { force: true });
+      }
+    }
+    return replayed;
+  }
+
+  /**
+   * Finish a record during recovery; renames already done are skipped
+   */
+  private apply(record: JournalRecord): void {
+    const dirs = new Set<string>();
+    for (const [tempPath, finalPath] of record.renames) {
+      try {
+        fs.renameSync(tempPath, finalPath);
+      } catch (error: any) {
+        // Already renamed by an earlier, interrupted attempt
+        if (!(error?.code === 'ENOENT' && fs.existsSync(finalPath))) throw error;
+      }
+      dirs.add(path.dirname(finalPath));
+    }
+    for (const dir of dirs) {
+      syncDirectorySync(dir);
+    }
+
+    for (const removePath of record.removes) {
+      fs.rmSync(removePath, { force: true });
+    }
+  }
+
+  /**
+   * Temp files staged by a commit, anywhere below dir except the journal
+   */
+  private findTempFiles(dir: string): string[] {
+    const found: string[] = [];
+    for (const entry of fs.readdirSync(dir, { withFileTypes: true })) {
+      const entryPath = path.join(dir, entry.name);
+      if (entry.isDirectory() && entry.name !== JOURNAL_DIR) {
+        found.push(...this.findTempFiles(entryPath));
+      } else if (entry.isFile() && stagedTxid(entry.name) !== null) {
+        found.push(entryPath);
+      }
+    }
+    return found;
+  }
+}
+
+function newTxid(): string {
+  return `${Date.now().toString(36)}-${process.pid}-${crypto.randomBytes(4).toString('hex')}`;
+}
+
+/**
+ * Txid of a temp file named `<path>.<txid>.tmp`, or null if the name is not
+ * of that form and so was not staged by a commit or lock
+ */
+function stagedTxid(fileName: string): string | null {
+  if (!fileName.endsWith(TEMP_SUFFIX)) return null;
+  const txid = path.extname(fileName.slice(0, -TEMP_SUFFIX.length)).slice(1);
+  return TXID_PATTERN.test(txid) ? txid : null;
+}
+
+/**
+ * Whether the writer of a transaction may still be running. Transactions
+ * without a pid in their id are treated as abandoned.
+ */
+function isInFlight(txid: string): boolean {
+  const match = TXID_PATTERN.exec(txid);
+  return match !== null && isOwnerAlive(Number(match[1]), ownTransactions.has(txid));
+}
+
+/**
+ * Whether a process is running. For this process's own pid that depends on
+ * whether it really is the owner, and not an earlier process with that pid.
+ */
+function isOwnerAlive(pid: number, ownedHere: boolean): boolean {
+  if (pid === process.pid) return ownedHere;
+  try {
+    process.kill(pid, 0);
+    return true;
+  } catch (error: any) {
+    // EPERM: alive, but owned by another user
+    return error?.code === 'EPERM';
+  }
+}
+
+async function readLock(lockPath: string): Promise<{ pid: number; txid: string; content: string } | null> {
+  let content: string;
+  try {
+    content = await fs.promises.readFile(lockPath, 'utf-8');
+  } catch (error: any) {
+    if (error?.code === 'ENOENT') return null;
+    throw error;
+  }
+  const [pid, txid = ''] = content.split(' ');
+  return { pid: parseInt(pid, 10), txid, content };
+}
+
+/**
+ * Remove the lock of a dead owner. It is renamed aside first, so a lock
+ * taken meanwhile by a live writer can be recognised and put back.
+ */
+async function breakLock(lockPath: string, deadContent: string): Promise<void> {
+  const asidePath = `${lockPath}.${newTxid()}${TEMP_SUFFIX}`;
+  try {
+    await fs.promises.rename(lockPath, asidePath);
+  } catch (error: any) {
+    if (error?.code === 'ENOENT') return;
+    throw error;
+  }
+  try {
+    if (await fs.promises.readFile(asidePath, 'utf-8') !== deadContent) {
+      await fs.promises.link(asidePath, lockPath).catch(() => undefined);
+    }
+  } finally {
+    await fs.promises.rm(asidePath, { force: true });
+  }
+}
+
+async function writeDurably(filePath: string, data: string): Promise<void> {
+  const handle = await fs.promises.open(filePath, 'w');
+  try {
+    await handle.writeFile(data);
+    await handle.sync();
+  } finally {
+    await handle.close();
+  }
+}
+
+async function syncDirectory(dir: string): Promise<void> {
+  try {
+    const handle = await fs.promises.open(dir, 'r');
+    try {
+      await handle.sync();
+    } finally {
+      await handle.close();
+    }
+  } catch {
+    // Directories cannot be opened for fsync on every platform
+  }
+}
+
+function syncDirectorySync(dir: string): void {
+  try {
+    const fd = fs.openSync(dir, 'r');
+    try {
+      fs.fsyncSync(fd);
+    } finally {
+      fs.closeSync(fd);
+    }
+  } catch {
+    // Directories cannot be opened for fsync on every platform
+  }
+}
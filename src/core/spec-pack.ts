@@ -0,0 +1,317 @@
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import { promisify } from 'util';
+import { ContentLayout } from './content-layout.js';
+
+// Pack file inside the spec/ directory it was built from
+export const PACK_FILE = '.pack';
+
+// Suffix of a pack being built
+const PACK_TEMP_SUFFIX = '.building';
+
+const MAGIC = 'HOLOPACK';
+const PACK_VERSION = 2;
+const HEADER_SIZE = 16;
+// sha256 of the reference (32) + record offset (u64) + record length (u32)
+const ENTRY_SIZE = 44;
+
+const readAt = promisify(fs.read);
+
+interface PackRecord {
+  /** sha256 of ref, the table key */
+  key: Buffer;
+  ref: string;
+  data: Buffer;
+}
+
+/**
+ * Read-only bundle of content-addressed spec artifacts, like a git packfile.
+ *
+ * Layout:
+ *
+ *   "HOLOPACK" | u32 version | u32 count
+ *   count × (sha256(ref)[32] | u64 offset | u32 length), sorted by key
+ *   records: "<ref>\n<artifact JSON>", one per entry
+ *
+ * Opening a pack reads only the header and the table; records are read on
+ * demand with a single positioned read, so a cold start costs one open
+ * instead of one per artifact. openAsync() and readAsync() do the same
+ * through fs/promises, for callers that must not block the event loop. The table is keyed by the hash of the whole
+ * reference, not of the content, so identical content stored under several
+ * namespaces stays apart and has() is answered from the table alone.
+ * An entry's content never changes because artifacts are immutable, but
+ * the loose file it was packed from may since have been removed, by
+ * delete, by update or by gc clean. The pack does not know; until it is
+ * rebuilt, SpecCatalog stops using entries it has seen removed, and gc
+ * reports unreferenced entries and rebuilds the pack when cleaning.
+ * Anything missing from the pack is read from loose files. Index files
+ * are mutable and always stay loose.
+ */
+export class SpecPack {
+  private packPath: string;
+  private fd: number;
+  private table: Buffer;
+  private count: number;
+  // Set when opened by openAsync(); fd is then its descriptor
+  private handle: fs.promises.FileHandle | null;
+
+  private constructor(
+    packPath: string,
+    fd: number,
+    table: Buffer,
+    count: number,
+    handle: fs.promises.FileHandle | null = null
+  ) {
+    this.packPath = packPath;
+    this.fd = fd;
+    this.table = table;
+    this.count = count;
+    this.handle = handle;
+  }
+
+  /**
+   * Open the pack of a spec/ directory, or null if it has none or it is
+   * unreadable
+   */
+  public static open(specDir: string): SpecPack | null {
+    const packPath = path.join(specDir, PACK_FILE);
+    let fd: number;
+    try {
+      fd = fs.openSync(packPath, 'r');
+    } catch {
+      return null;
+    }
+
+    try {
+      const header = Buffer.alloc(HEADER_SIZE);
+      const count = entryCount(header, fs.readSync(fd, header, 0, HEADER_SIZE, 0));
+      const table = Buffer.alloc(count * ENTRY_SIZE);
+      if (fs.readSync(fd, table, 0, table.length, HEADER_SIZE) !== table.length) {
+        throw new Error('truncated table');
+      }
+      return new SpecPack(packPath, fd, table, count);
+    } catch (error) {
+      fs.closeSync(fd);
+      ignoring(packPath, error);
+      return null;
+    }
+  }
+
+  /**
+   * open() without blocking the event loop
+   */
+  public static async openAsync(specDir: string): Promise<SpecPack | null> {
+    const packPath = path.join(specDir, PACK_FILE);
+    let handle: fs.promises.FileHandle;
+    try {
+      handle = await fs.promises.open(packPath, 'r');
+    } catch {
+      return null;
+    }
+
+    try {
+      const header = Buffer.alloc(HEADER_SIZE);
+      const count = entryCount(header, (await handle.read(header, 0, HEADER_SIZE, 0)).bytesRead);
+      const table = Buffer.alloc(count * ENTRY_SIZE);
+      if ((await handle.read(table, 0, table.length, HEADER_SIZE)).bytesRead !== table.length) {
+        throw new Error('truncated table');
+      }
+      return new SpecPack(packPath, handle.fd, table, count, handle);
+    } catch (error) {
+      await handle.close();
+      ignoring(packPath, error);
+      return null;
+    }
+  }
+
+  /**
+   * Pack every loose artifact of a spec/ directory whose hash matches its
+   * content. Returns the number of artifacts packed.
+   */
+  public static build(specDir: string): number {
+    const records: PackRecord[] = [];
+    for (const [filename, filePath] of new ContentLayout(specDir).listFiles()) {
+      const match = /^(.+)\.([0-9a-f]{64})\.json$/.exec(filename);
+      if (!match) continue;
+
+      const data = fs.readFileSync(filePath);
+      const hash = crypto.createHash('sha256').update(data).digest('hex');
+      if (hash !== match[2]) {
+        // Not content-addressed after all; leave it loose
+        continue;
+      }
+      const ref = `${match[1]}.${match[2]}`;
+      records.push({ key: refKey(ref), ref, data });
+    }
+    records.sort((a, b) => Buffer.compare(a.key, b.key));
+
+    const header = Buffer.alloc(HEADER_SIZE);
+    header.write(MAGIC, 0, 'latin1');
+    header.writeUInt32BE(PACK_VERSION, 8);
+    header.writeUInt32BE(records.length, 12);
+
+    const table = Buffer.alloc(records.length * ENTRY_SIZE);
+    const bodies: Buffer[] = [];
+    let offset = HEADER_SIZE + table.length;
+    records.forEach((record, i) => {
+      const body = Buffer.concat([Buffer.from(`${record.ref}\n`), record.data]);
+      const at = i * ENTRY_SIZE;
+      record.key.copy(table, at);
+      table.writeBigUInt64BE(BigInt(offset), at + 32);
+      table.writeUInt32BE(body.length, at + 40);
+      bodies.push(body);
+      offset += body.length;
+    });
+
+    // Replace atomically; open packs keep reading the old file. Not staged
+    // as .tmp, so journal recovery in a starting server never removes it.
+    const packPath = path.join(specDir, PACK_FILE);
+    const tempPath = `${packPath}.${process.pid}${PACK_TEMP_SUFFIX}`;
+    fs.writeFileSync(tempPath, Buffer.concat([header, table, ...bodies]));
+    fs.renameSync(tempPath, packPath);
+    return records.length;
+  }
+
+  public getPath(): string {
+    return this.packPath;
+  }
+
+  public size(): number {
+    return this.count;
+  }
+
+  public has(artifactRef: string): boolean {
+    return this.find(artifactRef) >= 0;
+  }
+
+  /**
+   * Raw JSON of an artifact by reference (without .json), or null if it is
+   * not in the pack
+   */
+  public read(artifactRef: string): string | null {
+    const i = this.find(artifactRef);
+    if (i < 0) return null;
+
+    const { offset, length } = this.location(i);
+    const record = Buffer.alloc(length);
+    return this.decode(artifactRef, record, fs.readSync(this.fd, record, 0, length, offset));
+  }
+
+  /**
+   * read() without blocking the event loop. A pack closed meanwhile reads
+   * as not holding the artifact.
+   */
+  public async readAsync(artifactRef: string): Promise<string | null> {
+    const i = this.find(artifactRef);
+    if (i < 0) return null;
+
+    const { offset, length } = this.location(i);
+    const record = Buffer.alloc(length);
+    let bytesRead: number;
+    try {
+      bytesRead = this.handle
+        ? (await this.handle.read(record, 0, length, offset)).bytesRead
+        : (await readAt(this.fd, record, 0, length, offset)).bytesRead;
+    } catch {
+      return null;
+    }
+    return this.decode(artifactRef, record, bytesRead);
+  }
+
+  /**
+   * Reference and record size of every entry. Reads every record, so it is
+   * meant for maintenance such as gc, not for serving reads.
+   */
+  public entries(): Array<{ ref: string; bytes: number }> {
+    const found: Array<{ ref: string; bytes: number }> = [];
+    for (let i = 0; i < this.count; i++) {
+      const { offset, length } = this.location(i);
+      const record = Buffer.alloc(length);
+      if (fs.readSync(this.fd, record, 0, length, offset) !== length) continue;
+      const newline = record.indexOf(0x0a);
+      if (newline < 0) continue;
+      found.push({ ref: record.toString('utf-8', 0, newline), bytes: length });
+    }
+    return found;
+  }
+
+  /**
+   * Where the record of table entry i is
+   */
+  private location(i: number): { offset: number; length: number } {
+    const at = i * ENTRY_SIZE;
+    return {
+      offset: Number(this.table.readBigUInt64BE(at + 32)),
+      length: this.table.readUInt32BE(at + 40),
+    };
+  }
+
+  /**
+   * Artifact JSON of a record read in full, or null if the read came up
+   * short or the record belongs to another reference
+   */
+  private decode(artifactRef: string, record: Buffer, bytesRead: number): string | null {
+    if (bytesRead !== record.length) return null;
+    const prefix = Buffer.from(`${artifactRef}\n`);
+    if (record.compare(prefix, 0, prefix.length, 0, prefix.length) !== 0) return null;
+    return record.toString('utf-8', prefix.length);
+  }
+
+  /**
+   * Table entry of a reference by binary search, or -1
+   */
+  private find(artifactRef: string): number {
+    const key = refKey(artifactRef);
+    let lo = 0;
+    let hi = this.count;
+    while (lo < hi) {
+      const mid = (lo + hi) >>> 1;
+      const order = this.table.compare(key, 0, 32, mid * ENTRY_SIZE, mid * ENTRY_SIZE + 32);
+      if (order === 0) return mid;
+      if (order < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * Close the pack. One opened by openAsync() closes once reads still in
+   * flight have finished.
+   */
+  public close(): void {
+    if (this.handle) {
+      // Rejects only if already closed
+      void this.handle.close().catch(() => undefined);
+      return;
+    }
+    try {
+      fs.closeSync(this.fd);
+    } catch {
+      // Already closed
+    }
+  }
+}
+
+function refKey(artifactRef: string): Buffer {
+  return crypto.createHash('sha256').update(artifactRef).digest();
+}
+
+/**
+ * Entry count from a pack header of which bytesRead bytes were read
+ */
+function entryCount(header: Buffer, bytesRead: number): number {
+  if (bytesRead !== HEADER_SIZE
+    || header.toString('latin1', 0, 8) !== MAGIC
+    || header.readUInt32BE(8) !== PACK_VERSION) {
+    throw new Error('not a spec pack');
+  }
+  return header.readUInt32BE(12);
+}
+
+function ignoring(packPath: string, error: unknown): void {
+  console.error(`Ignoring spec pack ${packPath}: ${error instanceof Error ? error.message : 'Unknown error'}`);
+}
@@ -0,0 +1,175 @@
+import * as fs from 'fs';
+import * as path from 'path';
+import { SchemaValidator } from './schema-validator.js';
+
+export interface SpecWatcherOptions {
+  /** 'watch' uses fs.watch and falls back to polling if it is unavailable */
+  mode?: 'watch' | 'poll';
+  /** Polling interval in milliseconds (poll mode only) */
+  intervalMs?: number;
+  /** Coalescing window for bursts of events, in milliseconds */
+  debounceMs?: number;
+}
+
+/**
+ * Keeps a long-lived SchemaValidator consistent with changes made to spec/
+ * by other processes (git pulls, gc-clean, a second MCP server).
+ *
+ * Only the files that changed are re-read: an index event re-reads that
+ * index and swaps the component's schema in Ajv only if its spec reference
+ * moved; an artifact event drops that one artifact from the catalog.
+ */
+export class SpecWatcher {
+  private validator: SchemaValidator;
+  private specDir: string;
+  private mode: 'watch' | 'poll';
+  private intervalMs: number;
+  private debounceMs: number;
+  private watcher: fs.FSWatcher | null = null;
+  private pollTimer: NodeJS.Timeout | null = null;
+  private flushTimer: NodeJS.Timeout | null = null;
+  private pending: Set<string> = new Set();
+  private unattributed: boolean = false;
+  private snapshot: Map<string, string> = new Map();
+
+  constructor(validator: SchemaValidator, options: SpecWatcherOptions = {}) {
+    this.validator = validator;
+    this.specDir = validator.getCatalog().getSpecDir();
+    this.mode = options.mode ?? 'watch';
+    this.intervalMs = options.intervalMs ?? 2000;
+    this.debounceMs = options.debounceMs ?? 50;
+  }
+
+  /**
+   * Start watching. Returns the mode actually in use.
+   */
+  public start(): 'watch' | 'poll' {
+    if (this.mode === 'watch') {
+      try {
+        // Sharded trees keep artifacts in subdirectories
+        const recursive = this.validator.getCatalog().getLayout().isSharded();
+        this.watcher = fs.watch(this.specDir, { recursive }, (_event, filename) => {
+          if (filename) {
+            this.enqueue(filename.toString());
+          } else {
+            this.unattributed = true;
+            this.scheduleFlush();
+          }
+        });
+        this.watcher.on('error', () => this.fallBackToPolling());
+        return 'watch';
+      } catch {
+        this.mode = 'poll';
+      }
+    }
+
+    this.startPolling();
+    return 'poll';
+  }
+
+  public close(): void {
+    this.watcher?.close();
+    this.watcher = null;
+    if (this.pollTimer) clearInterval(this.pollTimer);
+    if (this.flushTimer) clearTimeout(this.flushTimer);
+    this.pollTimer = null;
+    this.flushTimer = null;
+  }
+
+  /**
+   * Compare the directory against the last snapshot and apply differences
+   */
+  public poll(): void {
+    const current = this.takeSnapshot();
+    const changed: string[] = [];
+
+    for (const [file, stamp] of current) {
+      if (this.snapshot.get(file) !== stamp) changed.push(file);
+    }
+    for (const file of this.snapshot.keys()) {
+      if (!current.has(file)) changed.push(file);
+    }
+
+    this.snapshot = current;
+    this.applyChanges(changed);
+  }
+
+  /**
+   * Invalidate cached state for the given spec/ filenames (shard
+   * directories are ignored)
+   */
+  public applyChanges(filenames: Iterable<string>): void {
+    for (const entry of filenames) {
+      const file = path.basename(entry);
+      if (!file.endsWith('.json')) continue;
+
+      if (file.endsWith('.index.json')) {
+        this.validator.invalidate(file.replace('.index.json', ''));
+      } else {
+        this.validator.invalidateArtifact(file.replace(/\.json$/, ''));
+      }
+    }
+  }
+
+  private enqueue(filename: string): void {
+    this.pending.add(filename);
+    this.scheduleFlush();
+  }
+
+  private scheduleFlush(): void {
+    if (this.flushTimer) return;
+    this.flushTimer = setTimeout(() => this.flush(), this.debounceMs);
+    this.flushTimer.unref();
+  }
+
+  private flush(): void {
+    this.flushTimer = null;
+    if (this.unattributed) {
+      this.unattributed = false;
+      this.pending.clear();
+      this.validator.invalidateAll();
+      return;
+    }
+
+    const files = [...this.pending];
+    this.pending.clear();
+    this.applyChanges(files);
+  }
+
+  private startPolling(): void {
+    this.snapshot = this.takeSnapshot();
+    this.pollTimer = setInterval(() => {
+      try {
+        this.poll();
+      } catch (error) {
+        console.error('Spec directory poll failed:', error);
+      }
+    }, this.intervalMs);
+    this.pollTimer.unref();
+  }
+
+  private fallBackToPolling(): void {
+    this.watcher?.close();
+    this.watcher = null;
+    this.mode = 'poll';
+    if (!this.pollTimer) {
+      // Changes may have been missed while the watcher failed
+      this.validator.invalidateAll();
+      this.startPolling();
+    }
+  }
+
+  private takeSnapshot(): Map<string, string> {
+    const snapshot = new Map<string, string>();
+    for (const [file, filePath] of this.validator.getCatalog().getLayout().listFiles()) {
+      if (!file.endsWith('.json')) continue;
+      try {
+        const stat = fs.statSync(filePath);
+        snapshot.set(file, `${stat.mtimeMs}:${stat.size}`);
+      } catch {
+        // Removed between readdir and stat; the next poll reports it
+      }
+    }
+    return snapshot;
+  }
+}
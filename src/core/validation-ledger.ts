@@ -0,0 +1,141 @@
+import * as fs from 'fs';
+import * as path from 'path';
+import { ValidationError } from '../types.js';
+
+// Bump whenever SchemaValidator's per-artifact checks change meaning
+const LEDGER_FORMAT = 1;
+
+export interface ValidationLedgerOptions {
+  /** Never write the ledger; verdicts are forwarded with drain() instead */
+  readOnly?: boolean;
+}
+
+/** Verdicts recorded and reused by one ledger instance, see drain() */
+export interface LedgerEntries {
+  added: Array<[string, ValidationError[]]>;
+  reused: string[];
+}
+
+interface LedgerFile {
+  format: number;
+  verdicts: Record<string, ValidationError[]>;
+}
+
+/**
+ * Persistent record of per-artifact validation verdicts.
+ *
+ * Keys are built by SchemaValidator from the hash of the artifact and the
+ * hashes of every schema it is checked against. Because all of these are
+ * content addresses, a key can only match if neither the artifact nor any
+ * schema it depends on has changed, so stored verdicts never go stale; a
+ * changed schema simply produces new keys for all of its dependents.
+ */
+export class ValidationLedger {
+  private ledgerFile: string;
+  private readOnly: boolean;
+  private verdicts: Map<string, ValidationError[]> | null = null;
+  private added: Map<string, ValidationError[]> = new Map();
+  private used: Set<string> = new Set();
+  public readonly stats = { hits: 0, misses: 0 };
+
+  constructor(
+    ledgerFile: string = path.join(process.cwd(), '.artifacts', 'validation-ledger.json'),
+    options: ValidationLedgerOptions = {}
+  ) {
+    this.ledgerFile = ledgerFile;
+    this.readOnly = options.readOnly ?? false;
+  }
+
+  public getLedgerFile(): string {
+    return this.ledgerFile;
+  }
+
+  public get(key: string): ValidationError[] | undefined {
+    const verdict = this.load().get(key);
+    if (verdict) {
+      this.stats.hits++;
+      this.used.add(key);
+    } else {
+      this.stats.misses++;
+    }
+    return verdict;
+  }
+
+  public set(key: string, errors: ValidationError[]): void {
+    this.load().set(key, errors);
+    this.added.set(key, errors);
+    this.used.add(key);
+  }
+
+  /**
+   * Take the verdicts recorded and reused since the last call, for
+   * forwarding from a worker thread to the ledger that will be saved
+   */
+  public drain(): LedgerEntries {
+    const added = [...this.added.entries()];
+    const reused = [...this.used].filter(key => !this.added.has(key));
+    this.added.clear();
+    this.used.clear();
+    return { added, reused };
+  }
+
+  /**
+   * Apply verdicts drained from another ledger instance
+   */
+  public merge(entries: LedgerEntries): void {
+    for (const [key, errors] of entries.added) {
+      this.set(key, errors);
+    }
+    for (const key of entries.reused) {
+      this.used.add(key);
+    }
+  }
+
+  /**
+   * Write the ledger to disk. With prune, verdicts not used since the last
+   * save are dropped; use it after a run that visited every component.
+   */
+  public save(options: { prune?: boolean } = {}): void {
+    if (this.readOnly || !this.verdicts) return;
+    if (this.added.size === 0 && !options.prune) return;
+
+    const verdicts: Record<string, ValidationError[]> = {};
+    for (const [key, errors] of this.verdicts) {
+      if (!options.prune || this.used.has(key)) {
+        verdicts[key] = errors;
+      }
+    }
+
+    const file: LedgerFile = { format: LEDGER_FORMAT, verdicts };
+    try {
+      fs.mkdirSync(path.dirname(this.ledgerFile), { recursive: true });
+      const tempPath = `${this.ledgerFile}.${process.pid}.tmp`;
+      fs.writeFileSync(tempPath, JSON.stringify(file));
+      fs.renameSync(tempPath, this.ledgerFile);
+      this.added.clear();
+      if (options.prune) {
+        this.used.clear();
+      }
+    } catch (error) {
+      // The ledger is an optimisation; never fail validation because of it
+      console.error(`Failed to save validation ledger ${this.ledgerFile}:`, error);
+    }
+  }
+
+  private load(): Map<string, ValidationError[]> {
+    if (this.verdicts) return this.verdicts;
+
+    this.verdicts = new Map();
+    try {
+      const file: LedgerFile = JSON.parse(fs.readFileSync(this.ledgerFile, 'utf-8'));
+      if (file.format === LEDGER_FORMAT && file.verdicts) {
+        for (const [key, errors] of Object.entries(file.verdicts)) {
+          this.verdicts.set(key, errors);
+        }
+      }
+    } catch {
+      // Missing or unreadable ledger: start empty
+    }
+    return this.verdicts;
+  }
+}
@@ -0,0 +1,152 @@
+import * as os from 'os';
+import * as path from 'path';
+import { Worker } from 'worker_threads';
+import { SpecCatalog } from './spec-catalog.js';
+import { ComponentIndex, ValidationError } from '../types.js';
+import { LedgerEntries } from './validation-ledger.js';
+
+export interface ValidationPoolOptions {
+  /** Number of worker threads (default: available cores) */
+  workers?: number;
+  /** Below this many components per worker, extra workers are not started */
+  minComponentsPerWorker?: number;
+  /** Compiled validation-worker.js (default: next to the entry script) */
+  workerScript?: string;
+}
+
+export interface ValidationJob {
+  specDir: string;
+  cacheDir: string | null;
+  resolveFrom: string | null;
+  ledgerFile: string | null;
+}
+
+export type ComponentResult = { valid: boolean; errors: ValidationError[] };
+
+/** Messages sent from the pool to a worker */
+export type PoolMessage = { type: 'group'; namespaces: string[] } | { type: 'done' };
+
+/** Messages sent from a worker to the pool */
+export type WorkerMessage =
+  | { type: 'ready' }
+  | { type: 'results'; results: Array<[string, ComponentResult]>; verdicts: LedgerEntries };
+
+export function defaultWorkerScript(): string {
+  const entry = process.argv[1] ? path.dirname(path.resolve(process.argv[1])) : process.cwd();
+  return path.join(entry, 'core', 'validation-worker.js');
+}
+
+export function poolSize(componentCount: number, options: ValidationPoolOptions = {}): number {
+  const cores = options.workers ?? os.availableParallelism();
+  const minPerWorker = options.minComponentsPerWorker ?? 16;
+  return Math.max(1, Math.min(cores, Math.floor(componentCount / minPerWorker)));
+}
+
+/**
+ * Group components that share artifacts, so each shared conformance file is
+ * validated by a single worker and its result reused within that worker.
+ * Groups are returned largest first for better load balancing.
+ */
+export function groupComponents(catalog: SpecCatalog, namespaces: string[]): string[][] {
+  const parent = new Map<string, string>();
+  const find = (ns: string): string => {
+    let root = ns;
+    while (parent.get(root) !== root) root = parent.get(root)!;
+    // Path compression
+    let node = ns;
+    while (node !== root) {
+      const next = parent.get(node)!;
+      parent.set(node, root);
+      node = next;
+    }
+    return root;
+  };
+
+  const owner = new Map<string, string>();
+  for (const namespace of namespaces) {
+    parent.set(namespace, namespace);
+    let index: ComponentIndex | null;
+    try {
+      index = catalog.getIndex(namespace);
+    } catch {
+      continue;
+    }
+    for (const artifactRef of Object.values(index?.artifacts ?? {})) {
+      if (!artifactRef) continue;
+      const first = owner.get(artifactRef);
+      if (first === undefined) {
+        owner.set(artifactRef, namespace);
+      } else {
+        parent.set(find(namespace), find(first));
+      }
+    }
+  }
+
+  const groups = new Map<string, string[]>();
+  for (const namespace of namespaces) {
+    const root = find(namespace);
+    if (!groups.has(root)) groups.set(root, []);
+    groups.get(root)!.push(namespace);
+  }
+  return [...groups.values()].sort((a, b) => b.length - a.length);
+}
+
+/**
+ * Validate component groups on a pool of worker threads. Workers pull the
+ * next group when they finish one, so uneven groups still balance.
+ */
+export function runValidationPool(
+  workerScript: string,
+  workers: number,
+  job: ValidationJob,
+  groups: string[][],
+  onVerdicts?: (verdicts: LedgerEntries) => void
+): Promise<Map<string, ComponentResult>> {
+  const results = new Map<string, ComponentResult>();
+  const queue = [...groups];
+  const count = Math.min(workers, queue.length);
+
+  return new Promise((resolve, reject) => {
+    let running = count;
+    let failed = false;
+    if (running === 0) {
+      resolve(results);
+      return;
+    }
+
+    const pool: Worker[] = [];
+    for (let i = 0; i < count; i++) {
+      const worker = new Worker(workerScript, { workerData: job });
+      pool.push(worker);
+
+      worker.on('message', (message: WorkerMessage) => {
+        if (message.type === 'results') {
+          for (const [namespace, result] of message.results) {
+            results.set(namespace, result);
+          }
+          onVerdicts?.(message.verdicts);
+        }
+        const next = queue.shift();
+        const reply: PoolMessage = next ? { type: 'group', namespaces: next } : { type: 'done' };
+        worker.postMessage(reply);
+      });
+
+      worker.on('error', error => {
+        if (!failed) {
+          failed = true;
+          for (const other of pool) {
+            void other.terminate();
+          }
+          reject(error);
+        }
+      });
+
+      worker.on('exit', () => {
+        running--;
+        if (running === 0 && !failed) {
+          resolve(results);
+        }
+      });
+    }
+  });
+}
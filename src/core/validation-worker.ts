@@ -0,0 +1,46 @@
+/**
+ * Worker thread for SchemaValidator.validateAllComponentsParallel().
+ * Validates the component groups handed out by the pool with one validator,
+ * loading compiled schemas from the shared on-disk cache and reusing
+ * verdicts from the validation ledger.
+ */
+
+import { parentPort, workerData } from 'worker_threads';
+import { SchemaValidator } from './schema-validator.js';
+import { SpecCatalog } from './spec-catalog.js';
+import { CompiledValidatorCache } from './validator-cache.js';
+import { ValidationLedger } from './validation-ledger.js';
+import { PoolMessage, ValidationJob, WorkerMessage } from './validation-pool.js';
+
+const job = workerData as ValidationJob;
+const compiledCache = job.cacheDir
+  ? new CompiledValidatorCache(job.cacheDir, { resolveFrom: job.resolveFrom ?? undefined })
+  : undefined;
+// Verdicts go back to the pool, which owns writing the ledger
+const ledger = job.ledgerFile ? new ValidationLedger(job.ledgerFile, { readOnly: true }) : undefined;
+const validator = new SchemaValidator(job.specDir, new SpecCatalog(job.specDir), {
+  compiledCache,
+  ledger,
+});
+
+if (parentPort) {
+  const port = parentPort;
+
+  port.on('message', async (message: PoolMessage) => {
+    if (message.type === 'done') {
+      port.close();
+      return;
+    }
+
+    const validation = await validator.validateAllComponents(message.namespaces);
+    const reply: WorkerMessage = {
+      type: 'results',
+      results: [...validation.componentResults.entries()],
+      verdicts: ledger?.drain() ?? { added: [], reused: [] },
+    };
+    port.postMessage(reply);
+  });
+
+  const ready: WorkerMessage = { type: 'ready' };
+  port.postMessage(ready);
+}
@@ -0,0 +1,153 @@
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import { createRequire } from 'module';
+import standaloneCode from 'ajv/dist/standalone/index.js';
+
+// Bump when the layout or contents of cached modules change
+const CACHE_FORMAT = 1;
+
+export interface CompiledValidatorCacheOptions {
+  /**
+   * File to resolve Ajv runtime helpers from. Standalone modules require
+   * `ajv/dist/runtime/*` and `ajv-formats`, so this must sit somewhere
+   * that can see this package's node_modules. Defaults to the entry script.
+   */
+  resolveFrom?: string;
+}
+
+/**
+ * On-disk cache of Ajv standalone-compiled validators.
+ *
+ * Spec artifacts are content-addressed (`namespace.<sha256>.json`), so the
+ * hash in the artifact reference identifies the schema exactly. Modules are
+ * stored as `<sha256>.<options-tag>.cjs`; the tag covers the Ajv version and
+ * compile options, so upgrading Ajv or changing options never loads stale
+ * code. Schemas with external `$ref`s are not cached, since their compiled
+ * code would also depend on the referenced schemas.
+ */
+export class CompiledValidatorCache {
+  private cacheDir: string;
+  private resolveFrom: string;
+  private runtimeRequire: NodeRequire;
+  private tag: string | null = null;
+  public readonly stats = { hits: 0, misses: 0, writes: 0 };
+
+  constructor(
+    cacheDir: string = path.join(process.cwd(), '.artifacts', 'validators'),
+    options: CompiledValidatorCacheOptions = {}
+  ) {
+    this.cacheDir = cacheDir;
+    this.resolveFrom = path.resolve(
+      options.resolveFrom ?? process.argv[1] ?? path.join(process.cwd(), 'index.js')
+    );
+    this.runtimeRequire = createRequire(this.resolveFrom);
+  }
+
+  public getCacheDir(): string {
+    return this.cacheDir;
+  }
+
+  public getResolveFrom(): string {
+    return this.resolveFrom;
+  }
+
+  /**
+   * Whether a schema's compiled code depends only on the schema itself
+   */
+  public isCacheable(schema: any): boolean {
+    return !hasExternalRef(schema);
+  }
+
+  /**
+   * Load a compiled validator for a spec artifact, or null on a miss
+   */
+  public load(artifactRef: string, ajv: any, schema: any): any | null {
+    if (!this.isCacheable(schema)) return null;
+
+    const modulePath = this.modulePath(artifactRef, ajv);
+    if (!fs.existsSync(modulePath)) {
+      this.stats.misses++;
+      return null;
+    }
+
+    try {
+      const source = fs.readFileSync(modulePath, 'utf-8');
+      const loaded = { exports: {} as any };
+      new Function('require', 'module', 'exports', source)(
+        this.runtimeRequire,
+        loaded,
+        loaded.exports
+      );
+      const validate = loaded.exports.default ?? loaded.exports;
+      if (typeof validate !== 'function') {
+        throw new Error('Cached module does not export a validator');
+      }
+      this.stats.hits++;
+      return validate;
+    } catch {
+      // Corrupt or incompatible module: recompile and overwrite
+      this.stats.misses++;
+      return null;
+    }
+  }
+
+  /**
+   * Persist the standalone code of a validator compiled by ajv.
+   * Requires ajv to be constructed with `code: { source: true }`.
+   */
+  public store(artifactRef: string, ajv: any, schema: any, validate: any): void {
+    if (!this.isCacheable(schema)) return;
+
+    try {
+      const source = (standaloneCode as any)(ajv, validate);
+      fs.mkdirSync(this.cacheDir, { recursive: true });
+      const modulePath = this.modulePath(artifactRef, ajv);
+      const tempPath = `${modulePath}.${process.pid}.tmp`;
+      fs.writeFileSync(tempPath, source);
+      fs.renameSync(tempPath, modulePath);
+      this.stats.writes++;
+    } catch (error) {
+      // The cache is an optimisation; never fail validation because of it
+      console.error(`Failed to cache compiled validator for ${artifactRef}:`, error);
+    }
+  }
+
+  private modulePath(artifactRef: string, ajv: any): string {
+    const hash = artifactRef.split('.').pop();
+    return path.join(this.cacheDir, `${hash}.${this.optionsTag(ajv)}.cjs`);
+  }
+
+  private optionsTag(ajv: any): string {
+    if (!this.tag) {
+      let ajvVersion = 'unknown';
+      try {
+        ajvVersion = this.runtimeRequire('ajv/package.json').version;
+      } catch {
+        // Fall back to options only
+      }
+      const compileOptions = { ...ajv.opts };
+      delete compileOptions.code;
+      this.tag = crypto
+        .createHash('sha256')
+        .update(JSON.stringify({ format: CACHE_FORMAT, ajvVersion, compileOptions }))
+        .digest('hex')
+        .substring(0, 12);
+    }
+    return this.tag;
+  }
+}
+
+/** Whether a schema has `$ref`s pointing outside itself */
+export function hasExternalRef(node: any): boolean {
+  if (!node || typeof node !== 'object') return false;
+  if (Array.isArray(node)) return node.some(hasExternalRef);
+
+  for (const [key, value] of Object.entries(node)) {
+    if (key === '$ref' && typeof value === 'string' && !value.startsWith('#')) {
+      return true;
+    }
+    if (hasExternalRef(value)) return true;
+  }
+  return false;
+}
@@ -6,6 +6,7 @@
 // Core exports
 export { SchemaValidator } from './core/schema-validator.js';
 export { ArtifactStore } from './core/artifact-store.js';
+export { SpecCatalog } from './core/spec-catalog.js';
 
 // Operation exports
 export { validateOperation } from './operations/validate.js';
@@ -14,6 +15,8 @@ export { updateOperation } from './operations/update.js';
 export { deleteOperation } from './operations/delete.js';
 export { submitArtifactOperation } from './operations/artifact.js';
 export { submitManifestOperation } from './operations/manifest.js';
+export { submitBatchOperation } from './operations/batch.js';
+export { diagnosticsOperation } from './operations/diagnostics.js';
 export {
   getComponentModelOperation,
   getSchemaOperation,
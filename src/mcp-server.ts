@@ -11,17 +11,58 @@ import { updateOperation } from "./operations/update.js";
 import { deleteOperation } from "./operations/delete.js";
 import { submitArtifactOperation } from "./operations/artifact.js";
 import { submitManifestOperation } from "./operations/manifest.js";
+import { submitBatchOperation, BatchArtifact, BatchManifest } from "./operations/batch.js";
 import {
   getComponentModelOperation,
   getSchemaOperation,
   listComponentsOperation,
   getComponentExampleOperation,
-  listSchemasOperation
+  listSchemasOperation,
+  getDependentsOperation
 } from "./operations/discover.js";
 import {
   validateArtifactOperation,
   explainValidationOperation
 } from "./operations/preview.js";
+import { diagnosticsOperation } from "./operations/diagnostics.js";
+import { ArtifactStore } from "./core/artifact-store.js";
+import { SpecCatalog } from "./core/spec-catalog.js";
+import { SchemaValidator } from "./core/schema-validator.js";
+import { SpecWatcher } from "./core/spec-watcher.js";
+import { CompiledValidatorCache } from "./core/validator-cache.js";
+import { ValidationLedger } from "./core/validation-ledger.js";
+import { metrics, elapsedMs } from "./core/metrics.js";
+import * as path from "path";
+
+// Process-wide validator: every operation resolves spec/ through its catalog,
+// so indexes, artifacts and compiled schemas are loaded once per server.
+// Compiled schemas, validation verdicts and the reverse-dependency index are
+// also persisted under .artifacts/ across restarts.
+const specDir = path.join(process.cwd(), "spec");
+const sharedCatalog = new SpecCatalog(specDir, {
+  dependencyIndexFile: path.join(process.cwd(), ".artifacts", "dependents.json"),
+});
+const sharedValidator = new SchemaValidator(specDir, sharedCatalog, {
+  compiledCache: new CompiledValidatorCache(),
+  ledger: new ValidationLedger(),
+});
+SchemaValidator.setShared(sharedValidator);
+
+// Bound the in-memory artifact cache; HOLOGRAM_ARTIFACT_CACHE_ENTRIES and
+// HOLOGRAM_ARTIFACT_CACHE_BYTES override the defaults
+const cacheEntries = parseInt(process.env.HOLOGRAM_ARTIFACT_CACHE_ENTRIES ?? "", 10);
+const cacheBytes = parseInt(process.env.HOLOGRAM_ARTIFACT_CACHE_BYTES ?? "", 10);
+ArtifactStore.setShared(new ArtifactStore(undefined, {
+  maxEntries: Number.isNaN(cacheEntries) ? undefined : cacheEntries,
+  maxBytes: Number.isNaN(cacheBytes) ? undefined : cacheBytes,
+}));
+
+// Keep the shared catalog in step with changes made by other processes.
+// HOLOGRAM_SPEC_WATCH=poll forces polling, =off disables watching.
+const watchMode = process.env.HOLOGRAM_SPEC_WATCH;
+const specWatcher = watchMode === "off"
+  ? null
+  : new SpecWatcher(sharedValidator, { mode: watchMode === "poll" ? "poll" : "watch" });
 
 const server = new Server(
   {
@@ -88,6 +129,56 @@ server.setRequestHandler(ListToolsRequestSchema, async () => {
           required: ["namespace", "artifacts"],
         },
       },
+      {
+        name: "submitBatch",
+        description: "Submit many artifacts and manifests in one call. Manifests may refer to artifacts in the same batch as \"@key\". Returns a result per item.",
+        inputSchema: {
+          type: "object",
+          properties: {
+            artifacts: {
+              type: "array",
+              description: "Artifacts to validate and store",
+              items: {
+                type: "object",
+                properties: {
+                  key: {
+                    type: "string",
+                    description: "Name for referring to this artifact from manifests as \"@key\"",
+                  },
+                  content: {
+                    type: "object",
+                    description: "The JSON content of the artifact",
+                  },
+                  type: {
+                    type: "string",
+                    enum: ["spec", "conformance"],
+                    description: "Type of artifact",
+                  },
+                },
+                required: ["content", "type"],
+              },
+            },
+            manifests: {
+              type: "array",
+              description: "Components to create, committed in order after all artifacts",
+              items: {
+                type: "object",
+                properties: {
+                  namespace: {
+                    type: "string",
+                    description: "Component namespace",
+                  },
+                  artifacts: {
+                    type: "object",
+                    description: "Map of artifact type to CID or \"@key\"",
+                  },
+                },
+                required: ["namespace", "artifacts"],
+              },
+            },
+          },
+        },
+      },
       {
         name: "validate",
         description: "Validate component(s). Examples: validate() for all, validate({namespace: 'hologram.test'}) for specific component. Shows missing files.",
@@ -115,6 +206,11 @@ server.setRequestHandler(ListToolsRequestSchema, async () => {
               type: "string",
               description: "Specific file to read (omit to read all)",
             },
+            fields: {
+              type: "array",
+              items: { type: "string" },
+              description: "JSON pointers to return instead of whole files, e.g. [\"/interface/interface/methods\"]; relative to the file when one is given",
+            },
           },
           required: ["namespace"],
         },
@@ -186,10 +282,23 @@ server.setRequestHandler(ListToolsRequestSchema, async () => {
       },
       {
         name: "listComponents",
-        description: "List all components and their validation status",
+        description: "List all components and their validation status. Give a prefix, cursor or limit to list one page at a time.",
         inputSchema: {
           type: "object",
-          properties: {},
+          properties: {
+            prefix: {
+              type: "string",
+              description: "Only components at or below this namespace (e.g. 'hologram.interface')",
+            },
+            cursor: {
+              type: "string",
+              description: "Cursor returned by the previous page",
+            },
+            limit: {
+              type: "number",
+              description: "Components per page (default 50, at most 1000)",
+            },
+          },
         },
       },
       {
@@ -251,14 +360,44 @@ server.setRequestHandler(ListToolsRequestSchema, async () => {
           required: ["namespace"],
         },
       },
+      {
+        name: "dependents",
+        description: "List components that depend on a component, directly or transitively - what breaks if it changes",
+        inputSchema: {
+          type: "object",
+          properties: {
+            namespace: {
+              type: "string",
+              description: "Component namespace to check",
+            },
+          },
+          required: ["namespace"],
+        },
+      },
+      {
+        name: "diagnostics",
+        description: "Report per-tool latency histograms, files and bytes read/written, schema compiles and cache hit rates of the running server",
+        inputSchema: {
+          type: "object",
+          properties: {},
+        },
+      },
     ],
   };
 });
 
 // Handle tool execution
 server.setRequestHandler(CallToolRequestSchema, async (request) => {
-  const { name, arguments: args } = request.params;
+  const start = process.hrtime.bigint();
+  const result = await callTool(request.params.name, request.params.arguments);
+  metrics.recordTool(request.params.name, elapsedMs(start), !result.isError);
+  return result;
+});
 
+async function callTool(
+  name: string,
+  args: Record<string, unknown> | undefined
+): Promise<{ content: Array<{ type: string; text: string }>; isError?: boolean }> {
   try {
     switch (name) {
       case "submitArtifact":
@@ -273,13 +412,21 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
           args?.artifacts as Record<string, string>
         );
 
+      case "submitBatch":
+        return await submitBatchOperation(
+          args?.artifacts as BatchArtifact[] | undefined,
+          args?.manifests as BatchManifest[] | undefined
+        );
+
       case "validate":
         return await validateOperation(args?.namespace as string | undefined);
 
       case "read":
         return await readOperation(
           args?.namespace as string,
-          args?.file as string | undefined
+          args?.file as string | undefined,
+          undefined,
+          { fields: args?.fields as string[] | undefined }
         );
 
       case "update":
@@ -298,7 +445,11 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
         return await getSchemaOperation(args?.schemaName as string);
 
       case "listComponents":
-        return await listComponentsOperation();
+        return await listComponentsOperation({
+          prefix: args?.prefix as string | undefined,
+          cursor: args?.cursor as string | undefined,
+          limit: args?.limit as number | undefined,
+        });
 
       case "listSchemas":
         return await listSchemasOperation();
@@ -320,6 +471,12 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
           args?.namespace as string
         );
 
+      case "dependents":
+        return await getDependentsOperation(args?.namespace as string);
+
+      case "diagnostics":
+        return await diagnosticsOperation();
+
       default:
         throw new Error(`Unknown tool: ${name}`);
     }
@@ -331,11 +488,28 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
           text: `Error: ${error instanceof Error ? error.message : "Unknown error"}`,
         },
       ],
+      isError: true,
     };
   }
-});
+}
+
+// HOLOGRAM_METRICS_LOG_INTERVAL=<seconds> logs a metrics line to stderr
+// at that interval
+const metricsInterval = parseInt(process.env.HOLOGRAM_METRICS_LOG_INTERVAL ?? "", 10);
+if (metricsInterval > 0) {
+  setInterval(() => {
+    console.error(JSON.stringify({ type: "metrics", time: new Date().toISOString(), ...metrics.snapshot() }));
+  }, metricsInterval * 1000).unref();
+}
 
 async function run() {
+  // Finish or discard spec/ commits interrupted by a crash before reading it
+  const recovered = sharedCatalog.getJournal().recover();
+  if (recovered > 0) {
+    console.error(`Recovered ${recovered} interrupted spec commit(s)`);
+  }
+  await sharedValidator.loadSchemas();
+  specWatcher?.start();
   const transport = new StdioServerTransport();
   await server.connect(transport);
   console.error("Hologram Component Manager MCP Server running");
@@ -3,15 +3,78 @@ import { SchemaValidator } from '../core/schema-validator.js';
 import { ArtifactStore } from '../core/artifact-store.js';
 import { ValidationError } from '../types.js';
 
-const artifactStore = new ArtifactStore();
+export interface ArtifactSubmission {
+  success: boolean;
+  cid?: string;
+  namespace?: string;
+  errors: ValidationError[];
+}
+
+/**
+ * Validate an artifact and, if it passes, store it under its CID
+ */
+export async function storeValidatedArtifact(
+  content: any,
+  type: 'spec' | 'conformance',
+  validator: SchemaValidator
+): Promise<ArtifactSubmission> {
+  const errors: ValidationError[] = [];
+
+  // Phase 2: Determine schema based on type and namespace
+  const namespace = content.namespace || content.$id?.replace('.spec.json', '');
+
+  // Determine appropriate schema
+  if (type === 'spec') {
+    // Spec files should be valid JSON schemas
+    try {
+      validator.compileDetached(content);
+    } catch (error) {
+      errors.push({
+        file: namespace || 'artifact',
+        message: `Invalid JSON Schema: ${error instanceof Error ? error.message : 'Unknown error'}`,
+      });
+    }
+  } else {
+    // Conformance files validate against base schema
+    const baseValidation = await validator.validateBaseSchema(content);
+    if (!baseValidation.valid) {
+      errors.push(...baseValidation.errors);
+    }
+
+    // Schema validation will check for required fields like namespace
+    // NOTE: Conformance validation against their specs
+    // happens in the manifest phase, not here, because those specs might
+    // only exist in the artifact store and not in the filesystem yet.
+    // This allows for atomic component creation where all artifacts are
+    // submitted first, then validated together during manifest submission.
+  }
+
+  // Phase 3: Verify all $ref and $schema references are valid
+  if (content.$ref || content.$schema) {
+    // Basic reference validation
+    const ref = content.$ref || content.$schema;
+    if (typeof ref !== 'string') {
+      errors.push({
+        file: namespace || 'artifact',
+        message: 'Invalid $ref or $schema reference',
+      });
+    }
+  }
+
+  // Phase 4: If validation passed, generate CID and store
+  if (errors.length > 0) {
+    return { success: false, namespace, errors };
+  }
+  const cid = await ArtifactStore.getShared().storeArtifactAsync(content);
+  return { success: true, cid, namespace, errors };
+}
 
 export async function submitArtifactOperation(
   content: any,
   type: 'spec' | 'conformance',
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
-  const errors: ValidationError[] = [];
+  const validator = SchemaValidator.forSpecDir(specDir);
 
   try {
     // Phase 1: Basic JSON validation
@@ -26,65 +89,17 @@ export async function submitArtifactOperation(
       };
     }
 
-    // Phase 2: Determine schema based on type and namespace
-    let schemaId: string | null = null;
-    const namespace = content.namespace || content.$id?.replace('.spec.json', '');
-
-    // Determine appropriate schema
-    if (type === 'spec') {
-      // Spec files should be valid JSON schemas
-      schemaId = 'http://json-schema.org/draft-07/schema#';
-
-      // Validate it's a proper JSON schema
-      try {
-        const ajv = (validator as any).ajv;
-        ajv.compile(content);
-      } catch (error) {
-        errors.push({
-          file: namespace || 'artifact',
-          message: `Invalid JSON Schema: ${error instanceof Error ? error.message : 'Unknown error'}`,
-        });
-      }
-    } else {
-      // Conformance files validate against base schema
-      const baseValidation = await validator.validateBaseSchema(content);
-      if (!baseValidation.valid) {
-        errors.push(...baseValidation.errors);
-      }
-
-      // Schema validation will check for required fields like namespace
-      // NOTE: Conformance validation against their specs
-      // happens in the manifest phase, not here, because those specs might
-      // only exist in the artifact store and not in the filesystem yet.
-      // This allows for atomic component creation where all artifacts are
-      // submitted first, then validated together during manifest submission.
-    }
-
-    // Phase 3: Verify all $ref and $schema references are valid
-    if (content.$ref || content.$schema) {
-      // Basic reference validation
-      const ref = content.$ref || content.$schema;
-      if (typeof ref !== 'string') {
-        errors.push({
-          file: namespace || 'artifact',
-          message: 'Invalid $ref or $schema reference',
-        });
-      }
-    }
-
-    // Phase 4: If validation passed, generate CID and store
-    if (errors.length === 0) {
-      const cid = artifactStore.storeArtifact(content);
-
+    const submission = await storeValidatedArtifact(content, type, validator);
+    if (submission.success) {
       return {
         content: [
           {
             type: 'text',
             text: JSON.stringify({
               success: true,
-              cid,
+              cid: submission.cid,
               type,
-              namespace,
+              namespace: submission.namespace,
               validated: true,
             }, null, 2),
           },
@@ -93,7 +108,7 @@ export async function submitArtifactOperation(
     } else {
       // Return validation errors
       let errorText = `❌ Artifact validation failed:\n\n`;
-      for (const error of errors) {
+      for (const error of submission.errors) {
         errorText += `- ${error.file}: ${error.message}`;
         if (error.path) {
           errorText += ` (at ${error.path})`;
@@ -120,4 +135,4 @@ export async function submitArtifactOperation(
       ],
     };
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,168 @@
+import * as path from 'path';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { storeValidatedArtifact } from './artifact.js';
+import { submitManifestOperation } from './manifest.js';
+import { ValidationError } from '../types.js';
+
+export interface BatchArtifact {
+  /** Name manifests in the same batch use to refer to this artifact as "@key" */
+  key?: string;
+  content: any;
+  type: 'spec' | 'conformance';
+}
+
+export interface BatchManifest {
+  namespace: string;
+  /** Artifact type → CID, or "@key" of an artifact in this batch */
+  artifacts: Record<string, string>;
+}
+
+interface BatchArtifactResult {
+  index: number;
+  key?: string;
+  success: boolean;
+  cid?: string;
+  namespace?: string;
+  errors?: ValidationError[];
+}
+
+interface BatchManifestResult {
+  namespace: string;
+  success: boolean;
+  message: string;
+}
+
+/**
+ * Submit many artifacts and manifests in one call.
+ *
+ * Artifacts are validated concurrently against the shared validator and
+ * stored; manifests are then committed in the order given, so a component
+ * can depend on one created earlier in the same batch. Every item gets its
+ * own result and a failing item never stops the others.
+ */
+export async function submitBatchOperation(
+  artifacts: BatchArtifact[] = [],
+  manifests: BatchManifest[] = [],
+  specDir: string = path.join(process.cwd(), 'spec')
+): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const validator = SchemaValidator.forSpecDir(specDir);
+
+  try {
+    await validator.loadSchemas();
+
+    // Phase 1: Validate and store all artifacts
+    const artifactResults: BatchArtifactResult[] = await Promise.all(
+      artifacts.map(async (item, index): Promise<BatchArtifactResult> => {
+        if (!item?.content || typeof item.content !== 'object') {
+          return {
+            index,
+            key: item?.key,
+            success: false,
+            errors: [{ file: item?.key ?? `artifact ${index}`, message: 'Invalid JSON content provided' }],
+          };
+        }
+        try {
+          const submission = await storeValidatedArtifact(item.content, item.type, validator);
+          return {
+            index,
+            key: item.key,
+            success: submission.success,
+            cid: submission.cid,
+            namespace: submission.namespace,
+            errors: submission.success ? undefined : submission.errors,
+          };
+        } catch (error) {
+          return {
+            index,
+            key: item.key,
+            success: false,
+            errors: [{
+              file: item.key ?? `artifact ${index}`,
+              message: `Artifact submission error: ${error instanceof Error ? error.message : 'Unknown error'}`,
+            }],
+          };
+        }
+      })
+    );
+
+    const byKey = new Map<string, BatchArtifactResult>();
+    for (const result of artifactResults) {
+      if (result.key) byKey.set(result.key, result);
+    }
+
+    // Phase 2: Commit manifests in order, resolving "@key" references
+    const manifestResults: BatchManifestResult[] = [];
+    for (const manifest of manifests) {
+      const resolved: Record<string, string> = {};
+      const unresolved: string[] = [];
+
+      for (const [type, ref] of Object.entries(manifest.artifacts ?? {})) {
+        if (typeof ref === 'string' && ref.startsWith('@')) {
+          const submitted = byKey.get(ref.substring(1));
+          if (submitted?.success && submitted.cid) {
+            resolved[type] = submitted.cid;
+          } else {
+            unresolved.push(`${type}: ${submitted ? 'artifact failed validation' : 'no artifact with this key'} (${ref})`);
+          }
+        } else {
+          resolved[type] = ref;
+        }
+      }
+
+      if (unresolved.length > 0) {
+        manifestResults.push({
+          namespace: manifest.namespace,
+          success: false,
+          message: `❌ Unresolved artifacts:\n${unresolved.map(u => `  - ${u}`).join('\n')}`,
+        });
+        continue;
+      }
+
+      const result = await submitManifestOperation(manifest.namespace, resolved, specDir);
+      const text = result.content.map(c => c.text).join('\n');
+      manifestResults.push({
+        namespace: manifest.namespace,
+        success: isSuccess(text),
+        message: text,
+      });
+    }
+
+    const failed = artifactResults.filter(r => !r.success).length
+      + manifestResults.filter(r => !r.success).length;
+
+    return {
+      content: [
+        {
+          type: 'text',
+          text: JSON.stringify({
+            success: failed === 0,
+            summary: {
+              artifacts: artifactResults.length,
+              manifests: manifestResults.length,
+              failed,
+            },
+            artifacts: artifactResults,
+            manifests: manifestResults,
+          }, null, 2),
+        },
+      ],
+    };
+  } catch (error) {
+    return {
+      content: [
+        {
+          type: 'text',
+          text: `Batch submission error: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        },
+      ],
+    };
+  }
+}
+
+function isSuccess(text: string): boolean {
+  try {
+    return JSON.parse(text).success === true;
+  } catch {
+    return false;
+  }
+}
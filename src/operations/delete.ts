@@ -1,16 +1,24 @@
 import * as fs from 'fs';
 import * as path from 'path';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { SpecCatalog } from '../core/spec-catalog.js';
 import { DeleteResult, ComponentIndex } from '../types.js';
 
 export async function deleteOperation(
   namespace: string,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const validator = SchemaValidator.forSpecDir(specDir);
+  const catalog = validator.getCatalog();
+  let unlock: (() => Promise<void>) | undefined;
 
   try {
-    // Check if component index exists
+    // Check if component index exists, under the namespace's commit lock so
+    // an update in flight finishes first
     const indexPath = path.join(specDir, `${namespace}.index.json`);
-    if (!fs.existsSync(indexPath)) {
+    unlock = await catalog.getJournal().lock(namespace);
+    catalog.invalidateNamespace(namespace);
+    if (!catalog.hasIndex(namespace)) {
       return {
         content: [
           {
@@ -24,7 +32,11 @@ export async function deleteOperation(
     // Load index to get all component files
     let index: ComponentIndex;
     try {
-      index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
+      const loaded = await catalog.getIndexAsync(namespace);
+      if (!loaded) {
+        throw new Error('Index file disappeared');
+      }
+      index = loaded;
     } catch (e) {
       return {
         content: [
@@ -37,7 +49,7 @@ export async function deleteOperation(
     }
 
     // Check for dependencies
-    const dependencies = await checkDependencies(namespace, specDir);
+    const dependencies = await checkDependencies(namespace, catalog);
     if (dependencies.length > 0) {
       return {
         content: [
@@ -51,23 +63,28 @@ export async function deleteOperation(
 
     // Collect all files to delete from index
     const filesToDelete: string[] = [indexPath];
+    const artifactRefs: string[] = [];
     for (const [type, artifactRef] of Object.entries(index.artifacts)) {
       if (artifactRef) {
-        // Add .json extension to artifact reference to get actual filename
-        const filename = `${artifactRef}.json`;
-        filesToDelete.push(path.join(specDir, filename));
+        filesToDelete.push(catalog.artifactPath(artifactRef));
+        artifactRefs.push(artifactRef);
       }
     }
 
     // Delete all component files
     const deletedFiles: string[] = [];
     for (const filePath of filesToDelete) {
-      const file = path.basename(filePath);
-      if (fs.existsSync(filePath)) {
-        fs.unlinkSync(filePath);
-        deletedFiles.push(file);
+      try {
+        await fs.promises.unlink(filePath);
+        deletedFiles.push(path.basename(filePath));
+      } catch (error: any) {
+        if (error?.code !== 'ENOENT') throw error;
       }
     }
+    for (const artifactRef of artifactRefs) {
+      catalog.forgetArtifact(artifactRef);
+    }
+    validator.invalidate(namespace);
 
     return {
       content: [
@@ -86,67 +103,12 @@ export async function deleteOperation(
         },
       ],
     };
+  } finally {
+    await unlock?.();
   }
 }
 
-async function checkDependencies(namespace: string, specDir: string): Promise<string[]> {
-  const dependencies: string[] = [];
-
-  // Read all index files to find dependencies
-  const files = fs.readdirSync(specDir).filter(f => f.endsWith('.index.json'));
-
-  for (const indexFile of files) {
-    const componentNamespace = indexFile.replace('.index.json', '');
-
-    // Skip the component being deleted
-    if (componentNamespace === namespace) {
-      continue;
-    }
-
-    try {
-      const index: ComponentIndex = JSON.parse(fs.readFileSync(path.join(specDir, indexFile), 'utf-8'));
-
-      // Check each file in this component's index
-      for (const artifactRef of Object.values(index.artifacts)) {
-        if (!artifactRef) continue;
-
-        // Add .json extension to artifact reference to get actual filename
-        const filename = `${artifactRef}.json`;
-        const filePath = path.join(specDir, filename);
-        if (!fs.existsSync(filePath)) continue;
-
-        const content = JSON.parse(fs.readFileSync(filePath, 'utf-8'));
-
-        // Check if this component depends on the one being deleted
-        if (content.parent === namespace) {
-          if (!dependencies.includes(componentNamespace)) {
-            dependencies.push(componentNamespace);
-          }
-        }
-
-        // Check for references in schemas
-        if (content.$ref && content.$ref.includes(namespace)) {
-          if (!dependencies.includes(componentNamespace)) {
-            dependencies.push(componentNamespace);
-          }
-        }
-
-        // Check conformance requirements
-        if (content.component?.conformance_requirements) {
-          for (const [key, req] of Object.entries(content.component.conformance_requirements)) {
-            if (req && typeof req === 'object' && 'schema' in req && (req as any).schema.includes(namespace)) {
-              if (!dependencies.includes(componentNamespace)) {
-                dependencies.push(componentNamespace);
-              }
-            }
-          }
-        }
-      }
-    } catch (error) {
-      // Skip files that can't be parsed
-      continue;
-    }
-  }
-
-  return dependencies;
-}
\ No newline at end of file
+async function checkDependencies(namespace: string, catalog: SpecCatalog): Promise<string[]> {
+  // Maintained incrementally by the catalog as components are written
+  return catalog.getDependents(namespace);
+}
@@ -0,0 +1,32 @@
+import * as path from 'path';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { ArtifactStore } from '../core/artifact-store.js';
+import { metrics } from '../core/metrics.js';
+
+/**
+ * Report the state of the in-process caches, per-tool latencies and I/O
+ * counters as JSON
+ */
+export async function diagnosticsOperation(
+  specDir: string = path.join(process.cwd(), 'spec')
+): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const validator = SchemaValidator.forSpecDir(specDir);
+  const compiledCache = validator.getCompiledCache();
+  const ledger = validator.getLedger();
+
+  const report = {
+    ...metrics.snapshot(),
+    artifactCache: ArtifactStore.getShared().getCacheStats(),
+    compiledValidators: compiledCache ? { ...compiledCache.stats } : null,
+    validationLedger: ledger ? { ...ledger.stats } : null,
+  };
+
+  return {
+    content: [
+      {
+        type: 'text',
+        text: JSON.stringify(report, null, 2),
+      },
+    ],
+  };
+}
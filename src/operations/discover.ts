@@ -1,12 +1,14 @@
 import * as fs from 'fs';
 import * as path from 'path';
 import { SchemaValidator } from '../core/schema-validator.js';
+import { IO_CONCURRENCY, mapConcurrent } from '../core/concurrency.js';
+import { PageRequest, paginate } from '../core/pagination.js';
 
 /**
  * Get the component model - what files are required for a complete component
  */
 export async function getComponentModelOperation(): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(path.join(process.cwd(), 'spec'));
+  const validator = SchemaValidator.forSpecDir(path.join(process.cwd(), 'spec'));
 
   try {
     const componentModel = await validator.getComponentRequirements();
@@ -101,47 +103,47 @@ export async function getSchemaOperation(
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
   try {
     // Handle different schema naming patterns
-    let schemaPath: string | undefined;
+    let schema: any = null;
     let actualFile: string | undefined;
+    const catalog = SchemaValidator.forSpecDir(specDir).getCatalog();
+    const layout = catalog.getLayout();
 
     // First try: exact match with .json
     if (schemaName.endsWith('.json')) {
-      const testPath = path.join(specDir, schemaName);
-      if (fs.existsSync(testPath)) {
-        schemaPath = testPath;
+      const json = await layout.readFile(schemaName);
+      if (json !== null) {
+        schema = JSON.parse(json);
         actualFile = schemaName;
       }
     }
 
     // Second try: add .spec.json
-    if (!schemaPath) {
+    if (!schema) {
       const fileName = `${schemaName}.spec.json`;
-      const testPath = path.join(specDir, fileName);
-      if (fs.existsSync(testPath)) {
-        schemaPath = testPath;
+      const json = await layout.readFile(fileName);
+      if (json !== null) {
+        schema = JSON.parse(json);
         actualFile = fileName;
       }
     }
 
     // Third try: look for index.json to find spec artifact
-    if (!schemaPath && !schemaName.includes('.spec')) {
-      const indexPath = path.join(specDir, `${schemaName}.index.json`);
-      if (fs.existsSync(indexPath)) {
-        const index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
-        if (index.artifacts?.spec) {
-          actualFile = `${index.artifacts.spec}.json`;
-          schemaPath = path.join(specDir, actualFile);
-        }
+    if (!schema && !schemaName.includes('.spec')) {
+      const index = await catalog.getIndexAsync(schemaName);
+      if (index?.artifacts?.spec) {
+        schema = await catalog.getArtifactAsync(index.artifacts.spec);
+        actualFile = `${index.artifacts.spec}.json`;
       }
     }
 
-    if (!schemaPath || !fs.existsSync(schemaPath)) {
+    if (!schema) {
       // List available schemas to help
-      const specFiles = fs.readdirSync(specDir)
+      const entries = await fs.promises.readdir(specDir);
+      const specFiles = entries
         .filter(f => f.endsWith('.spec.json'))
         .map(f => f.replace('.spec.json', ''));
 
-      const indexFiles = fs.readdirSync(specDir)
+      const indexFiles = entries
         .filter(f => f.endsWith('.index.json'))
         .map(f => f.replace('.index.json', ''));
 
@@ -153,8 +155,6 @@ export async function getSchemaOperation(
       };
     }
 
-    const schema = JSON.parse(fs.readFileSync(schemaPath, 'utf-8'));
-
     // Add helpful context
     let response = `SCHEMA: ${actualFile}\n`;
     response += '=' .repeat(50) + '\n\n';
@@ -194,13 +194,21 @@ export async function getSchemaOperation(
 }
 
 /**
- * List all components and their status
+ * List all components and their status. With a prefix, cursor or limit
+ * only one page of the matching components is validated and listed.
  */
-export async function listComponentsOperation(): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(path.join(process.cwd(), 'spec'));
+export async function listComponentsOperation(
+  page: PageRequest = {},
+  specDir: string = path.join(process.cwd(), 'spec')
+): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const validator = SchemaValidator.forSpecDir(specDir);
 
   try {
-    const validation = await validator.validateAllComponents();
+    const paged = page.prefix !== undefined || page.cursor !== undefined || page.limit !== undefined;
+    const selection = paged
+      ? paginate(await validator.getCatalog().listNamespacesAsync(), page)
+      : null;
+    const validation = await validator.validateAllComponents(selection?.items);
 
     let response = 'HOLOGRAM COMPONENTS STATUS\n';
     response += '=' .repeat(50) + '\n\n';
@@ -230,6 +238,12 @@ export async function listComponentsOperation(): Promise<{ content: Array<{ type
     response += `Total: ${components.length} components\n`;
     response += `Valid: ${Array.from(validation.componentResults.values()).filter(r => r.valid).length}\n`;
     response += `Invalid: ${Array.from(validation.componentResults.values()).filter(r => !r.valid).length}\n`;
+    if (selection) {
+      response += `Matching: ${selection.total} components${page.prefix ? ` under ${page.prefix}` : ''}\n`;
+      response += selection.nextCursor
+        ? `Next page: listComponents({cursor: "${selection.nextCursor}"${page.prefix ? `, prefix: "${page.prefix}"` : ''}${page.limit ? `, limit: ${page.limit}` : ''}})\n`
+        : 'Last page\n';
+    }
 
     response += '\nTo create a new component, use getComponentModel() for guidance';
 
@@ -249,6 +263,56 @@ export async function listComponentsOperation(): Promise<{ content: Array<{ type
   }
 }
 
+/**
+ * List the components that would be affected by changing a component:
+ * direct dependents and everything that depends on them in turn
+ */
+export async function getDependentsOperation(
+  namespace: string,
+  specDir: string = path.join(process.cwd(), 'spec')
+): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const catalog = SchemaValidator.forSpecDir(specDir).getCatalog();
+
+  try {
+    if (!catalog.hasIndex(namespace)) {
+      return {
+        content: [{
+          type: 'text',
+          text: `❌ Component ${namespace} not found`
+        }]
+      };
+    }
+
+    const direct = catalog.getDependents(namespace);
+    const seen = new Set<string>([namespace, ...direct]);
+    const queue = [...direct];
+    const transitive: string[] = [];
+    while (queue.length > 0) {
+      for (const dependent of catalog.getDependents(queue.shift()!)) {
+        if (!seen.has(dependent)) {
+          seen.add(dependent);
+          transitive.push(dependent);
+          queue.push(dependent);
+        }
+      }
+    }
+
+    return {
+      content: [{
+        type: 'text',
+        text: JSON.stringify({ namespace, direct, transitive: transitive.sort() }, null, 2)
+      }]
+    };
+  } catch (error) {
+    return {
+      content: [{
+        type: 'text',
+        text: `Error: ${error instanceof Error ? error.message : 'Unknown error'}`
+      }]
+    };
+  }
+}
+
 /**
  * List all available schemas
  */
@@ -258,27 +322,25 @@ export async function listSchemasOperation(
 
   try {
     // Find all spec files
-    const specFiles = fs.readdirSync(specDir)
+    const entries = await fs.promises.readdir(specDir);
+    const specFiles = entries
       .filter(f => f.endsWith('.spec.json'))
       .map(f => f.replace('.spec.json', ''));
 
-    // Find all components with specs via index files
-    const componentsWithSpecs: string[] = [];
-    const indexFiles = fs.readdirSync(specDir)
-      .filter(f => f.endsWith('.index.json'));
-
-    for (const indexFile of indexFiles) {
-      const namespace = indexFile.replace('.index.json', '');
-      const indexPath = path.join(specDir, indexFile);
+    // Find all components with specs via index files, a bounded number at a time
+    const catalog = SchemaValidator.forSpecDir(specDir).getCatalog();
+    const namespaces = entries
+      .filter(f => f.endsWith('.index.json'))
+      .map(f => f.replace('.index.json', ''));
+    const hasSpec = await mapConcurrent(namespaces, IO_CONCURRENCY, async namespace => {
       try {
-        const index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
-        if (index.artifacts?.spec) {
-          componentsWithSpecs.push(namespace);
-        }
+        return Boolean((await catalog.getIndexAsync(namespace))?.artifacts?.spec);
       } catch (e) {
         // Skip invalid index files
+        return false;
       }
-    }
+    });
+    const componentsWithSpecs = namespaces.filter((_, i) => hasSpec[i]);
 
     let response = 'AVAILABLE SCHEMAS\n';
     response += '=' .repeat(50) + '\n\n';
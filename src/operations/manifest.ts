@@ -3,17 +3,17 @@ import * as path from 'path';
 import * as crypto from 'crypto';
 import { SchemaValidator } from '../core/schema-validator.js';
 import { ArtifactStore } from '../core/artifact-store.js';
+import { JournalWrite } from '../core/spec-journal.js';
 import { ValidationError, ComponentIndex } from '../types.js';
 
-const artifactStore = new ArtifactStore();
-
 export async function submitManifestOperation(
   namespace: string,
   artifacts: Record<string, string>,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
+  const validator = SchemaValidator.forSpecDir(specDir);
   const errors: ValidationError[] = [];
+  let unlock: (() => Promise<void>) | undefined;
 
   try {
     // Phase 1: Load hologram.component.json to get requirements
@@ -47,8 +47,12 @@ export async function submitManifestOperation(
       }
     }
 
+    // Hold the namespace's commit lock until the index is written, so two
+    // submissions cannot both find the namespace free
     const indexPath = path.join(specDir, `${namespace}.index.json`);
-    if (fs.existsSync(indexPath)) {
+    unlock = await validator.getCatalog().getJournal().lock(namespace);
+    validator.getCatalog().invalidateNamespace(namespace);
+    if (validator.getCatalog().hasIndex(namespace)) {
       return {
         content: [
           {
@@ -90,7 +94,7 @@ export async function submitManifestOperation(
     const loadedArtifacts: Map<string, any> = new Map();
 
     for (const [type, cid] of Object.entries(artifacts)) {
-      const artifact = artifactStore.getArtifact(cid);
+      const artifact = await ArtifactStore.getShared().getArtifactAsync(cid);
       if (!artifact) {
         errors.push({
           file: type,
@@ -139,12 +143,7 @@ export async function submitManifestOperation(
       } else {
         // For spec files, validate they're valid JSON Schemas
         try {
-          const ajv = (validator as any).ajv;
-          // Check if schema is already compiled (from artifact phase)
-          const schemaId = content.$id || `${namespace}.spec.json`;
-          if (!ajv.getSchema(schemaId)) {
-            ajv.compile(content);
-          }
+          validator.compileDetached(content);
         } catch (error) {
           errors.push({
             file: `${namespace}.spec.json`,
@@ -184,27 +183,19 @@ export async function submitManifestOperation(
       const spec = loadedArtifacts.get('spec');
 
       if (selfConformance && spec) {
-        // Temporarily save spec for validation
-        const specPath = path.join(specDir, `${namespace}.spec.json`);
-        const tempSpecExists = fs.existsSync(specPath);
-
-        if (!tempSpecExists) {
-          fs.writeFileSync(specPath, JSON.stringify(spec, null, 2));
-        }
-
-        // Validate self-referential conformance against the spec this component defines
-        const validation = await validator.validateAgainstSchema(selfConformance, `${namespace}.spec.json`);
+        // Validate self-referential conformance against the spec this component defines.
+        // The spec is not registered yet, so compile it detached from the shared registry.
+        const validation = await validator.validateAgainstDetached(
+          selfConformance,
+          spec,
+          `${namespace}.spec.json`
+        );
         if (!validation.valid) {
           errors.push(...validation.errors.map(e => ({
             ...e,
             file: `${namespace}.${selfConformanceType}.json`,
           })));
         }
-
-        // Clean up temp spec if we created it
-        if (!tempSpecExists) {
-          fs.unlinkSync(specPath);
-        }
       }
     }
 
@@ -213,21 +204,24 @@ export async function submitManifestOperation(
       return formatErrors(namespace, errors);
     }
 
-    // Phase 8: Atomic write - all or nothing with content-addressed filenames
+    // Phase 8: Atomic write - all or nothing with content-addressed filenames,
+    // committed through the journal so a crash never leaves a torn component
     const writtenFiles: string[] = [];
+    const writes: JournalWrite[] = [];
+    const layout = validator.getCatalog().getLayout();
+    const journal = validator.getCatalog().getJournal();
     const index: ComponentIndex = {
       namespace,
       artifacts: {},
     };
 
     try {
-      // Helper to calculate SHA256 and write content-addressed file
+      // Helper to calculate SHA256 and stage a content-addressed file
       const writeContentAddressed = (type: string, content: any): string => {
         const jsonContent = JSON.stringify(content, null, 2);
         const hash = crypto.createHash('sha256').update(jsonContent).digest('hex');
         const filename = `${namespace}.${hash}.json`;
-        const filepath = path.join(specDir, filename);
-        fs.writeFileSync(filepath, jsonContent);
+        writes.push({ path: layout.pathFor(filename), data: jsonContent });
         writtenFiles.push(filename);
         // Return artifact reference without .json extension
         return `${namespace}.${hash}`;
@@ -257,20 +251,17 @@ export async function submitManifestOperation(
       }
 
       // Write the index file last
-      fs.writeFileSync(indexPath, JSON.stringify(index, null, 2));
+      writes.push({ path: indexPath, data: JSON.stringify(index, null, 2) });
+      await journal.commit({ writes });
       writtenFiles.push(`${namespace}.index.json`);
+      validator.invalidate(namespace);
 
       // Final validation of complete component
       const finalValidation = await validator.validateComponent(namespace);
       if (!finalValidation.valid) {
-        // Rollback if final validation fails
-        for (const fileName of writtenFiles) {
-          try {
-            fs.unlinkSync(path.join(specDir, fileName));
-          } catch {
-            // Ignore cleanup errors
-          }
-        }
+        // Rollback if final validation fails: the index goes first
+        await journal.commit({ writes: [], removes: [indexPath, ...writes.slice(0, -1).map(w => w.path)] });
+        validator.invalidate(namespace);
         return formatErrors(namespace, finalValidation.errors);
       }
 
@@ -296,12 +287,10 @@ export async function submitManifestOperation(
 
     } catch (writeError) {
       // Rollback on error
-      for (const fileName of writtenFiles) {
-        const filePath = path.join(specDir, fileName);
-        if (fs.existsSync(filePath)) {
-          fs.unlinkSync(filePath);
-        }
-      }
+      await Promise.all(writtenFiles.map(fileName =>
+        fs.promises.rm(layout.pathFor(fileName), { force: true })
+      ));
+      validator.invalidate(namespace);
       throw writeError;
     }
 
@@ -314,6 +303,8 @@ export async function submitManifestOperation(
         },
       ],
     };
+  } finally {
+    await unlock?.();
   }
 }
 
@@ -11,7 +11,7 @@ export async function validateArtifactOperation(
   namespace?: string,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
+  const validator = SchemaValidator.forSpecDir(specDir);
 
   try {
     // Validate content structure
@@ -141,7 +141,7 @@ export async function explainValidationOperation(
   namespace: string,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
+  const validator = SchemaValidator.forSpecDir(specDir);
 
   try {
     let response = `VALIDATION EXPLANATION FOR: ${namespace}\n`;
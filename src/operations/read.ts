@@ -1,17 +1,28 @@
-import * as fs from 'fs';
 import * as path from 'path';
+import { SchemaValidator } from '../core/schema-validator.js';
+import { projectPointers } from '../core/json-pointer.js';
 import { ReadResult, ComponentFiles, ComponentIndex } from '../types.js';
 
+export interface ReadOptions {
+  /**
+   * JSON pointers to return instead of the whole content, relative to the
+   * file when one is given and to the map of files otherwise
+   * (e.g. "/interface/interface/methods")
+   */
+  fields?: string[];
+}
+
 export async function readOperation(
   namespace: string,
   file?: string,
-  specDir: string = path.join(process.cwd(), 'spec')
+  specDir: string = path.join(process.cwd(), 'spec'),
+  options: ReadOptions = {}
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
+  const catalog = SchemaValidator.forSpecDir(specDir).getCatalog();
 
   try {
     // Load component index
-    const indexPath = path.join(specDir, `${namespace}.index.json`);
-    if (!fs.existsSync(indexPath)) {
+    if (!catalog.hasIndex(namespace)) {
       return {
         content: [
           {
@@ -24,7 +35,11 @@ export async function readOperation(
 
     let index: ComponentIndex;
     try {
-      index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
+      const loaded = await catalog.getIndexAsync(namespace);
+      if (!loaded) {
+        throw new Error('Index file disappeared');
+      }
+      index = loaded;
     } catch (error) {
       return {
         content: [
@@ -58,10 +73,12 @@ export async function readOperation(
         };
       }
 
-      // Add .json extension to artifact reference to get actual filename
-      const filename = `${artifactRef}.json`;
-      const filePath = path.join(specDir, filename);
-      if (!fs.existsSync(filePath)) {
+      // Without fields the file is returned byte for byte, not re-serialized
+      const project = Boolean(options.fields?.length);
+      const content = project
+        ? await catalog.getArtifactAsync(artifactRef)
+        : await catalog.getArtifactTextAsync(artifactRef);
+      if (content === null) {
         return {
           content: [
             {
@@ -72,39 +89,42 @@ export async function readOperation(
         };
       }
 
-      const content = fs.readFileSync(filePath, 'utf-8');
-      return {
-        content: [
-          {
-            type: 'text',
-            text: content,
-          },
-        ],
-      };
+      if (!project) {
+        return {
+          content: [
+            {
+              type: 'text',
+              text: content,
+            },
+          ],
+        };
+      }
+
+      return formatContent(content, options);
     } else {
-      // Read all component files from index
+      // Read all component files from index; with fields, only the files
+      // they point into
       const files: Partial<ComponentFiles> = {};
+      const wanted = options.fields?.length
+        ? new Set(options.fields.map(pointer => topLevelToken(pointer)))
+        : null;
 
       for (const [type, artifactRef] of Object.entries(index.artifacts)) {
         if (!artifactRef) continue;
+        if (wanted && !wanted.has(type) && !wanted.has(null)) continue;
 
         // Add .json extension to artifact reference to get actual filename
         const filename = `${artifactRef}.json`;
-        const filePath = path.join(specDir, filename);
-        if (fs.existsSync(filePath)) {
-          try {
-            const content = JSON.parse(fs.readFileSync(filePath, 'utf-8'));
-            files[type] = content;
-          } catch (error) {
-            // Include parse errors in response
-            files[type] = {
-              error: `Failed to parse ${filename}: ${error instanceof Error ? error.message : 'Unknown error'}`
-            };
-          }
-        } else {
-          files[type] = {
+        try {
+          const content = await catalog.getArtifactAsync(artifactRef);
+          files[type] = content ?? {
             error: `Artifact not found: ${artifactRef}`
           };
+        } catch (error) {
+          // Include parse errors in response
+          files[type] = {
+            error: `Failed to parse ${filename}: ${error instanceof Error ? error.message : 'Unknown error'}`
+          };
         }
       }
 
@@ -114,15 +134,8 @@ export async function readOperation(
         files,
       };
 
-      if (result.success) {
-        return {
-          content: [
-            {
-              type: 'text',
-              text: JSON.stringify(files, null, 2),
-            },
-          ],
-        };
+      if (result.success || wanted) {
+        return formatContent(files, options);
       } else {
         return {
           content: [
@@ -144,4 +157,37 @@ export async function readOperation(
       ],
     };
   }
-}
\ No newline at end of file
+}
+
+function formatContent(content: any, options: ReadOptions) {
+  if (!options.fields?.length) {
+    return {
+      content: [
+        {
+          type: 'text',
+          text: JSON.stringify(content, null, 2),
+        },
+      ],
+    };
+  }
+
+  const { fields, missing } = projectPointers(content, options.fields);
+  return {
+    content: [
+      {
+        type: 'text',
+        text: JSON.stringify(missing.length > 0 ? { fields, missing } : { fields }, null, 2),
+      },
+    ],
+  };
+}
+
+/**
+ * First token of a pointer into the map of files, or null for the whole map
+ */
+function topLevelToken(pointer: string): string | null {
+  if (!pointer.startsWith('/')) return null;
+  const end = pointer.indexOf('/', 1);
+  const token = end === -1 ? pointer.substring(1) : pointer.substring(1, end);
+  return token.replace(/~1/g, '/').replace(/~0/g, '~');
+}
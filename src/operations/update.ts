@@ -2,6 +2,7 @@ import * as fs from 'fs';
 import * as path from 'path';
 import * as crypto from 'crypto';
 import { SchemaValidator } from '../core/schema-validator.js';
+import { JournalWrite } from '../core/spec-journal.js';
 import { ComponentIndex, ValidationError } from '../types.js';
 
 export async function updateOperation(
@@ -9,8 +10,9 @@ export async function updateOperation(
   files: Partial<any>,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
+  const validator = SchemaValidator.forSpecDir(specDir);
   const errors: ValidationError[] = [];
+  let unlock: (() => Promise<void>) | undefined;
 
   try {
     // Load component model to get conformance requirements
@@ -29,8 +31,15 @@ export async function updateOperation(
 
     // Now proceed with the rest
     // Check that component exists via index
+    const catalog = validator.getCatalog();
+    const layout = catalog.getLayout();
     const indexPath = path.join(specDir, `${namespace}.index.json`);
-    if (!fs.existsSync(indexPath)) {
+
+    // Hold the namespace's commit lock from reading the index to committing
+    // its successor, and re-read the index in case another process changed it
+    unlock = await catalog.getJournal().lock(namespace);
+    catalog.invalidateNamespace(namespace);
+    if (!catalog.hasIndex(namespace)) {
       return {
         content: [
           {
@@ -42,7 +51,10 @@ export async function updateOperation(
     }
 
     // Load current index
-    const index: ComponentIndex = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
+    const index = await catalog.getIndexAsync(namespace);
+    if (!index) {
+      throw new Error(`Index for ${namespace} disappeared`);
+    }
 
     // Backup current artifacts
     const backupArtifacts = new Map<string, string>();
@@ -51,9 +63,9 @@ export async function updateOperation(
     for (const [type, artifactRef] of Object.entries(index.artifacts)) {
       if (artifactRef) {
         const filename = `${artifactRef}.json`;
-        const filePath = path.join(specDir, filename);
-        if (fs.existsSync(filePath)) {
-          backupArtifacts.set(type, fs.readFileSync(filePath, 'utf-8'));
+        const backup = await layout.readFile(filename);
+        if (backup !== null) {
+          backupArtifacts.set(type, backup);
           backupFilenames.set(type, filename);
         }
       }
@@ -153,8 +165,11 @@ export async function updateOperation(
       return formatErrors(namespace, errors);
     }
 
-    // Phase 2: Write new content-addressed files
+    // Phase 2: Write new content-addressed files, committed through the
+    // journal together with the new index
     const writtenFiles: string[] = [];
+    const writes: JournalWrite[] = [];
+    const journal = catalog.getJournal();
     const newIndex: ComponentIndex = {
       namespace,
       artifacts: { ...index.artifacts }, // Start with existing artifacts
@@ -166,10 +181,9 @@ export async function updateOperation(
         const jsonContent = JSON.stringify(content, null, 2);
         const hash = crypto.createHash('sha256').update(jsonContent).digest('hex');
         const newFilename = `${namespace}.${hash}.json`;
-        const newFilePath = path.join(specDir, newFilename);
 
-        // Write new content-addressed file
-        fs.writeFileSync(newFilePath, jsonContent);
+        // Stage new content-addressed file
+        writes.push({ path: layout.pathFor(newFilename), data: jsonContent });
         writtenFiles.push(newFilename);
 
         // Update index with new artifact reference (without .json)
@@ -178,33 +192,38 @@ export async function updateOperation(
 
       // Phase 3: Validate complete component after updates
       // Temporarily write the new index for validation
-      const tempIndexBackup = fs.readFileSync(indexPath, 'utf-8');
-      fs.writeFileSync(indexPath, JSON.stringify(newIndex, null, 2));
+      const tempIndexBackup = await fs.promises.readFile(indexPath, 'utf-8');
+      writes.push({ path: indexPath, data: JSON.stringify(newIndex, null, 2) });
+      await journal.commit({ writes });
+      validator.invalidate(namespace);
 
       const componentValidation = await validator.validateComponent(namespace);
       if (!componentValidation.valid) {
         // Restore index and cleanup new files
-        fs.writeFileSync(indexPath, tempIndexBackup);
-        for (const filename of writtenFiles) {
-          try {
-            fs.unlinkSync(path.join(specDir, filename));
-          } catch {
-            // Ignore cleanup errors
-          }
-        }
+        await journal.commit({
+          writes: [{ path: indexPath, data: tempIndexBackup }],
+          removes: writtenFiles.map(filename => layout.pathFor(filename)),
+        });
+        validator.invalidate(namespace);
         return formatErrors(namespace, componentValidation.errors);
       }
 
       // Phase 4: Cleanup old artifact files that were replaced
+      const replaced: string[] = [];
       for (const [type, oldFilename] of backupFilenames) {
         if (updates.has(type) && newIndex.artifacts[type] !== index.artifacts[type]) {
-          try {
-            fs.unlinkSync(path.join(specDir, oldFilename));
-          } catch {
-            // Ignore cleanup errors for old files
-          }
+          replaced.push(layout.pathFor(oldFilename));
+          catalog.forgetArtifact(index.artifacts[type]!);
         }
       }
+      try {
+        await journal.commit({
+          writes: [],
+          removes: replaced,
+        });
+      } catch {
+        // Ignore cleanup errors for old files
+      }
 
       return {
         content: [
@@ -216,17 +235,16 @@ export async function updateOperation(
       };
 
     } catch (writeError) {
-      // Rollback: restore old files and index
-      fs.writeFileSync(indexPath, JSON.stringify(index, null, 2));
-
-      // Delete any new files we created
-      for (const filename of writtenFiles) {
-        try {
-          fs.unlinkSync(path.join(specDir, filename));
-        } catch {
-          // Ignore cleanup errors
-        }
+      // Rollback: restore the old index and delete any new files we created
+      try {
+        await journal.commit({
+          writes: [{ path: indexPath, data: JSON.stringify(index, null, 2) }],
+          removes: writtenFiles.map(filename => layout.pathFor(filename)),
+        });
+      } catch {
+        // Ignore cleanup errors
       }
+      validator.invalidate(namespace);
 
       throw writeError;
     }
@@ -239,6 +257,8 @@ export async function updateOperation(
         },
       ],
     };
+  } finally {
+    await unlock?.();
   }
 }
 
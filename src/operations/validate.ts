@@ -6,7 +6,7 @@ export async function validateOperation(
   namespace?: string,
   specDir: string = path.join(process.cwd(), 'spec')
 ): Promise<{ content: Array<{ type: string; text: string }> }> {
-  const validator = new SchemaValidator(specDir);
+  const validator = SchemaValidator.forSpecDir(specDir);
 
   try {
     let result: ValidationResult;
@@ -14,14 +14,15 @@ export async function validateOperation(
     if (namespace) {
       // Validate single component
       const validation = await validator.validateComponent(namespace);
+      validator.saveLedger();
       result = {
         success: validation.valid,
         namespace,
         errors: validation.errors,
       };
     } else {
-      // Validate all components
-      const validation = await validator.validateAllComponents();
+      // Validate all components, fanned out across worker threads for large trees
+      const validation = await validator.validateAllComponentsParallel();
       const errors: any[] = [];
       const componentSummary: string[] = [];
 
@@ -95,8 +96,7 @@ export async function validateOperation(
       }
 
       // Check for model evolution issues
-      const validator2 = new SchemaValidator(specDir);
-      const componentModel = await validator2.getComponentRequirements();
+      const componentModel = await validator.getComponentRequirements();
       if (componentModel) {
         errorText += '\n\nRequired conformance (from hologram.component.json):\n';
         for (const [key, req] of Object.entries(componentModel.conformance_requirements || {})) {
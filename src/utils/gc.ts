@@ -1,21 +1,30 @@
 #!/usr/bin/env node
 /**
  * Garbage Collection for Hologram spec/ directory
- * Identifies and optionally removes orphaned content-addressed files
+ * Identifies and optionally removes orphaned content-addressed files.
+ * Marks every artifact referenced by an index, then sweeps the rest; state
+ * persisted between runs avoids re-reading and re-hashing unchanged files.
  */
 
 import * as fs from 'fs';
 import * as path from 'path';
 import * as crypto from 'crypto';
 import { fileURLToPath } from 'url';
+import { ContentLayout } from '../core/content-layout.js';
+import { SpecPack, PACK_FILE } from '../core/spec-pack.js';
 
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
 
+// Bump when the layout of the persisted GC state changes
+const STATE_FORMAT = 2;
+
 interface GCOptions {
   specDir?: string;
   clean?: boolean;
   verbose?: boolean;
+  /** Persisted GC state; null disables it (default: .artifacts/gc-state.json beside spec/) */
+  stateFile?: string | null;
 }
 
 interface GCResult {
@@ -25,76 +34,199 @@ interface GCResult {
   referencedFiles: number;
   orphanedFiles: string[];
   duplicates: Map<string, string[]>;
+  /** Bytes held by orphaned files, per namespace */
+  reclaimable: Map<string, { files: number; bytes: number }>;
+  reclaimableBytes: number;
+  /** Size of spec/.pack, 0 without one */
+  packBytes: number;
+  /** Packed artifacts no index references, served until the pack is rebuilt */
+  packedOrphans: string[];
+  /** Pack bytes held by packedOrphans */
+  packReclaimableBytes: number;
+}
+
+/**
+ * State carried between runs. Index files are re-read and content files
+ * re-hashed only when their mtime or size differs from the recorded stamp,
+ * so a run over an unchanged tree costs one stat per file.
+ */
+interface GCState {
+  format: number;
+  specDir: string;
+  /** Artifact references of each component, by index filename */
+  components: Record<string, { stamp: string; artifacts: Record<string, string> }>;
+  /** sha256 of each content file */
+  files: Record<string, { stamp: string; sha256: string }>;
+  /** References and record sizes in spec/.pack */
+  pack?: { stamp: string; entries: Array<{ ref: string; bytes: number }> };
+}
+
+function defaultStateFile(specDir: string): string {
+  return path.join(specDir, '..', '.artifacts', 'gc-state.json');
+}
+
+function loadState(stateFile: string | null, specDir: string): GCState {
+  const empty: GCState = { format: STATE_FORMAT, specDir, components: {}, files: {} };
+  if (!stateFile) return empty;
+  try {
+    const state: GCState = JSON.parse(fs.readFileSync(stateFile, 'utf-8'));
+    return state.format === STATE_FORMAT && state.specDir === specDir ? state : empty;
+  } catch {
+    return empty;
+  }
+}
+
+function saveState(stateFile: string | null, state: GCState): void {
+  if (!stateFile) return;
+  try {
+    fs.mkdirSync(path.dirname(stateFile), { recursive: true });
+    const tempPath = `${stateFile}.${process.pid}.tmp`;
+    fs.writeFileSync(tempPath, JSON.stringify(state));
+    fs.renameSync(tempPath, stateFile);
+  } catch (e) {
+    console.error(`Failed to save GC state ${stateFile}: ${e instanceof Error ? e.message : 'Unknown error'}`);
+  }
 }
 
 export function analyzeSpec(options: GCOptions = {}): GCResult {
-  const specDir = options.specDir || path.join(__dirname, '..', '..', '..', 'spec');
+  const specDir = path.resolve(options.specDir || path.join(__dirname, '..', '..', '..', 'spec'));
   const verbose = options.verbose ?? false;
+  const stateFile = options.stateFile === undefined ? defaultStateFile(specDir) : options.stateFile;
+  const previous = loadState(stateFile, specDir);
+  const state: GCState = { format: STATE_FORMAT, specDir, components: {}, files: {} };
 
-  // Get all files in spec directory
-  const allFiles = fs.readdirSync(specDir).filter(f => f.endsWith('.json'));
+  // Get all files in spec directory, flat or sharded, with their stamps
+  const filePaths = new ContentLayout(specDir).listFiles();
+  const allFiles = [...filePaths.keys()].filter(f => f.endsWith('.json'));
+  const stats = new Map<string, fs.Stats>();
+  for (const file of allFiles) {
+    try {
+      stats.set(file, fs.statSync(filePaths.get(file)!));
+    } catch {
+      // Removed since listing
+    }
+  }
+  const stampOf = (file: string): string => {
+    const stat = stats.get(file);
+    return stat ? `${stat.mtimeMs}:${stat.size}` : '';
+  };
 
   // Separate index files and content files
   const indexFiles = allFiles.filter(f => f.endsWith('.index.json'));
   const contentFiles = allFiles.filter(f => !f.endsWith('.index.json'));
 
-  // Collect all referenced hashes from index files
+  // Mark: collect all referenced hashes from index files
   const referencedHashes = new Set<string>();
   const componentMap = new Map<string, string>();
 
   for (const indexFile of indexFiles) {
-    const indexPath = path.join(specDir, indexFile);
+    const indexPath = filePaths.get(indexFile)!;
     const namespace = indexFile.replace('.index.json', '');
+    const stamp = stampOf(indexFile);
 
-    try {
-      const index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
-      if (index.artifacts) {
-        for (const [type, artifactRef] of Object.entries(index.artifacts)) {
+    let artifacts: Record<string, string> = {};
+    const cached = previous.components[indexFile];
+    if (cached && cached.stamp === stamp) {
+      artifacts = cached.artifacts;
+    } else {
+      try {
+        const index = JSON.parse(fs.readFileSync(indexPath, 'utf-8'));
+        for (const [type, artifactRef] of Object.entries(index.artifacts ?? {})) {
           if (artifactRef && typeof artifactRef === 'string') {
-            // Extract hash from artifact reference
-            const hash = artifactRef.split('.').pop();
-            if (hash) {
-              referencedHashes.add(hash);
-              componentMap.set(hash, `${namespace}.${type}`);
-            }
+            artifacts[type] = artifactRef;
           }
         }
+      } catch (e) {
+        if (verbose) {
+          console.error(`Error reading ${indexFile}: ${e instanceof Error ? e.message : 'Unknown error'}`);
+        }
+        continue;
       }
-    } catch (e) {
-      if (verbose) {
-        console.error(`Error reading ${indexFile}: ${e instanceof Error ? e.message : 'Unknown error'}`);
+    }
+    state.components[indexFile] = { stamp, artifacts };
+
+    for (const [type, artifactRef] of Object.entries(artifacts)) {
+      // Extract hash from artifact reference
+      const hash = artifactRef.split('.').pop();
+      if (hash) {
+        referencedHashes.add(hash);
+        componentMap.set(hash, `${namespace}.${type}`);
       }
     }
   }
 
-  // Check for orphaned files
+  // Sweep: unreferenced content files, and the bytes they hold per namespace
   const orphanedFiles: string[] = [];
+  const reclaimable = new Map<string, { files: number; bytes: number }>();
+  let reclaimableBytes = 0;
   for (const contentFile of contentFiles) {
     // Extract hash from filename
-    const hash = contentFile.replace('.json', '').split('.').pop();
+    const stem = contentFile.replace('.json', '');
+    const hash = stem.split('.').pop();
     if (hash && !referencedHashes.has(hash)) {
       orphanedFiles.push(contentFile);
+      const namespace = stem.substring(0, stem.length - hash.length - 1) || stem;
+      const bytes = stats.get(contentFile)?.size ?? 0;
+      const entry = reclaimable.get(namespace) ?? { files: 0, bytes: 0 };
+      entry.files++;
+      entry.bytes += bytes;
+      reclaimable.set(namespace, entry);
+      reclaimableBytes += bytes;
+    }
+  }
+
+  // Packed copies: a pack is not updated by removals, so it may still hold
+  // artifacts no index references. Its entries are re-read only when it
+  // changes.
+  const packedOrphans: string[] = [];
+  let packBytes = 0;
+  let packReclaimableBytes = 0;
+  const pack = SpecPack.open(specDir);
+  if (pack) {
+    try {
+      const stat = fs.statSync(pack.getPath());
+      const stamp = `${stat.mtimeMs}:${stat.size}`;
+      const entries = previous.pack?.stamp === stamp ? previous.pack.entries : pack.entries();
+      state.pack = { stamp, entries };
+      packBytes = stat.size;
+      for (const { ref, bytes } of entries) {
+        const hash = ref.split('.').pop();
+        if (hash && !referencedHashes.has(hash)) {
+          packedOrphans.push(ref);
+          packReclaimableBytes += bytes;
+        }
+      }
+    } finally {
+      pack.close();
     }
   }
 
-  // Check for duplicate content
+  // Check for duplicate content, hashing each file at most once per change
   const contentHashes = new Map<string, string[]>();
   for (const contentFile of contentFiles) {
-    const filePath = path.join(specDir, contentFile);
+    const filePath = filePaths.get(contentFile)!;
     const hash = contentFile.replace('.json', '').split('.').pop();
 
     if (hash && referencedHashes.has(hash)) {
-      try {
-        const content = fs.readFileSync(filePath, 'utf-8');
-        const contentHash = crypto.createHash('sha256').update(content).digest('hex');
-
-        if (!contentHashes.has(contentHash)) {
-          contentHashes.set(contentHash, []);
+      const stamp = stampOf(contentFile);
+      let contentHash = previous.files[contentFile]?.stamp === stamp
+        ? previous.files[contentFile].sha256
+        : null;
+      if (!contentHash) {
+        try {
+          const content = fs.readFileSync(filePath, 'utf-8');
+          contentHash = crypto.createHash('sha256').update(content).digest('hex');
+        } catch (e) {
+          // Ignore read errors
+          continue;
         }
-        contentHashes.get(contentHash)!.push(contentFile);
-      } catch (e) {
-        // Ignore read errors
       }
+      state.files[contentFile] = { stamp, sha256: contentHash };
+
+      if (!contentHashes.has(contentHash)) {
+        contentHashes.set(contentHash, []);
+      }
+      contentHashes.get(contentHash)!.push(contentFile);
     }
   }
 
@@ -106,24 +238,40 @@ export function analyzeSpec(options: GCOptions = {}): GCResult {
     }
   }
 
+  saveState(stateFile, state);
+
   return {
     totalFiles: allFiles.length,
     indexFiles: indexFiles.length,
     contentFiles: contentFiles.length,
     referencedFiles: referencedHashes.size,
     orphanedFiles,
-    duplicates
+    duplicates,
+    reclaimable,
+    reclaimableBytes,
+    packBytes,
+    packedOrphans,
+    packReclaimableBytes,
   };
 }
 
-export function cleanOrphans(options: GCOptions = {}): { deleted: string[]; failed: string[] } {
+/**
+ * Delete orphaned files, then rebuild the pack if it holds orphans, so
+ * they are no longer served. `pack` is the pack size before and after.
+ */
+export function cleanOrphans(options: GCOptions = {}): {
+  deleted: string[];
+  failed: string[];
+  pack: { before: number; after: number } | null;
+} {
   const specDir = options.specDir || path.join(__dirname, '..', '..', '..', 'spec');
   const result = analyzeSpec(options);
+  const layout = new ContentLayout(specDir);
   const deleted: string[] = [];
   const failed: string[] = [];
 
   for (const file of result.orphanedFiles) {
-    const filePath = path.join(specDir, file);
+    const filePath = layout.pathFor(file);
     try {
       fs.unlinkSync(filePath);
       deleted.push(file);
@@ -132,7 +280,13 @@ export function cleanOrphans(options: GCOptions = {}): { deleted: string[]; fail
     }
   }
 
-  return { deleted, failed };
+  let pack: { before: number; after: number } | null = null;
+  if (result.packedOrphans.length > 0) {
+    SpecPack.build(specDir);
+    pack = { before: result.packBytes, after: fs.statSync(path.join(specDir, PACK_FILE)).size };
+  }
+
+  return { deleted, failed, pack };
 }
 
 // CLI interface
@@ -152,10 +306,23 @@ if (import.meta.url === `file://${process.argv[1]}`) {
   console.log(`   Referenced files: ${result.referencedFiles}`);
   console.log(`   Orphaned files: ${result.orphanedFiles.length}\n`);
 
-  if (result.orphanedFiles.length > 0) {
-    console.log('🗑️  Orphaned files (not referenced by any index):');
-    for (const file of result.orphanedFiles) {
-      console.log(`   - ${file}`);
+  if (result.orphanedFiles.length > 0 || result.packedOrphans.length > 0) {
+    if (result.orphanedFiles.length > 0) {
+      console.log('🗑️  Orphaned files (not referenced by any index):');
+      for (const file of result.orphanedFiles) {
+        console.log(`   - ${file}`);
+      }
+    }
+
+    console.log(`\n💾 Reclaimable: ${result.reclaimableBytes} bytes`);
+    const byNamespace = [...result.reclaimable.entries()].sort((a, b) => b[1].bytes - a[1].bytes);
+    for (const [namespace, { files, bytes }] of byNamespace) {
+      console.log(`   ${namespace}: ${bytes} bytes in ${files} file${files === 1 ? '' : 's'}`);
+    }
+    if (result.packedOrphans.length > 0) {
+      const count = result.packedOrphans.length;
+      console.log(`   spec/${PACK_FILE}: ${result.packReclaimableBytes} of its ${result.packBytes} bytes `
+        + `in ${count} unreferenced artifact${count === 1 ? '' : 's'}`);
     }
 
     if (clean) {
@@ -165,6 +332,9 @@ if (import.meta.url === `file://${process.argv[1]}`) {
       if (cleanResult.failed.length > 0) {
         console.log(`❌ Failed to delete ${cleanResult.failed.length} files`);
       }
+      if (cleanResult.pack) {
+        console.log(`📦 Rebuilt spec/${PACK_FILE}: ${cleanResult.pack.before} → ${cleanResult.pack.after} bytes`);
+      }
     } else {
       console.log('\n⚠️  To remove these orphaned files, run:');
       console.log('   make gc-clean\n');
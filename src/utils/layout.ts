@@ -0,0 +1,58 @@
+#!/usr/bin/env node
+/**
+ * Convert spec/ and .artifacts/ between the flat and sharded layouts.
+ *
+ * Usage: node dist/utils/layout.js [--sharded | --flat] [--spec <dir>] [--artifacts <dir>]
+ * Without --sharded or --flat, reports the current layout of each directory.
+ */
+
+import * as fs from 'fs';
+import * as path from 'path';
+import { fileURLToPath } from 'url';
+import { ContentLayout, LayoutMode } from '../core/content-layout.js';
+
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+// Defaults relative to this file (dist/utils/), not to the working directory
+const REPO_ROOT = path.join(__dirname, '..', '..', '..');
+
+function argValue(args: string[], flag: string, fallback: string): string {
+  const at = args.indexOf(flag);
+  return at >= 0 && args[at + 1] ? path.resolve(args[at + 1]) : fallback;
+}
+
+function main(): void {
+  const args = process.argv.slice(2);
+  const target: LayoutMode | null = args.includes('--sharded')
+    ? 'sharded'
+    : args.includes('--flat') ? 'flat' : null;
+  const dirs = [
+    argValue(args, '--spec', path.join(REPO_ROOT, 'spec')),
+    argValue(args, '--artifacts', path.join(REPO_ROOT, '.artifacts')),
+  ];
+
+  console.log('🗂️  Hologram Content Layout\n');
+
+  for (const dir of dirs) {
+    if (!fs.existsSync(dir)) {
+      console.log(`   ${dir}: not found, skipped`);
+      continue;
+    }
+
+    const layout = new ContentLayout(dir);
+    if (!target) {
+      console.log(`   ${dir}: ${layout.getMode()} (${layout.listFiles().size} files)`);
+      continue;
+    }
+
+    const moved = layout.migrate(target);
+    console.log(`✅ ${dir}: ${target}, moved ${moved} files`);
+  }
+
+  if (target) {
+    console.log('\n⚠️  Restart running MCP servers so new files are written in the new layout');
+  }
+}
+
+main();
@@ -0,0 +1,40 @@
+#!/usr/bin/env node
+/**
+ * Build the pack of a spec/ directory for fast cold starts.
+ *
+ * Usage: node dist/utils/pack.js [--spec <dir>]
+ * Rebuild after adding components; artifacts not yet packed are read from
+ * loose files meanwhile.
+ */
+
+import * as fs from 'fs';
+import * as path from 'path';
+import { fileURLToPath } from 'url';
+import { SpecPack } from '../core/spec-pack.js';
+
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+// Defaults relative to this file (dist/utils/), not to the working directory
+const REPO_ROOT = path.join(__dirname, '..', '..', '..');
+
+function main(): void {
+  const args = process.argv.slice(2);
+  const at = args.indexOf('--spec');
+  const specDir = at >= 0 && args[at + 1] ? path.resolve(args[at + 1]) : path.join(REPO_ROOT, 'spec');
+
+  console.log('📦 Hologram Spec Pack\n');
+
+  if (!fs.existsSync(specDir)) {
+    console.log(`❌ ${specDir}: not found`);
+    process.exit(1);
+  }
+
+  const packed = SpecPack.build(specDir);
+  const pack = SpecPack.open(specDir);
+  const bytes = pack ? fs.statSync(pack.getPath()).size : 0;
+  pack?.close();
+  console.log(`✅ Packed ${packed} artifacts into ${path.join(specDir, '.pack')} (${bytes} bytes)`);
+}
+
+main();
@@ -0,0 +1,359 @@
+#!/usr/bin/env python3
+"""
+Exact Field Vectors - Whole-Field Arithmetic over One Denominator
+
+A quotient field ψ with amplitudes αᵢ = (aᵢ + bᵢ·i)/d is stored as two
+integer numerator arrays (a, b) and ONE positive denominator d. Sums,
+norms and sector polynomials then run as integer array operations, with
+no per-amplitude Fraction allocation or gcd; a single Fraction is built
+only when a scalar (an energy) leaves the vector.
+
+Backends (all EXACT):
+- NumPy object arrays when numpy is installed: elementwise loops run in C
+  over Python integers, so nothing can overflow. int64 is not used, since
+  sector polynomials are quartic in the numerators.
+- gmpy2 mpz entries when gmpy2 is installed (faster big-integer products)
+- Plain Python lists of int otherwise
+
+NO FLOATS - every value is an integer numerator over an integer denominator.
+"""
+
+from fractions import Fraction
+from math import gcd, lcm
+import operator
+from typing import Dict, List, Sequence, Union
+
+from action_framework.core.exact_arithmetic import ComplexFraction
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+try:
+    from gmpy2 import mpz as _integer
+except ImportError:
+    _integer = int
+
+
+def _array(values: Sequence[int]):
+    """Integer array in the active backend."""
+    values = [_integer(int(x)) for x in values]
+    if np is not None:
+        return np.array(values, dtype=object)
+    return values
+
+
+def _combine(op, a, b):
+    """Elementwise op between two arrays, or an array and an integer."""
+    if np is not None:
+        return op(a, b)
+    if isinstance(b, list):
+        return [op(x, y) for x, y in zip(a, b)]
+    return [op(x, b) for x in a]
+
+
+def _add(a, b):
+    return _combine(operator.add, a, b)
+
+
+def _sub(a, b):
+    return _combine(operator.sub, a, b)
+
+
+def _mul(a, b):
+    return _combine(operator.mul, a, b)
+
+
+def _select(condition, a, b):
+    """Elementwise a where condition holds, else b."""
+    if np is not None:
+        return np.where(condition, a, b)
+    return [x if c else y for c, x, y in zip(condition, a, b)]
+
+
+def _less(a, b):
+    """Elementwise a < b as a boolean array."""
+    return _combine(operator.lt, a, b)
+
+
+def _abs(a):
+    if np is not None:
+        return np.abs(a)
+    return [abs(x) for x in a]
+
+
+def _dot(a, b) -> int:
+    """Exact Σ aᵢbᵢ."""
+    if np is not None:
+        return int(np.dot(a, b)) if len(a) else 0
+    return int(sum(x * y for x, y in zip(a, b)))
+
+
+def _gcd(a) -> int:
+    """gcd of all entries (0 for an all-zero array)."""
+    return gcd(*(int(x) for x in a))
+
+
+def _copy(a):
+    return a.copy()
+
+
+def _is_zero(a) -> bool:
+    return not any(a)
+
+
+class ExactFieldVector:
+    """
+    Exact complex field vector: αᵢ = (real[i] + imag[i]·i) / denominator.
+
+    Immutable: operations return new vectors. The denominator is always
+    positive but not always minimal; reduce() makes it minimal.
+    """
+
+    __slots__ = ('real', 'imag', 'denominator')
+
+    def __init__(self, real, imag, denominator: int = 1):
+        """
+        Initialize from integer numerators over a shared denominator.
+
+        Args:
+            real: Integer numerators of the real parts
+            imag: Integer numerators of the imaginary parts
+            denominator: Shared non-zero denominator
+        """
+        assert len(real) == len(imag), "Real and imaginary parts must have equal length"
+        assert denominator != 0, "Denominator must be non-zero"
+        self.real = _array(real)
+        self.imag = _array(imag)
+        self.denominator = int(denominator)
+        if self.denominator < 0:
+            self.real = _mul(self.real, -1)
+            self.imag = _mul(self.imag, -1)
+            self.denominator = -self.denominator
+
+    @classmethod
+    def _raw(cls, real, imag, denominator: int) -> 'ExactFieldVector':
+        """Wrap backend arrays without copying (denominator > 0)."""
+        vector = cls.__new__(cls)
+        vector.real = real
+        vector.imag = imag
+        vector.denominator = denominator
+        return vector
+
+    @classmethod
+    def zeros(cls, n: int) -> 'ExactFieldVector':
+        """Zero vector of length n."""
+        return cls([0] * n, [0] * n, 1)
+
+    @classmethod
+    def from_amplitudes(cls, amplitudes: Sequence[ComplexFraction]) -> 'ExactFieldVector':
+        """
+        Convert ComplexFraction amplitudes (EXACT).
+
+        The shared denominator is the lcm of all real and imaginary
+        denominators, so every numerator is an integer.
+        """
+        denominator = 1
+        for a in amplitudes:
+            denominator = lcm(denominator, a.real.denominator, a.imag.denominator)
+        real = [a.real.numerator * (denominator // a.real.denominator) for a in amplitudes]
+        imag = [a.imag.numerator * (denominator // a.imag.denominator) for a in amplitudes]
+        return cls(real, imag, denominator)
+
+    @classmethod
+    def from_field(cls, field) -> 'ExactFieldVector':
+        """Convert any quotient field with an `amplitudes` list."""
+        return cls.from_amplitudes(field.amplitudes)
+
+    def to_amplitudes(self) -> List[ComplexFraction]:
+        """Convert back to ComplexFraction amplitudes (EXACT)."""
+        d = self.denominator
+        return [
+            ComplexFraction(Fraction(int(a), d), Fraction(int(b), d))
+            for a, b in zip(self.real, self.imag)
+        ]
+
+    def to_field(self, field_class):
+        """Convert back to a quotient field of the given class."""
+        return field_class(self.to_amplitudes())
+
+    def __len__(self) -> int:
+        return len(self.real)
+
+    def __getitem__(self, index: int) -> ComplexFraction:
+        """Amplitude at index as a ComplexFraction."""
+        d = self.denominator
+        return ComplexFraction(Fraction(int(self.real[index]), d),
+                               Fraction(int(self.imag[index]), d))
+
+    def _aligned(self, other: 'ExactFieldVector'):
+        """Numerators of self and other over their common denominator."""
+        assert len(self) == len(other), "Vectors must have equal length"
+        if self.denominator == other.denominator:
+            return self.real, self.imag, other.real, other.imag, self.denominator
+        d = lcm(self.denominator, other.denominator)
+        s, t = d // self.denominator, d // other.denominator
+        return (_mul(self.real, s), _mul(self.imag, s),
+                _mul(other.real, t), _mul(other.imag, t), d)
+
+    def __add__(self, other: 'ExactFieldVector') -> 'ExactFieldVector':
+        """Exact addition."""
+        a, b, c, e, d = self._aligned(other)
+        return ExactFieldVector._raw(_add(a, c), _add(b, e), d)
+
+    def __sub__(self, other: 'ExactFieldVector') -> 'ExactFieldVector':
+        """Exact subtraction."""
+        a, b, c, e, d = self._aligned(other)
+        return ExactFieldVector._raw(_sub(a, c), _sub(b, e), d)
+
+    def __neg__(self) -> 'ExactFieldVector':
+        return ExactFieldVector._raw(_mul(self.real, -1), _mul(self.imag, -1), self.denominator)
+
+    def scale(self, factor: Union[int, Fraction]) -> 'ExactFieldVector':
+        """
+        Multiply every amplitude by a rational scalar (EXACT).
+
+        Only the numerators and the denominator change; the result is not
+        reduced.
+        """
+        factor = Fraction(factor)
+        p, q = factor.numerator, factor.denominator
+        if p == 0:
+            return ExactFieldVector.zeros(len(self))
+        return ExactFieldVector._raw(_mul(self.real, p), _mul(self.imag, p), self.denominator * q)
+
+    def scale_rows(self, numerators, denominator: int = 1) -> 'ExactFieldVector':
+        """
+        Multiply amplitude i by numerators[i] / denominator (EXACT).
+
+        Args:
+            numerators: Backend integer array, one factor numerator per amplitude
+            denominator: Positive denominator shared by all factors
+        """
+        return ExactFieldVector._raw(_mul(self.real, numerators), _mul(self.imag, numerators),
+                                     self.denominator * denominator)
+
+    def norm_numerators(self):
+        """
+        Integer array of |αᵢ|²·d², i.e. aᵢ² + bᵢ².
+
+        Divide by denominator² for the exact norms.
+        """
+        return _add(_mul(self.real, self.real), _mul(self.imag, self.imag))
+
+    def norms_squared(self) -> List[Fraction]:
+        """Exact |αᵢ|² per amplitude."""
+        d2 = self.denominator ** 2
+        return [Fraction(int(n), d2) for n in self.norm_numerators()]
+
+    def norm_squared(self) -> Fraction:
+        """Exact L² norm squared."""
+        return Fraction(_dot(self.real, self.real) + _dot(self.imag, self.imag),
+                        self.denominator ** 2)
+
+    def replace(self, changes: Dict[int, ComplexFraction]) -> 'ExactFieldVector':
+        """
+        Copy with some amplitudes replaced (EXACT).
+
+        The denominator grows to the lcm with the new amplitudes'
+        denominators; when it stays the same only the changed numerators
+        are computed, otherwise every numerator is rescaled.
+        """
+        d = self.denominator
+        for value in changes.values():
+            d = lcm(d, value.real.denominator, value.imag.denominator)
+        s = d // self.denominator
+        real = _mul(self.real, s) if s != 1 else _copy(self.real)
+        imag = _mul(self.imag, s) if s != 1 else _copy(self.imag)
+        for i, value in changes.items():
+            real[i] = _integer(value.real.numerator * (d // value.real.denominator))
+            imag[i] = _integer(value.imag.numerator * (d // value.imag.denominator))
+        return ExactFieldVector._raw(real, imag, d)
+
+    def reduce(self) -> 'ExactFieldVector':
+        """Same vector with the smallest possible shared denominator."""
+        g = gcd(_gcd(self.real), _gcd(self.imag), self.denominator)
+        if g == 1:
+            return self
+        return ExactFieldVector._raw(_combine(operator.floordiv, self.real, g),
+                                     _combine(operator.floordiv, self.imag, g),
+                                     self.denominator // g)
+
+    def is_zero(self) -> bool:
+        """Check if every amplitude is exactly zero."""
+        return _is_zero(self.real) and _is_zero(self.imag)
+
+    def nonzero_indices(self) -> List[int]:
+        """Indices of the amplitudes that are not exactly zero."""
+        return [i for i, (a, b) in enumerate(zip(self.real, self.imag)) if a != 0 or b != 0]
+
+    def __eq__(self, other) -> bool:
+        """Exact equality (denominators need not match)."""
+        if not isinstance(other, ExactFieldVector):
+            return NotImplemented
+        if len(self) != len(other):
+            return False
+        a, b, c, e, _ = self._aligned(other)
+        return _is_zero(_sub(a, c)) and _is_zero(_sub(b, e))
+
+    __hash__ = None
+
+    def __repr__(self) -> str:
+        return f"ExactFieldVector(n={len(self)}, denominator={self.denominator})"
+
+
+def as_vector(psi) -> ExactFieldVector:
+    """Return psi as an ExactFieldVector, converting a quotient field."""
+    if isinstance(psi, ExactFieldVector):
+        return psi
+    return ExactFieldVector.from_field(psi)
+
+
+def deviation_numerators(norms, denominator: int, target: Fraction, scale: int = None):
+    """
+    Integer array of (|αᵢ|² − target) over the shared denominator q·d².
+
+    Args:
+        norms: norm_numerators() of a vector with denominator d
+        denominator: d
+        target: Exact target norm²
+        scale: q, a multiple of target's denominator (default: that denominator)
+
+    Returns:
+        (numerators, q·d²): numerators[i] = q·(aᵢ² + bᵢ²) − q·target·d²
+    """
+    q = target.denominator if scale is None else scale
+    d2 = denominator ** 2
+    shift = target.numerator * (q // target.denominator) * d2
+    return _sub(_mul(norms, q), shift), q * d2
+
+
+def squared_total(values) -> int:
+    """Exact Σ vᵢ² of an integer array."""
+    return _dot(values, values)
+
+
+def nearest_deviation_numerators(norms, denominator: int, low: Fraction, high: Fraction):
+    """
+    Per-amplitude deviation from the nearer of two target norms.
+
+    Ties go to the higher target. Returns (numerators, shared denominator)
+    like deviation_numerators.
+    """
+    q = lcm(low.denominator, high.denominator)
+    dev_low, _ = deviation_numerators(norms, denominator, low, q)
+    dev_high, shared = deviation_numerators(norms, denominator, high, q)
+    return _select(_less(_abs(dev_low), _abs(dev_high)), dev_low, dev_high), shared
+
+
+if __name__ == '__main__':
+    print("Testing exact field vectors...")
+    amplitudes = [ComplexFraction(Fraction(1, 2), Fraction(1, 3)), ComplexFraction(1, -1)]
+    v = ExactFieldVector.from_amplitudes(amplitudes)
+    print(f"  Shared denominator: {v.denominator} (expect 6)")
+    print(f"  Round trip exact: {v.to_amplitudes() == amplitudes}")
+    print(f"  Norm² = {v.norm_squared()} (expect {amplitudes[0].norm_squared() + 2})")
+    print(f"  Backend: {'numpy object' if np is not None else 'python list'}, "
+          f"{'gmpy2' if _integer is not int else 'int'} entries")
+    print("\n✓ Exact field vectors working - NO FLOATS")
@@ -18,15 +18,30 @@ Sectors enforce (EXACTLY, no floats):
 2. Conservation: Total norm² = 240·2 = 480
 3. Simply-laced structure (all roots equal)
 
-NO NUMPY - All arithmetic exact using fractions.Fraction.
+NO NUMPY - All arithmetic exact: sectors evaluate whole-field integer
+arrays over one shared denominator (core/field_vector.py).
 """
 
 from dataclasses import dataclass
 from fractions import Fraction
-from typing import Dict
+from typing import Dict, Tuple, Union
 
 from action_framework.core.quotient_field import E8QuotientField
 from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import (
+    ExactFieldVector, as_vector, deviation_numerators, squared_total
+)
+from action_framework.sectors.fused_action import FusedNormAction, FusedActionState
+
+# Sectors accept either form; gradients are returned in the form given
+E8Field = Union[E8QuotientField, ExactFieldVector]
+
+
+def _as_given(psi: E8Field, grad: ExactFieldVector) -> E8Field:
+    """Return grad as a field when psi was a field, else as a vector."""
+    if isinstance(psi, ExactFieldVector):
+        return grad
+    return grad.to_field(E8QuotientField)
 
 
 @dataclass
@@ -55,42 +70,35 @@ class E8UniformNormSector:
         self.lambda_norm = lambda_norm
         self.target_norm = Fraction(2)  # All roots: norm² = 2 (standard E₈)
 
-    def energy(self, psi: E8QuotientField) -> Fraction:
+    def energy(self, psi: E8Field) -> Fraction:
         """
         Penalty for roots deviating from uniform norm (EXACT).
+
+        With αᵢ = (aᵢ + bᵢi)/d, each deviation is an integer over d², so the
+        sum is one integer over d⁴.
         """
         if self.lambda_norm == 0:
             return Fraction(0)
 
-        energy = Fraction(0)
+        v = as_vector(psi)
+        deviations, scale = deviation_numerators(v.norm_numerators(), v.denominator, self.target_norm)
+        return self.lambda_norm * Fraction(squared_total(deviations), scale * scale)
 
-        for amplitude in psi.amplitudes:
-            norm_sq = amplitude.norm_squared()  # Exact Fraction
-            deviation = (norm_sq - self.target_norm) ** 2
-            energy += deviation
-
-        return self.lambda_norm * energy
-
-    def gradient(self, psi: E8QuotientField) -> E8QuotientField:
+    def gradient(self, psi: E8Field) -> E8Field:
         """
         Gradient: push all roots toward norm²=2 (EXACT).
 
         ∂E/∂α*ᵢ = 2λ(|αᵢ|² - 2)·αᵢ (Wirtinger derivative)
         """
-        grad = E8QuotientField()
+        v = as_vector(psi)
 
         if self.lambda_norm == 0:
-            return grad
-
-        for i in range(240):
-            amplitude = psi[i]
-            norm_sq = amplitude.norm_squared()  # Exact Fraction
+            return _as_given(psi, ExactFieldVector.zeros(240))
 
-            # Gradient: ∂E/∂α*ᵢ = 2λ(|α|² - 2)·α
-            factor = self.lambda_norm * Fraction(2) * (norm_sq - self.target_norm)
-            grad[i] = amplitude * factor
-
-        return grad
+        # Gradient: ∂E/∂α*ᵢ = 2λ(|α|² - 2)·α, all 240 rows at once
+        deviations, scale = deviation_numerators(v.norm_numerators(), v.denominator, self.target_norm)
+        grad = v.scale_rows(deviations, scale).scale(2 * self.lambda_norm)
+        return _as_given(psi, grad)
 
 
 class E8EnergyConservationSector:
@@ -104,33 +112,30 @@ class E8EnergyConservationSector:
         self.lambda_energy = lambda_energy
         self.target_total = Fraction(480)  # 240 roots × norm²=2
 
-    def energy(self, psi: E8QuotientField) -> Fraction:
+    def energy(self, psi: E8Field) -> Fraction:
         """Penalty for total energy deviation (EXACT)."""
         if self.lambda_energy == 0:
             return Fraction(0)
 
-        total_energy = psi.norm_squared()  # Exact Fraction
+        total_energy = as_vector(psi).norm_squared()  # Exact Fraction
         deviation = (total_energy - self.target_total) ** 2
 
         return self.lambda_energy * deviation
 
-    def gradient(self, psi: E8QuotientField) -> E8QuotientField:
+    def gradient(self, psi: E8Field) -> E8Field:
         """
         Gradient: ∂E/∂α*ᵢ = 2λ·(Σⱼ|αⱼ|² - 480)·αᵢ (EXACT)
         """
-        grad = E8QuotientField()
+        v = as_vector(psi)
 
         if self.lambda_energy == 0:
-            return grad
+            return _as_given(psi, ExactFieldVector.zeros(240))
 
-        total_energy = psi.norm_squared()  # Exact Fraction
+        total_energy = v.norm_squared()  # Exact Fraction
         factor = Fraction(2) * self.lambda_energy * (total_energy - self.target_total)
 
-        # Multiply each amplitude by factor
-        for i in range(240):
-            grad[i] = psi[i] * factor
-
-        return grad
+        # One scalar multiplies every amplitude
+        return _as_given(psi, v.scale(factor))
 
 
 class E8RootAction:
@@ -144,22 +149,41 @@ class E8RootAction:
         self.weights = weights
         self.uniform_norm = E8UniformNormSector(weights.lambda_uniform_norm)
         self.energy_cons = E8EnergyConservationSector(weights.lambda_energy_conservation)
+        # Both sectors fused: shared norms, one pass, incremental updates
+        self.fused = FusedNormAction(
+            240, [self.uniform_norm.target_norm],
+            self.uniform_norm.lambda_norm, self.energy_cons.target_total, self.energy_cons.lambda_energy
+        )
 
-    def energy(self, psi: E8QuotientField) -> Fraction:
+    def energy(self, psi: E8Field) -> Fraction:
         """Total energy (EXACT)."""
+        v = as_vector(psi)
         E = Fraction(0)
-        E += self.uniform_norm.energy(psi)
-        E += self.energy_cons.energy(psi)
+        E += self.uniform_norm.energy(v)
+        E += self.energy_cons.energy(v)
         return E
 
-    def gradient(self, psi: E8QuotientField) -> E8QuotientField:
+    def gradient(self, psi: E8Field) -> E8Field:
         """Total gradient (EXACT)."""
-        grad = E8QuotientField()
-        grad = grad + self.uniform_norm.gradient(psi)
-        grad = grad + self.energy_cons.gradient(psi)
-        return grad
+        v = as_vector(psi)
+        grad = self.uniform_norm.gradient(v) + self.energy_cons.gradient(v)
+        return _as_given(psi, grad.reduce())
+
+    def evaluate(self, psi: E8Field) -> Tuple[Fraction, E8Field]:
+        """
+        Energy and gradient together in one fused pass (EXACT).
+
+        Returns:
+            (energy, gradient), the gradient in the form psi was given
+        """
+        energy, grad = self.fused.evaluate(psi)
+        return energy, _as_given(psi, grad)
+
+    def state(self, psi: E8Field) -> FusedActionState:
+        """Cached fused terms at psi, for incremental re-evaluation."""
+        return self.fused.state(psi)
 
-    def compute_root_statistics(self, psi: E8QuotientField) -> Dict[str, any]:
+    def compute_root_statistics(self, psi: E8Field) -> Dict[str, any]:
         """
         Compute E₈ root system statistics (EXACT).
 
@@ -167,7 +191,7 @@ class E8RootAction:
             Dictionary with norms (exact Fractions), etc.
         """
         # Compute exact norms squared
-        norms_sq = [amp.norm_squared() for amp in psi.amplitudes]
+        norms_sq = as_vector(psi).norms_squared()
 
         # Mean norm
         mean_norm_sq = sum(norms_sq) / 240
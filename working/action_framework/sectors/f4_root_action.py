@@ -10,15 +10,30 @@ Sectors enforce (EXACTLY, no floats):
 2. Conservation: Total norm² = 24·1 + 24·2 = 72
 3. Root system axioms (crystallographic, reflection closure)
 
-NO NUMPY - All arithmetic exact using fractions.Fraction.
+NO NUMPY - All arithmetic exact: sectors evaluate whole-field integer
+arrays over one shared denominator (core/field_vector.py).
 """
 
 from dataclasses import dataclass
 from fractions import Fraction
-from typing import Dict
+from typing import Dict, Tuple, Union
 
 from action_framework.core.quotient_field import F4QuotientField
 from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import (
+    ExactFieldVector, as_vector, nearest_deviation_numerators, squared_total
+)
+from action_framework.sectors.fused_action import FusedNormAction, FusedActionState
+
+# Sectors accept either form; gradients are returned in the form given
+F4Field = Union[F4QuotientField, ExactFieldVector]
+
+
+def _as_given(psi: F4Field, grad: ExactFieldVector) -> F4Field:
+    """Return grad as a field when psi was a field, else as a vector."""
+    if isinstance(psi, ExactFieldVector):
+        return grad
+    return grad.to_field(F4QuotientField)
 
 
 @dataclass
@@ -49,57 +64,42 @@ class NormQuantizationSector:
         self.target_short_norm = Fraction(1)  # Short roots: norm² = 1
         self.target_long_norm = Fraction(2)   # Long roots: norm² = 2
 
-    def energy(self, psi: F4QuotientField) -> Fraction:
+    def _deviations(self, v: ExactFieldVector):
+        """Integer deviation of each norm² from its nearer target, and their denominator."""
+        return nearest_deviation_numerators(
+            v.norm_numerators(), v.denominator, self.target_short_norm, self.target_long_norm
+        )
+
+    def energy(self, psi: F4Field) -> Fraction:
         """
         Penalty for roots not having quantized norms (EXACT).
 
-        Each root should have exactly norm²=1 or norm²=2.
+        Each root should have exactly norm²=1 or norm²=2. The square of the
+        deviation from the nearer target is the smaller of the two squared
+        distances.
         """
         if self.lambda_norm == 0:
             return Fraction(0)
 
-        energy = Fraction(0)
-
-        for amplitude in psi.amplitudes:
-            norm_sq = amplitude.norm_squared()  # Returns exact Fraction
+        deviations, scale = self._deviations(as_vector(psi))
+        return self.lambda_norm * Fraction(squared_total(deviations), scale * scale)
 
-            # Distance to nearest quantized value
-            dist_to_short = (norm_sq - self.target_short_norm) ** 2
-            dist_to_long = (norm_sq - self.target_long_norm) ** 2
-            energy += min(dist_to_short, dist_to_long)
-
-        return self.lambda_norm * energy
-
-    def gradient(self, psi: F4QuotientField) -> F4QuotientField:
+    def gradient(self, psi: F4Field) -> F4Field:
         """
         Gradient pushes each root toward nearest quantized norm (EXACT).
 
         ∂E/∂α*ᵢ = λ·2(|αᵢ|² - target)·αᵢ where target is nearest of {1, 2}
-        (Wirtinger derivative for complex fields)
+        (Wirtinger derivative for complex fields; ties go to the long target)
         """
-        grad = F4QuotientField()
+        v = as_vector(psi)
 
         if self.lambda_norm == 0:
-            return grad
-
-        for i in range(48):
-            amplitude = psi[i]
-            norm_sq = amplitude.norm_squared()  # Exact Fraction
-
-            # Choose nearest target (exact comparison)
-            dist_to_short = abs(norm_sq - self.target_short_norm)
-            dist_to_long = abs(norm_sq - self.target_long_norm)
-
-            if dist_to_short < dist_to_long:
-                target = self.target_short_norm
-            else:
-                target = self.target_long_norm
+            return _as_given(psi, ExactFieldVector.zeros(48))
 
-            # Gradient: ∂E/∂α*ᵢ = 2λ(|α|² - target)·α
-            factor = self.lambda_norm * Fraction(2) * (norm_sq - target)
-            grad[i] = amplitude * factor
-
-        return grad
+        # Gradient: ∂E/∂α*ᵢ = 2λ(|α|² - target)·α, all 48 rows at once
+        deviations, scale = self._deviations(v)
+        grad = v.scale_rows(deviations, scale).scale(2 * self.lambda_norm)
+        return _as_given(psi, grad)
 
 
 class EnergyConservationSector:
@@ -113,33 +113,30 @@ class EnergyConservationSector:
         self.lambda_energy = lambda_energy
         self.target_total = Fraction(72)  # 24·1 + 24·2 = 72 (exact)
 
-    def energy(self, psi: F4QuotientField) -> Fraction:
+    def energy(self, psi: F4Field) -> Fraction:
         """Penalty for total energy deviation (EXACT)."""
         if self.lambda_energy == 0:
             return Fraction(0)
 
-        total_energy = psi.norm_squared()  # Returns exact Fraction
+        total_energy = as_vector(psi).norm_squared()  # Returns exact Fraction
         deviation = (total_energy - self.target_total) ** 2
 
         return self.lambda_energy * deviation
 
-    def gradient(self, psi: F4QuotientField) -> F4QuotientField:
+    def gradient(self, psi: F4Field) -> F4Field:
         """
         Gradient: ∂E/∂α*ᵢ = 2λ·(Σⱼ|αⱼ|² - 72)·αᵢ (Wirtinger derivative, EXACT)
         """
-        grad = F4QuotientField()
+        v = as_vector(psi)
 
         if self.lambda_energy == 0:
-            return grad
+            return _as_given(psi, ExactFieldVector.zeros(48))
 
-        total_energy = psi.norm_squared()  # Exact Fraction
+        total_energy = v.norm_squared()  # Exact Fraction
         factor = Fraction(2) * self.lambda_energy * (total_energy - self.target_total)
 
-        # Multiply each amplitude by factor
-        for i in range(48):
-            grad[i] = psi[i] * factor
-
-        return grad
+        # One scalar multiplies every amplitude
+        return _as_given(psi, v.scale(factor))
 
 
 class F4RootAction:
@@ -154,22 +151,41 @@ class F4RootAction:
         self.weights = weights
         self.norm_quant = NormQuantizationSector(weights.lambda_norm_quantization)
         self.energy_cons = EnergyConservationSector(weights.lambda_energy_conservation)
+        # Both sectors fused: shared norms, one pass, incremental updates
+        self.fused = FusedNormAction(
+            48, [self.norm_quant.target_short_norm, self.norm_quant.target_long_norm],
+            self.norm_quant.lambda_norm, self.energy_cons.target_total, self.energy_cons.lambda_energy
+        )
 
-    def energy(self, psi: F4QuotientField) -> Fraction:
+    def energy(self, psi: F4Field) -> Fraction:
         """Total energy (EXACT)."""
+        v = as_vector(psi)
         E = Fraction(0)
-        E += self.norm_quant.energy(psi)
-        E += self.energy_cons.energy(psi)
+        E += self.norm_quant.energy(v)
+        E += self.energy_cons.energy(v)
         return E
 
-    def gradient(self, psi: F4QuotientField) -> F4QuotientField:
+    def gradient(self, psi: F4Field) -> F4Field:
         """Total gradient (EXACT)."""
-        grad = F4QuotientField()
-        grad = grad + self.norm_quant.gradient(psi)
-        grad = grad + self.energy_cons.gradient(psi)
-        return grad
+        v = as_vector(psi)
+        grad = self.norm_quant.gradient(v) + self.energy_cons.gradient(v)
+        return _as_given(psi, grad.reduce())
+
+    def evaluate(self, psi: F4Field) -> Tuple[Fraction, F4Field]:
+        """
+        Energy and gradient together in one fused pass (EXACT).
+
+        Returns:
+            (energy, gradient), the gradient in the form psi was given
+        """
+        energy, grad = self.fused.evaluate(psi)
+        return energy, _as_given(psi, grad)
+
+    def state(self, psi: F4Field) -> FusedActionState:
+        """Cached fused terms at psi, for incremental re-evaluation."""
+        return self.fused.state(psi)
 
-    def compute_root_statistics(self, psi: F4QuotientField) -> Dict[str, any]:
+    def compute_root_statistics(self, psi: F4Field) -> Dict[str, any]:
         """
         Compute F₄ root system statistics (EXACT).
 
@@ -177,7 +193,7 @@ class F4RootAction:
             Dictionary with counts, norms (exact Fractions), etc.
         """
         # Compute exact norms squared
-        norms_sq = [amp.norm_squared() for amp in psi.amplitudes]
+        norms_sq = as_vector(psi).norms_squared()
 
         # Classify by norm (exact comparison to midpoint 3/2)
         short_threshold = Fraction(3, 2)  # Exact midpoint between 1 and 2
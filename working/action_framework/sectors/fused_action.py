@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""
+Fused Norm Action - Energy and Gradient in One Pass - EXACT ARITHMETIC
+
+The F₄, E₆, E₇ and E₈ actions share one shape:
+
+    S[ψ] = λ_norm·Σᵢ (|αᵢ|² - tᵢ)² + λ_energy·(Σᵢ |αᵢ|² - T)²
+
+where tᵢ is the target norm² nearest |αᵢ|² (one target for the
+simply-laced groups, {1, 2} for F₄). Evaluated sector by sector, every
+sector recomputes all |αᵢ|² and allocates its own gradient field. Here
+the per-amplitude norms and deviations are computed once and shared:
+
+    ∂S/∂α*ᵢ = [2λ_norm·(|αᵢ|² - tᵢ) + 2λ_energy·(Σⱼ|αⱼ|² - T)]·αᵢ
+
+FusedActionState keeps those terms and the two running sums, so changing
+a few amplitudes (perturbation checks) updates the energy in time
+proportional to the number changed.
+
+NO FLOATS - integer numerators over one shared denominator
+(core/field_vector.py).
+"""
+
+from fractions import Fraction
+from math import lcm
+from typing import Dict, Sequence, Tuple
+
+from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import (
+    ExactFieldVector, as_vector, deviation_numerators, nearest_deviation_numerators,
+    squared_total
+)
+
+
+class FusedNormAction:
+    """
+    Norm quantization + total energy conservation, fused (EXACT).
+    """
+
+    def __init__(self, size: int, norm_targets: Sequence[Fraction], lambda_norm: Fraction,
+                 total_target: Fraction, lambda_energy: Fraction):
+        """
+        Args:
+            size: Number of amplitudes (48, 72, 126 or 240)
+            norm_targets: One target norm², or (short, long) for F₄
+            lambda_norm: Norm sector weight
+            total_target: Target Σᵢ |αᵢ|²
+            lambda_energy: Conservation sector weight
+        """
+        assert len(norm_targets) in (1, 2), "One target norm² or a (short, long) pair"
+        self.size = size
+        self.norm_targets = sorted(Fraction(t) for t in norm_targets)
+        self.lambda_norm = Fraction(lambda_norm)
+        self.total_target = Fraction(total_target)
+        self.lambda_energy = Fraction(lambda_energy)
+        # Deviations are taken over q·d², q common to every target
+        self._q = lcm(*(t.denominator for t in self.norm_targets))
+
+    def deviations(self, v: ExactFieldVector):
+        """
+        Deviation of every |αᵢ|² from its nearest target.
+
+        Returns:
+            (norm numerators, deviation numerators, deviation denominator)
+        """
+        norms = v.norm_numerators()
+        if len(self.norm_targets) == 1:
+            deviations, scale = deviation_numerators(norms, v.denominator, self.norm_targets[0], self._q)
+        else:
+            deviations, scale = nearest_deviation_numerators(norms, v.denominator, *self.norm_targets)
+        return norms, deviations, scale
+
+    def deviation(self, norm: int, denominator: int) -> int:
+        """
+        Deviation numerator of one amplitude with norm numerator `norm`.
+
+        Matches deviations(): ties between two targets go to the higher one.
+        """
+        d2 = denominator * denominator
+        best = None
+        for t in self.norm_targets:
+            dev = self._q * norm - t.numerator * (self._q // t.denominator) * d2
+            if best is None or abs(dev) <= abs(best):
+                best = dev
+        return best
+
+    def state(self, psi) -> 'FusedActionState':
+        """One pass over psi, keeping every shared term for later updates."""
+        return FusedActionState(self, as_vector(psi))
+
+    def evaluate(self, psi) -> Tuple[Fraction, ExactFieldVector]:
+        """
+        Energy and gradient together (EXACT).
+
+        Returns:
+            (S[ψ], ∂S/∂ψ*) with the gradient as an ExactFieldVector
+        """
+        state = self.state(psi)
+        return state.energy, state.gradient()
+
+
+class FusedActionState:
+    """
+    Cached terms of a FusedNormAction at one field configuration.
+
+    Holds the field vector, the integer norms and deviations per amplitude,
+    and their running sums Σ devᵢ² and Σ |αᵢ|²·d².
+    """
+
+    def __init__(self, action: FusedNormAction, psi: ExactFieldVector):
+        assert len(psi) == action.size, f"Expected {action.size} amplitudes, got {len(psi)}"
+        self.action = action
+        self._rebuild(psi)
+
+    def _rebuild(self, psi: ExactFieldVector) -> None:
+        """Full pass: every norm and deviation from scratch."""
+        self.psi = psi
+        norms, deviations, self._scale = self.action.deviations(psi)
+        self._norms = [int(n) for n in norms]
+        self._deviations = [int(x) for x in deviations]
+        self._deviation_total = squared_total(deviations)
+        self._norm_total = sum(self._norms)
+
+    @property
+    def norm_energy(self) -> Fraction:
+        """λ_norm·Σᵢ (|αᵢ|² - tᵢ)²"""
+        return self.action.lambda_norm * Fraction(self._deviation_total, self._scale * self._scale)
+
+    @property
+    def total_norm(self) -> Fraction:
+        """Σᵢ |αᵢ|²"""
+        return Fraction(self._norm_total, self.psi.denominator ** 2)
+
+    @property
+    def conservation_energy(self) -> Fraction:
+        """λ_energy·(Σᵢ |αᵢ|² - T)²"""
+        return self.action.lambda_energy * (self.total_norm - self.action.total_target) ** 2
+
+    @property
+    def energy(self) -> Fraction:
+        """Total energy (EXACT)."""
+        return self.norm_energy + self.conservation_energy
+
+    def gradient(self) -> ExactFieldVector:
+        """
+        Total gradient from the cached deviations (EXACT).
+
+        Row i is αᵢ times 2λ_norm·devᵢ + 2λ_energy·(Σⱼ|αⱼ|² - T).
+        """
+        action = self.action
+        conservation = 2 * action.lambda_energy * (self.total_norm - action.total_target)
+        grad = ExactFieldVector.zeros(action.size)
+        if action.lambda_norm != 0:
+            grad = grad + self.psi.scale_rows(self._deviations, self._scale).scale(2 * action.lambda_norm)
+        if conservation != 0:
+            grad = grad + self.psi.scale(conservation)
+        return grad.reduce()
+
+    def update(self, changes: Dict[int, ComplexFraction]) -> None:
+        """
+        Replace some amplitudes and refresh the cached terms.
+
+        When the shared denominator is unchanged only the changed rows are
+        recomputed; a new denominator needs a full pass.
+        """
+        psi = self.psi.replace(changes)
+        if psi.denominator != self.psi.denominator:
+            self._rebuild(psi)
+            return
+        for i in changes:
+            norm = int(psi.real[i]) ** 2 + int(psi.imag[i]) ** 2
+            deviation = self.action.deviation(norm, psi.denominator)
+            self._norm_total += norm - self._norms[i]
+            self._deviation_total += deviation * deviation - self._deviations[i] ** 2
+            self._norms[i] = norm
+            self._deviations[i] = deviation
+        self.psi = psi
+
+    def energy_with(self, changes: Dict[int, ComplexFraction]) -> Fraction:
+        """
+        Energy after replacing some amplitudes, leaving this state unchanged.
+
+        Costs time proportional to len(changes) unless a new denominator is
+        needed.
+        """
+        d = self.psi.denominator
+        if any(d % value.real.denominator or d % value.imag.denominator for value in changes.values()):
+            trial = FusedActionState(self.action, self.psi.replace(changes))
+            return trial.energy
+        norm_total = self._norm_total
+        deviation_total = self._deviation_total
+        for i, value in changes.items():
+            a = value.real.numerator * (d // value.real.denominator)
+            b = value.imag.numerator * (d // value.imag.denominator)
+            norm = a * a + b * b
+            deviation = self.action.deviation(norm, d)
+            norm_total += norm - self._norms[i]
+            deviation_total += deviation * deviation - self._deviations[i] ** 2
+        action = self.action
+        return (action.lambda_norm * Fraction(deviation_total, self._scale * self._scale)
+                + action.lambda_energy * (Fraction(norm_total, d * d) - action.total_target) ** 2)
+
+
+if __name__ == '__main__':
+    print("Testing fused norm action (EXACT ARITHMETIC)...")
+
+    action = FusedNormAction(240, [Fraction(2)], Fraction(1), Fraction(480), Fraction(1))
+    state = action.state(ExactFieldVector([1] * 240, [1] * 240))
+    print(f"  E₈ energy: {state.energy} (expect 0)")
+    print(f"  Gradient exactly zero: {state.gradient().is_zero()}")
+
+    bumped = state.energy_with({0: ComplexFraction(Fraction(11, 10), 1)})
+    print(f"  Energy after bumping one amplitude: {bumped} (expect > 0)")
+    state.update({0: ComplexFraction(Fraction(11, 10), 1)})
+    print(f"  Incremental update agrees: {state.energy == bumped}")
+
+    print("\n✓ Fused action working - NO FLOATS")
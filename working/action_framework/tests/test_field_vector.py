@@ -0,0 +1,234 @@
+"""
+Tests for the exact field vector backend against per-amplitude Fraction
+arithmetic (EXACT).
+
+Every check runs on each backend: plain lists of int, numpy object arrays
+and gmpy2 mpz entries. Backends whose module is not installed are skipped.
+
+Run from working/: python3 -m unittest discover -s action_framework/tests -t .
+"""
+import random
+import unittest
+from fractions import Fraction
+from unittest import mock
+
+from action_framework.core import field_vector
+from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import ExactFieldVector
+from action_framework.core.quotient_field import E8QuotientField, F4QuotientField
+from action_framework.sectors.e8_root_action import (
+    E8RootAction, E8ActionWeights, E8UniformNormSector, E8EnergyConservationSector
+)
+from action_framework.sectors.f4_root_action import (
+    F4RootAction, F4ActionWeights, NormQuantizationSector, EnergyConservationSector
+)
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+try:
+    import gmpy2
+except ImportError:
+    gmpy2 = None
+
+SEED = 20261014
+TRIALS = 6
+
+
+def random_amplitude(rng: random.Random) -> ComplexFraction:
+    """Random exact amplitude with small numerators."""
+    return ComplexFraction(Fraction(rng.randint(-9, 9), rng.choice((1, 2, 3, 4, 5, 6))),
+                           Fraction(rng.randint(-9, 9), rng.choice((1, 2, 3, 4, 5, 6))))
+
+
+# Reference sectors: one Fraction per amplitude, as before the vector backend
+
+def reference_norm_energy(amplitudes, weight: Fraction, targets) -> Fraction:
+    """λ·Σᵢ min over targets of (|αᵢ|² - t)²"""
+    return weight * sum((min((a.norm_squared() - t) ** 2 for t in targets) for a in amplitudes),
+                        Fraction(0))
+
+
+def reference_norm_gradient(amplitudes, weight: Fraction, targets):
+    """2λ(|αᵢ|² - tᵢ)·αᵢ, tᵢ the nearest target (ties to the higher one)"""
+    grad = []
+    for a in amplitudes:
+        norm = a.norm_squared()
+        target = targets[0]
+        for t in targets[1:]:
+            if not abs(norm - target) < abs(norm - t):
+                target = t
+        grad.append(a * (2 * weight * (norm - target)))
+    return grad
+
+
+def reference_total_energy(amplitudes, weight: Fraction, total: Fraction) -> Fraction:
+    """λ·(Σᵢ |αᵢ|² - T)²"""
+    return weight * (sum((a.norm_squared() for a in amplitudes), Fraction(0)) - total) ** 2
+
+
+def reference_total_gradient(amplitudes, weight: Fraction, total: Fraction):
+    """2λ·(Σⱼ |αⱼ|² - T)·αᵢ"""
+    factor = 2 * weight * (sum((a.norm_squared() for a in amplitudes), Fraction(0)) - total)
+    return [a * factor for a in amplitudes]
+
+
+def add_amplitudes(a, b):
+    return [x + y for x, y in zip(a, b)]
+
+
+class BackendCase:
+    """
+    Shared checks; subclasses pick the backend with numpy_module and
+    integer_type and skip themselves when those are unavailable.
+    """
+
+    numpy_module = None
+    integer_type = int
+
+    def setUp(self):
+        patcher = mock.patch.multiple(field_vector, np=self.numpy_module, _integer=self.integer_type)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+        self.rng = random.Random(SEED)
+
+    def random_amplitudes(self, n: int):
+        return [random_amplitude(self.rng) for _ in range(n)]
+
+    def assertAmplitudesEqual(self, vector, amplitudes):
+        self.assertIsInstance(vector, ExactFieldVector)
+        self.assertEqual(vector.to_amplitudes(), amplitudes)
+
+    def test_backend_in_use(self):
+        """Vectors are built from the patched backend."""
+        v = ExactFieldVector.from_amplitudes(self.random_amplitudes(4))
+        if self.numpy_module is not None:
+            self.assertIsInstance(v.real, self.numpy_module.ndarray)
+        else:
+            self.assertIsInstance(v.real, list)
+        self.assertTrue(all(type(x) is self.integer_type for x in v.real))
+
+    def test_round_trip_and_arithmetic(self):
+        """Conversion, +, -, scale, replace and reduce agree with Fractions."""
+        for _ in range(TRIALS):
+            a, b = self.random_amplitudes(12), self.random_amplitudes(12)
+            u, v = ExactFieldVector.from_amplitudes(a), ExactFieldVector.from_amplitudes(b)
+            self.assertAmplitudesEqual(u, a)
+            self.assertAmplitudesEqual(u + v, add_amplitudes(a, b))
+            self.assertAmplitudesEqual(u - v, [x - y for x, y in zip(a, b)])
+            self.assertAmplitudesEqual(u.scale(Fraction(-7, 3)), [x * Fraction(-7, 3) for x in a])
+            self.assertEqual(u.norm_squared(), sum((x.norm_squared() for x in a), Fraction(0)))
+            self.assertEqual(u.norms_squared(), [x.norm_squared() for x in a])
+
+            changes = {0: random_amplitude(self.rng), 5: ComplexFraction(Fraction(1, 7), 0)}
+            replaced = list(a)
+            for i, value in changes.items():
+                replaced[i] = value
+            self.assertAmplitudesEqual(u.replace(changes), replaced)
+            self.assertAmplitudesEqual(u, a)
+
+            reduced = u.scale(6).scale(Fraction(1, 6)).reduce()
+            self.assertAmplitudesEqual(reduced, a)
+            self.assertEqual(reduced.denominator, u.reduce().denominator)
+
+    def check_sectors(self, field_class, size, sectors):
+        """Each (sector, reference energy, reference gradient) on random fields."""
+        for _ in range(TRIALS):
+            amplitudes = self.random_amplitudes(size)
+            psi = field_class(list(amplitudes))
+            v = ExactFieldVector.from_amplitudes(amplitudes)
+            for sector, energy, gradient in sectors:
+                self.assertEqual(sector.energy(psi), energy(amplitudes))
+                self.assertEqual(sector.energy(v), energy(amplitudes))
+                self.assertEqual(sector.gradient(psi).amplitudes, gradient(amplitudes))
+                self.assertAmplitudesEqual(sector.gradient(v), gradient(amplitudes))
+
+    def test_e8_sectors(self):
+        """E8 uniform norm and conservation sectors match the Fraction sectors."""
+        sectors = []
+        for weight in (Fraction(1), Fraction(3, 7), Fraction(0)):
+            sectors.append((E8UniformNormSector(weight),
+                            lambda a, w=weight: reference_norm_energy(a, w, [Fraction(2)]),
+                            lambda a, w=weight: reference_norm_gradient(a, w, [Fraction(2)])))
+            sectors.append((E8EnergyConservationSector(weight),
+                            lambda a, w=weight: reference_total_energy(a, w, Fraction(480)),
+                            lambda a, w=weight: reference_total_gradient(a, w, Fraction(480))))
+        self.check_sectors(E8QuotientField, 240, sectors)
+
+    def test_f4_sectors(self):
+        """F4 norm quantization and conservation sectors match the Fraction sectors."""
+        targets = [Fraction(1), Fraction(2)]
+        sectors = []
+        for weight in (Fraction(1), Fraction(2, 3), Fraction(0)):
+            sectors.append((NormQuantizationSector(weight),
+                            lambda a, w=weight: reference_norm_energy(a, w, targets),
+                            lambda a, w=weight: reference_norm_gradient(a, w, targets)))
+            sectors.append((EnergyConservationSector(weight),
+                            lambda a, w=weight: reference_total_energy(a, w, Fraction(72)),
+                            lambda a, w=weight: reference_total_gradient(a, w, Fraction(72))))
+        self.check_sectors(F4QuotientField, 48, sectors)
+
+    def test_actions(self):
+        """Total E8 and F4 actions match the summed Fraction sectors."""
+        cases = (
+            (E8RootAction(E8ActionWeights(lambda_uniform_norm=Fraction(5, 3))), E8QuotientField, 240,
+             [Fraction(2)], Fraction(5, 3), Fraction(480), Fraction(1)),
+            (F4RootAction(F4ActionWeights(lambda_energy_conservation=Fraction(1, 4))), F4QuotientField, 48,
+             [Fraction(1), Fraction(2)], Fraction(1), Fraction(72), Fraction(1, 4)),
+        )
+        for action, field_class, size, targets, norm_weight, total, total_weight in cases:
+            for _ in range(TRIALS):
+                amplitudes = self.random_amplitudes(size)
+                psi = field_class(list(amplitudes))
+                energy = (reference_norm_energy(amplitudes, norm_weight, targets)
+                          + reference_total_energy(amplitudes, total_weight, total))
+                gradient = add_amplitudes(reference_norm_gradient(amplitudes, norm_weight, targets),
+                                          reference_total_gradient(amplitudes, total_weight, total))
+                self.assertEqual(action.energy(psi), energy)
+                self.assertEqual(action.gradient(psi).amplitudes, gradient)
+                fused_energy, fused_gradient = action.evaluate(psi)
+                self.assertEqual(fused_energy, energy)
+                self.assertEqual(fused_gradient.amplitudes, gradient)
+
+    def test_large_numerators(self):
+        """Quartic sector terms stay exact far beyond 64-bit numerators."""
+        big = Fraction(3 ** 40 + 1, 7 ** 20)
+        amplitudes = [ComplexFraction(big, -big)] + self.random_amplitudes(47)
+        psi = F4QuotientField(list(amplitudes))
+        sector = NormQuantizationSector(Fraction(1))
+        targets = [Fraction(1), Fraction(2)]
+        self.assertEqual(sector.energy(psi), reference_norm_energy(amplitudes, Fraction(1), targets))
+        self.assertEqual(sector.gradient(psi).amplitudes,
+                         reference_norm_gradient(amplitudes, Fraction(1), targets))
+
+
+class TestListBackend(BackendCase, unittest.TestCase):
+    """Plain Python lists of int."""
+
+
+@unittest.skipIf(numpy is None, "numpy not installed")
+class TestNumpyBackend(BackendCase, unittest.TestCase):
+    """numpy object arrays of int."""
+
+    numpy_module = numpy
+
+
+@unittest.skipIf(gmpy2 is None, "gmpy2 not installed")
+class TestGmpy2Backend(BackendCase, unittest.TestCase):
+    """Plain lists of gmpy2 mpz."""
+
+    integer_type = gmpy2.mpz if gmpy2 is not None else int
+
+
+@unittest.skipIf(numpy is None or gmpy2 is None, "numpy or gmpy2 not installed")
+class TestNumpyGmpy2Backend(BackendCase, unittest.TestCase):
+    """numpy object arrays of gmpy2 mpz."""
+
+    numpy_module = numpy
+    integer_type = gmpy2.mpz if gmpy2 is not None else int
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,160 @@
+"""
+Tests for the fused norm action and its incremental re-evaluation (EXACT).
+
+Run from working/: python3 -m unittest discover -s action_framework/tests -t .
+"""
+import random
+import unittest
+from fractions import Fraction
+
+from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import ExactFieldVector
+from action_framework.core.quotient_field import E8QuotientField, F4QuotientField
+from action_framework.sectors.e8_root_action import E8RootAction, E8ActionWeights
+from action_framework.sectors.f4_root_action import F4RootAction, F4ActionWeights
+
+SEED = 20261014
+TRIALS = 8
+
+
+def random_amplitude(rng: random.Random, denominators=(1, 2, 3, 4, 6)) -> ComplexFraction:
+    """Random exact amplitude with small numerators."""
+    return ComplexFraction(Fraction(rng.randint(-9, 9), rng.choice(denominators)),
+                           Fraction(rng.randint(-9, 9), rng.choice(denominators)))
+
+
+def random_changes(rng: random.Random, size: int, count: int, denominators) -> dict:
+    """Replacements for `count` distinct random amplitudes."""
+    return {i: random_amplitude(rng, denominators) for i in rng.sample(range(size), count)}
+
+
+class FusedActionCase:
+    """Shared checks; subclasses set size, field_class and make_actions()."""
+
+    size = 0
+    field_class = None
+
+    def make_actions(self):
+        raise NotImplementedError
+
+    def setUp(self):
+        self.rng = random.Random(SEED)
+
+    def random_field(self):
+        return self.field_class([random_amplitude(self.rng) for _ in range(self.size)])
+
+    def test_evaluate_matches_sectors(self):
+        """evaluate() equals the sum of the separate sector results."""
+        for action in self.make_actions():
+            for _ in range(TRIALS):
+                psi = self.random_field()
+                energy, grad = action.evaluate(psi)
+                self.assertEqual(energy, action.energy(psi))
+                self.assertEqual(ExactFieldVector.from_field(grad),
+                                 ExactFieldVector.from_field(action.gradient(psi)))
+
+    def test_evaluate_accepts_vectors(self):
+        """A vector in gives a vector out, with the same values."""
+        action = self.make_actions()[0]
+        psi = self.random_field()
+        energy, grad = action.evaluate(ExactFieldVector.from_field(psi))
+        self.assertIsInstance(grad, ExactFieldVector)
+        self.assertEqual(energy, action.energy(psi))
+        self.assertEqual(grad, ExactFieldVector.from_field(action.gradient(psi)))
+
+    def check_update(self, denominators):
+        for action in self.make_actions():
+            psi = self.random_field()
+            state = action.state(psi)
+            amplitudes = list(psi.amplitudes)
+            for _ in range(TRIALS):
+                changes = random_changes(self.rng, self.size, self.rng.randint(1, 4), denominators)
+                state.update(changes)
+                for i, value in changes.items():
+                    amplitudes[i] = value
+                expected = self.field_class(list(amplitudes))
+                self.assertEqual(state.energy, action.energy(expected))
+                self.assertEqual(state.gradient(),
+                                 ExactFieldVector.from_field(action.gradient(expected)))
+                self.assertEqual(state.psi, ExactFieldVector.from_field(expected))
+
+    def test_update_same_denominator(self):
+        """Updates within the shared denominator match full re-evaluation."""
+        # Every random field has denominator 12 with overwhelming likelihood
+        self.check_update((1, 2, 3, 4, 6))
+
+    def test_update_new_denominator(self):
+        """Updates that grow the shared denominator match full re-evaluation."""
+        self.check_update((5, 7, 10))
+
+    def check_energy_with(self, denominators):
+        for action in self.make_actions():
+            psi = self.random_field()
+            state = action.state(psi)
+            before = (state.energy, state.gradient(), state.psi)
+            for _ in range(TRIALS):
+                changes = random_changes(self.rng, self.size, self.rng.randint(1, 4), denominators)
+                trial = psi.copy()
+                for i, value in changes.items():
+                    trial[i] = value
+                self.assertEqual(state.energy_with(changes), action.energy(trial))
+            self.assertEqual((state.energy, state.gradient(), state.psi), before)
+
+    def test_energy_with_same_denominator(self):
+        """energy_with() matches full re-evaluation and leaves the state alone."""
+        self.check_energy_with((1, 2, 3, 4, 6))
+
+    def test_energy_with_new_denominator(self):
+        """energy_with() falls back to a full pass for a new denominator."""
+        self.check_energy_with((5, 7, 10))
+
+    def test_energy_with_restoring_change(self):
+        """Putting back the current amplitudes gives the current energy."""
+        action = self.make_actions()[0]
+        psi = self.random_field()
+        state = action.state(psi)
+        self.assertEqual(state.energy_with({0: psi[0], 1: psi[1]}), state.energy)
+
+
+class TestFusedE8Action(FusedActionCase, unittest.TestCase):
+    """Uniform norm² = 2 and total 480, one target."""
+
+    size = 240
+    field_class = E8QuotientField
+
+    def make_actions(self):
+        return [
+            E8RootAction(E8ActionWeights()),
+            E8RootAction(E8ActionWeights(lambda_uniform_norm=Fraction(3, 7),
+                                         lambda_energy_conservation=Fraction(5, 2))),
+            E8RootAction(E8ActionWeights(lambda_uniform_norm=Fraction(0))),
+            E8RootAction(E8ActionWeights(lambda_energy_conservation=Fraction(0))),
+        ]
+
+
+class TestFusedF4Action(FusedActionCase, unittest.TestCase):
+    """Norm² nearest of {1, 2} and total 72, two targets."""
+
+    size = 48
+    field_class = F4QuotientField
+
+    def make_actions(self):
+        return [
+            F4RootAction(F4ActionWeights()),
+            F4RootAction(F4ActionWeights(lambda_norm_quantization=Fraction(2, 3),
+                                         lambda_energy_conservation=Fraction(1, 5))),
+            F4RootAction(F4ActionWeights(lambda_norm_quantization=Fraction(0))),
+            F4RootAction(F4ActionWeights(lambda_energy_conservation=Fraction(0))),
+        ]
+
+    def test_deviation_matches_deviations(self):
+        """The per-amplitude deviation used by update() agrees with the array one."""
+        action = self.make_actions()[0].fused
+        v = ExactFieldVector.from_field(self.random_field())
+        norms, deviations, _ = action.deviations(v)
+        self.assertEqual([action.deviation(int(n), v.denominator) for n in norms],
+                         [int(x) for x in deviations])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -16,6 +16,7 @@ Standard normalization: all roots have norm² = 2
 from fractions import Fraction
 from action_framework.core.quotient_field import E8QuotientField
 from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import as_vector
 from action_framework.sectors.e8_root_action import E8RootAction, E8ActionWeights
 from action_framework.loaders.e8_loader import load_e8_canonical
 
@@ -41,8 +42,11 @@ def verify_e8_is_critical_point(
         print("E₈ CRITICAL POINT VERIFICATION (EXACT)")
         print("=" * 70)
 
-    # Compute energy (should be 0 for correct config)
-    E = action.energy(psi)
+    # Evaluate on the integer field vector: one conversion, no per-root Fractions
+    psi = as_vector(psi)
+
+    # Energy (should be 0) and gradient in one fused pass
+    E, grad = action.evaluate(psi)
     if verbose:
         print(f"\n1. Energy E = {E}")
         if E == Fraction(0):
@@ -50,20 +54,12 @@ def verify_e8_is_critical_point(
         else:
             print(f"   ✗ Energy is {E}, not zero")
 
-    # Compute gradient (should be exactly zero for all 240 components)
-    grad = action.gradient(psi)
     if verbose:
         print("\n2. Gradient ∂S/∂ψ check:")
 
-    # Check each component exactly
-    zero_components = 0
-    nonzero_components = []
-
-    for i in range(240):
-        if grad[i] == ComplexFraction.zero():
-            zero_components += 1
-        else:
-            nonzero_components.append((i, grad[i]))
+    # Check each component exactly (integer numerators against zero)
+    nonzero_components = [(i, grad[i]) for i in grad.nonzero_indices()]
+    zero_components = 240 - len(nonzero_components)
 
     if verbose:
         print(f"   Zero components: {zero_components}/240")
@@ -135,6 +131,44 @@ def verify_e8_is_critical_point(
     return is_stationary and E == Fraction(0)
 
 
+def verify_e8_perturbation_stability(
+    psi,
+    action,
+    epsilon: Fraction = Fraction(1, 10),
+    verbose: bool = True
+) -> bool:
+    """
+    Verify every single-amplitude perturbation strictly raises the energy.
+
+    Each of the 240 amplitudes is moved by ±ε and ±εi in turn. The fused
+    action state re-evaluates only the moved amplitude, so the 960
+    trial energies cost no more than a few full evaluations.
+
+    Returns:
+        True if every perturbed energy exceeds the unperturbed one (EXACT)
+    """
+    state = action.state(psi)
+    E0 = state.energy
+    deltas = [ComplexFraction(epsilon, 0), ComplexFraction(-epsilon, 0),
+              ComplexFraction(0, epsilon), ComplexFraction(0, -epsilon)]
+
+    failures = []
+    for i in range(240):
+        amplitude = state.psi[i]
+        for delta in deltas:
+            if state.energy_with({i: amplitude + delta}) <= E0:
+                failures.append((i, delta))
+
+    if verbose:
+        print("\n5. Perturbation check (ε = " + str(epsilon) + "):")
+        if failures:
+            print(f"   ✗ {len(failures)}/960 perturbations do not raise the energy")
+        else:
+            print(f"   ✓ All 960 single-amplitude perturbations raise the energy")
+
+    return not failures
+
+
 if __name__ == '__main__':
     print("E₈ Critical Point Verification Test\n")
 
@@ -157,7 +191,8 @@ if __name__ == '__main__':
 
     # Verify critical point
     is_critical = verify_e8_is_critical_point(psi_e8, action, verbose=True)
+    is_stable = verify_e8_perturbation_stability(psi_e8, action, verbose=True)
 
     # Exit code
     import sys
-    sys.exit(0 if is_critical else 1)
+    sys.exit(0 if is_critical and is_stable else 1)
@@ -12,6 +12,7 @@ RECOGNIZES the F₄ structure.
 from fractions import Fraction
 from action_framework.core.quotient_field import F4QuotientField
 from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.field_vector import as_vector
 from action_framework.sectors.f4_root_action import F4RootAction, F4ActionWeights
 from action_framework.loaders.f4_loader import load_f4_canonical
 
@@ -37,8 +38,11 @@ def verify_f4_is_critical_point(
         print("F₄ CRITICAL POINT VERIFICATION (EXACT)")
         print("=" * 70)
 
-    # Compute energy (should be 0 for correct config)
-    E = action.energy(psi)
+    # Evaluate on the integer field vector: one conversion, no per-root Fractions
+    psi = as_vector(psi)
+
+    # Energy (should be 0) and gradient in one fused pass
+    E, grad = action.evaluate(psi)
     if verbose:
         print(f"\n1. Energy E = {E}")
         if E == Fraction(0):
@@ -46,20 +50,12 @@ def verify_f4_is_critical_point(
         else:
             print(f"   ✗ Energy is {E}, not zero")
 
-    # Compute gradient (should be exactly zero for all 48 components)
-    grad = action.gradient(psi)
     if verbose:
         print("\n2. Gradient ∂S/∂ψ check:")
 
-    # Check each component exactly
-    zero_components = 0
-    nonzero_components = []
-
-    for i in range(48):
-        if grad[i] == ComplexFraction.zero():
-            zero_components += 1
-        else:
-            nonzero_components.append((i, grad[i]))
+    # Check each component exactly (integer numerators against zero)
+    nonzero_components = [(i, grad[i]) for i in grad.nonzero_indices()]
+    zero_components = 48 - len(nonzero_components)
 
     if verbose:
         print(f"   Zero components: {zero_components}/48")
@@ -128,6 +124,44 @@ def verify_f4_is_critical_point(
     return is_stationary and E == Fraction(0)
 
 
+def verify_f4_perturbation_stability(
+    psi,
+    action,
+    epsilon: Fraction = Fraction(1, 10),
+    verbose: bool = True
+) -> bool:
+    """
+    Verify every single-amplitude perturbation strictly raises the energy.
+
+    Each of the 48 amplitudes is moved by ±ε and ±εi in turn. The fused
+    action state re-evaluates only the moved amplitude, so the 192
+    trial energies cost no more than a few full evaluations.
+
+    Returns:
+        True if every perturbed energy exceeds the unperturbed one (EXACT)
+    """
+    state = action.state(psi)
+    E0 = state.energy
+    deltas = [ComplexFraction(epsilon, 0), ComplexFraction(-epsilon, 0),
+              ComplexFraction(0, epsilon), ComplexFraction(0, -epsilon)]
+
+    failures = []
+    for i in range(48):
+        amplitude = state.psi[i]
+        for delta in deltas:
+            if state.energy_with({i: amplitude + delta}) <= E0:
+                failures.append((i, delta))
+
+    if verbose:
+        print("\n5. Perturbation check (ε = " + str(epsilon) + "):")
+        if failures:
+            print(f"   ✗ {len(failures)}/192 perturbations do not raise the energy")
+        else:
+            print(f"   ✓ All 192 single-amplitude perturbations raise the energy")
+
+    return not failures
+
+
 if __name__ == '__main__':
     print("F₄ Critical Point Verification Test\n")
 
@@ -150,7 +184,8 @@ if __name__ == '__main__':
 
     # Verify critical point
     is_critical = verify_f4_is_critical_point(psi_f4, action, verbose=True)
+    is_stable = verify_f4_perturbation_stability(psi_f4, action, verbose=True)
 
     # Exit code
     import sys
-    sys.exit(0 if is_critical else 1)
+    sys.exit(0 if is_critical and is_stable else 1)
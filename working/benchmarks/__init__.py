@@ -0,0 +1,20 @@
+"""
+Benchmarks for the working/ research pipelines.
+
+Run from working/:
+
+    python3 -m benchmarks                      # every fast benchmark
+    python3 -m benchmarks search weyl          # names containing a filter
+    python3 -m benchmarks --count-arithmetic   # also count Fraction/gcd use
+    python3 -m benchmarks --save before.json
+    python3 -m benchmarks --compare before.json
+"""
+from .harness import (
+    SEED,
+    Benchmark,
+    BenchmarkResult,
+    ArithmeticCounter,
+    benchmark,
+    registered,
+    run_benchmark,
+)
@@ -0,0 +1,46 @@
+"""
+Command line entry point: python3 -m benchmarks [filters...] [options]
+"""
+import argparse
+import sys
+
+from .harness import load_results, print_report, registered, run_benchmark, save_results
+from . import suite  # noqa: F401  (registers the benchmarks)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description="Time the research pipeline stages.")
+    parser.add_argument("filters", nargs="*",
+                        help="Only run benchmarks whose stage/name contains one of these")
+    parser.add_argument("--count-arithmetic", action="store_true",
+                        help="Count Fraction constructions and gcd calls per benchmark")
+    parser.add_argument("--slow", action="store_true", help="Include slow benchmarks")
+    parser.add_argument("--rounds", type=int, help="Override the timed rounds per benchmark")
+    parser.add_argument("--list", action="store_true", help="List benchmarks and exit")
+    parser.add_argument("--save", metavar="PATH", help="Write results as JSON")
+    parser.add_argument("--compare", metavar="PATH", help="Compare medians with saved results")
+    args = parser.parse_args(argv)
+
+    benches = registered(args.filters, include_slow=args.slow)
+    if args.list:
+        for bench in benches:
+            print(f"{bench.full_name}{'  (slow)' if bench.slow else ''}")
+        return 0
+    if not benches:
+        print("No benchmarks match")
+        return 1
+
+    baseline = load_results(args.compare) if args.compare else None
+    results = []
+    for bench in benches:
+        print(f"Running {bench.full_name}...", file=sys.stderr)
+        results.append(run_benchmark(bench, args.count_arithmetic, args.rounds))
+
+    print_report(results, baseline)
+    if args.save:
+        save_results(results, args.save)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
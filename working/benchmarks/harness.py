@@ -0,0 +1,268 @@
+"""
+Benchmark harness - timing and exact-arithmetic instrumentation.
+
+Benchmarks register with @benchmark(stage, name). Each one has an untimed
+setup that builds its inputs and a body that is timed over a fixed number
+of rounds after one warm-up call. Problem sizes and random seeds are
+fixed in the suite, so two runs measure the same work.
+
+Times are integer nanoseconds from time.perf_counter_ns; the report
+formats them without converting to floats.
+
+Opt-in instrumentation (ArithmeticCounter) runs the body one more time,
+untimed, and counts:
+- Fraction constructions (Fraction.__new__, plus _from_coprime_ints
+  where the interpreter has it)
+- gcd calls (math.gcd, including modules that did `from math import gcd`)
+The counts show whether a change such as an integer backend really removes
+rational arithmetic from a stage. Counting slows the body down, which is
+why it never overlaps a timed round.
+"""
+import json
+import math
+import sys
+import time
+from dataclasses import dataclass, field
+from fractions import Fraction
+from typing import Any, Callable, Dict, List, Optional
+
+# Every seeded benchmark draws from random.Random(SEED)
+SEED = 20240101
+
+
+@dataclass
+class Benchmark:
+    """A registered benchmark."""
+    stage: str
+    name: str
+    body: Callable[[Any], Any]
+    setup: Optional[Callable[[], Any]] = None
+    rounds: int = 5
+    # Skipped unless slow benchmarks are requested
+    slow: bool = False
+
+    @property
+    def full_name(self) -> str:
+        return f"{self.stage}/{self.name}"
+
+
+@dataclass
+class BenchmarkResult:
+    """Timings of one benchmark, in integer nanoseconds."""
+    full_name: str
+    stage: str
+    times_ns: List[int]
+    fractions: Optional[int] = None
+    gcd_calls: Optional[int] = None
+
+    @property
+    def min_ns(self) -> int:
+        return min(self.times_ns)
+
+    @property
+    def median_ns(self) -> int:
+        ordered = sorted(self.times_ns)
+        return ordered[len(ordered) // 2]
+
+    @property
+    def mean_ns(self) -> int:
+        return sum(self.times_ns) // len(self.times_ns)
+
+    def to_dict(self) -> Dict[str, Any]:
+        return {
+            "stage": self.stage,
+            "times_ns": self.times_ns,
+            "min_ns": self.min_ns,
+            "median_ns": self.median_ns,
+            "fractions": self.fractions,
+            "gcd_calls": self.gcd_calls,
+        }
+
+
+_registry: List[Benchmark] = []
+
+
+def benchmark(stage: str, name: str, setup: Optional[Callable[[], Any]] = None,
+              rounds: int = 5, slow: bool = False) -> Callable:
+    """
+    Register a benchmark body.
+
+    Args:
+        stage: Pipeline stage (search, weyl, critical_point, ...)
+        name: Benchmark name within the stage
+        setup: Untimed builder whose result is passed to the body
+        rounds: Timed rounds
+        slow: Only run when slow benchmarks are requested
+
+    Returns:
+        Decorator that registers the body and returns it unchanged
+    """
+    def register(body: Callable[[Any], Any]) -> Callable[[Any], Any]:
+        _registry.append(Benchmark(stage, name, body, setup, rounds, slow))
+        return body
+    return register
+
+
+def registered(filters: Optional[List[str]] = None, include_slow: bool = False) -> List[Benchmark]:
+    """
+    Registered benchmarks, in registration order.
+
+    Args:
+        filters: Keep benchmarks whose full name contains any of these
+        include_slow: Keep slow benchmarks too
+
+    Returns:
+        Selected benchmarks
+    """
+    selected = []
+    for bench in _registry:
+        if bench.slow and not include_slow:
+            continue
+        if filters and not any(f in bench.full_name for f in filters):
+            continue
+        selected.append(bench)
+    return selected
+
+
+class ArithmeticCounter:
+    """
+    Count Fraction constructions and gcd calls inside a with-block.
+
+    Patches fractions.Fraction and math.gcd for the duration of the block
+    and restores them on exit. Not thread-safe; worker processes started
+    inside the block are not counted.
+    """
+
+    def __init__(self):
+        self.fractions = 0
+        self.gcd_calls = 0
+        self._restore: List[Callable[[], None]] = []
+
+    def __enter__(self) -> 'ArithmeticCounter':
+        counter = self
+
+        original_new = Fraction.__dict__["__new__"]
+        new = original_new.__func__
+
+        def counting_new(cls, *args, **kwargs):
+            counter.fractions += 1
+            return new(cls, *args, **kwargs)
+
+        Fraction.__new__ = staticmethod(counting_new)
+        self._restore.append(lambda: setattr(Fraction, "__new__", original_new))
+
+        if "_from_coprime_ints" in Fraction.__dict__:
+            original_coprime = Fraction.__dict__["_from_coprime_ints"]
+            coprime = original_coprime.__func__
+
+            def counting_coprime(cls, numerator, denominator):
+                counter.fractions += 1
+                return coprime(cls, numerator, denominator)
+
+            Fraction._from_coprime_ints = classmethod(counting_coprime)
+            self._restore.append(lambda: setattr(Fraction, "_from_coprime_ints", original_coprime))
+
+        original_gcd = math.gcd
+
+        def counting_gcd(*args):
+            counter.gcd_calls += 1
+            return original_gcd(*args)
+
+        # Modules that imported the name directly hold their own reference
+        holders = [module for module in list(sys.modules.values())
+                   if getattr(module, "gcd", None) is original_gcd]
+        for module in holders:
+            module.gcd = counting_gcd
+        self._restore.append(lambda: [setattr(module, "gcd", original_gcd) for module in holders])
+        return self
+
+    def __exit__(self, *exc_info) -> None:
+        while self._restore:
+            self._restore.pop()()
+
+
+def run_benchmark(bench: Benchmark, count_arithmetic: bool = False,
+                  rounds: Optional[int] = None) -> BenchmarkResult:
+    """
+    Set up, warm up and time one benchmark.
+
+    Args:
+        bench: The benchmark
+        count_arithmetic: Also count Fraction and gcd use in one extra call
+        rounds: Override the benchmark's round count
+
+    Returns:
+        BenchmarkResult
+    """
+    context = bench.setup() if bench.setup is not None else None
+    bench.body(context)
+
+    times = []
+    for _ in range(rounds or bench.rounds):
+        start = time.perf_counter_ns()
+        bench.body(context)
+        times.append(time.perf_counter_ns() - start)
+
+    result = BenchmarkResult(bench.full_name, bench.stage, times)
+    if count_arithmetic:
+        with ArithmeticCounter() as counter:
+            bench.body(context)
+        result.fractions = counter.fractions
+        result.gcd_calls = counter.gcd_calls
+    return result
+
+
+def format_ns(ns: int) -> str:
+    """Nanoseconds as milliseconds with three decimals (integer arithmetic)."""
+    return f"{ns // 1_000_000}.{ns // 1_000 % 1_000:03d} ms"
+
+
+def format_change(old: int, new: int) -> str:
+    """Signed percentage change from old to new, rounded towards zero."""
+    if old == 0:
+        return "n/a"
+    change = (new - old) * 100
+    percent = abs(change) // old
+    return f"{'-' if change < 0 else '+'}{percent}%"
+
+
+def print_report(results: List[BenchmarkResult],
+                 baseline: Optional[Dict[str, Dict[str, Any]]] = None) -> None:
+    """
+    Print one line per benchmark, then per-stage instrumentation totals.
+
+    Args:
+        results: Benchmark results
+        baseline: Results loaded by load_results, to compare medians against
+    """
+    width = max((len(r.full_name) for r in results), default=0)
+    for r in results:
+        line = f"{r.full_name:<{width}}  min {format_ns(r.min_ns):>14}  median {format_ns(r.median_ns):>14}"
+        if r.fractions is not None:
+            line += f"  fractions {r.fractions:>10}  gcd {r.gcd_calls:>10}"
+        if baseline is not None and r.full_name in baseline:
+            line += f"  ({format_change(baseline[r.full_name]['median_ns'], r.median_ns)} median)"
+        print(line)
+
+    counted = [r for r in results if r.fractions is not None]
+    if counted:
+        print("\nPer stage:")
+        stages: Dict[str, List[int]] = {}
+        for r in counted:
+            totals = stages.setdefault(r.stage, [0, 0])
+            totals[0] += r.fractions
+            totals[1] += r.gcd_calls
+        for stage, (fractions, gcd_calls) in stages.items():
+            print(f"  {stage:<16} fractions {fractions:>10}  gcd {gcd_calls:>10}")
+
+
+def save_results(results: List[BenchmarkResult], path: str) -> None:
+    """Write results for a later --compare run."""
+    with open(path, "w") as f:
+        json.dump({"seed": SEED, "results": {r.full_name: r.to_dict() for r in results}}, f, indent=2)
+
+
+def load_results(path: str) -> Dict[str, Dict[str, Any]]:
+    """Results written by save_results, keyed by benchmark name."""
+    with open(path, "r") as f:
+        return json.load(f)["results"]
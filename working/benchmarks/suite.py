@@ -0,0 +1,208 @@
+"""
+Benchmark suite for the research pipelines.
+
+Stages and fixed problem sizes:
+- search: bitset search with max_solutions 1, 100 and 10,000; the
+  exhaustive depth-2 split of the symmetry-broken search; the legacy
+  search (slow)
+- weyl: W(F₄), W(E₆), W(E₇) and W(E₈) orders via Schreier–Sims
+- critical_point: E₈ action energy and gradient, fused and per sector,
+  on the canonical field and on a seeded random field; the F₄ and E₈
+  critical-point and perturbation checks
+- certificate: generation, single verification, batch verification
+- quotient: sign-class quotient graph construction and analysis
+
+Inputs that do not depend on the benchmark (Atlas graph, E₈ roots, one
+embedding) are built once, untimed, and shared.
+"""
+import os
+import random
+import sys
+from fractions import Fraction
+from functools import lru_cache
+
+sys.path.append(os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "tier_a_embedding"))
+
+from atlas import AtlasGraph
+from e8 import E8RootSystem
+from e8.weyl import WeylGroup, e8_weyl_group
+from embedding import BitsetEmbeddingSearch, EmbeddingSearch, EmbeddingConstraints, SymmetryBrokenSearch
+from certificate import create_certificate, CertificateVerifier, BatchCertificateVerifier
+import certificate.batch
+from analysis.quotient_structure import QuotientAnalyzer, analyze_quotient_properties
+
+from action_framework.core.exact_arithmetic import ComplexFraction
+from action_framework.core.quotient_field import E8QuotientField
+from action_framework.loaders.e8_loader import load_e8_canonical
+from action_framework.loaders.f4_loader import load_f4_canonical
+from action_framework.sectors.e8_root_action import E8RootAction, E8ActionWeights
+from action_framework.sectors.f4_root_action import F4RootAction, F4ActionWeights
+from action_framework.verification.e8_critical_point import verify_e8_perturbation_stability
+from action_framework.verification.f4_critical_point import verify_f4_is_critical_point
+
+from .harness import SEED, benchmark
+
+# Standard F₄ simple roots (as in exceptional_groups/f4/weyl_generators.py)
+F4_SIMPLE_ROOTS = [
+    (Fraction(0), Fraction(1), Fraction(-1), Fraction(0)),
+    (Fraction(0), Fraction(0), Fraction(1), Fraction(-1)),
+    (Fraction(0), Fraction(0), Fraction(0), Fraction(1)),
+    (Fraction(1, 2), Fraction(-1, 2), Fraction(-1, 2), Fraction(-1, 2)),
+]
+
+
+@lru_cache(maxsize=None)
+def structures():
+    """Atlas graph, E₈ root system and one embedding, shared by every stage."""
+    atlas = AtlasGraph()
+    e8 = E8RootSystem()
+    mapping = BitsetEmbeddingSearch(atlas, e8).search(EmbeddingConstraints(max_solutions=1))[0]
+    return atlas, e8, mapping
+
+
+# ---------------------------------------------------------------- search
+
+def _search(max_solutions: int):
+    def body(context):
+        atlas, e8, _ = context
+        solutions = BitsetEmbeddingSearch(atlas, e8).search(EmbeddingConstraints(max_solutions=max_solutions))
+        assert len(solutions) == max_solutions
+    return body
+
+
+for _size in (1, 100, 10_000):
+    benchmark("search", f"bitset_max_{_size}", setup=structures,
+              rounds=3 if _size == 10_000 else 5)(_search(_size))
+
+
+@benchmark("search", "symmetry_broken_split_2", setup=structures, rounds=3)
+def _split(context):
+    atlas, e8, _ = context
+    assert len(SymmetryBrokenSearch(atlas, e8).split(2)) == 6720
+
+
+@benchmark("search", "legacy_max_1", setup=structures, rounds=1, slow=True)
+def _legacy_search(context):
+    atlas, e8, _ = context
+    assert EmbeddingSearch(atlas, e8).search(EmbeddingConstraints(max_solutions=1))
+
+
+# ------------------------------------------------------------------ weyl
+
+@benchmark("weyl", "f4_order")
+def _weyl_f4(context):
+    assert WeylGroup.from_simple_roots(F4_SIMPLE_ROOTS).order() == 1152
+
+
+def _weyl_e(rank: int, order: int):
+    def body(context):
+        assert e8_weyl_group(context, rank).order() == order
+    return body
+
+
+for _rank, _order in ((6, 51_840), (7, 2_903_040), (8, 696_729_600)):
+    benchmark("weyl", f"e{_rank}_order", setup=lambda: structures()[1].roots,
+              rounds=3)(_weyl_e(_rank, _order))
+
+
+# -------------------------------------------------------- critical_point
+
+def _e8_action():
+    return E8RootAction(E8ActionWeights(
+        lambda_uniform_norm=Fraction(1),
+        lambda_energy_conservation=Fraction(1),
+        lambda_simply_laced=Fraction(0),
+    ))
+
+
+def _e8_canonical():
+    return _e8_action(), load_e8_canonical()
+
+
+def _e8_random():
+    """Seeded field with small-denominator amplitudes, far from critical."""
+    rng = random.Random(SEED)
+    amplitudes = [
+        ComplexFraction(Fraction(rng.randint(-20, 20), rng.randint(1, 6)),
+                        Fraction(rng.randint(-20, 20), rng.randint(1, 6)))
+        for _ in range(240)
+    ]
+    return _e8_action(), E8QuotientField(amplitudes)
+
+
+def _fused(context):
+    action, psi = context
+    action.evaluate(psi)
+
+
+def _sectors(context):
+    action, psi = context
+    action.energy(psi)
+    action.gradient(psi)
+
+
+benchmark("critical_point", "e8_action_fused", setup=_e8_canonical)(_fused)
+benchmark("critical_point", "e8_action_sectors", setup=_e8_canonical)(_sectors)
+benchmark("critical_point", "e8_action_fused_random", setup=_e8_random)(_fused)
+benchmark("critical_point", "e8_action_sectors_random", setup=_e8_random)(_sectors)
+
+
+def _f4_canonical():
+    action = F4RootAction(F4ActionWeights(
+        lambda_norm_quantization=Fraction(1),
+        lambda_energy_conservation=Fraction(1),
+        lambda_orthogonality=Fraction(0),
+    ))
+    return action, load_f4_canonical()
+
+
+@benchmark("critical_point", "f4_verify", setup=_f4_canonical)
+def _f4_verify(context):
+    action, psi = context
+    assert verify_f4_is_critical_point(psi, action, verbose=False)
+
+
+@benchmark("critical_point", "e8_perturbation_stability", setup=_e8_canonical, rounds=3)
+def _e8_stability(context):
+    action, psi = context
+    assert verify_e8_perturbation_stability(psi, action, verbose=False)
+
+
+# ----------------------------------------------------------- certificate
+
+def _certificate_json():
+    atlas, e8, mapping = structures()
+    return create_certificate(mapping, atlas, e8)
+
+
+@benchmark("certificate", "generate", setup=structures)
+def _generate(context):
+    atlas, e8, mapping = context
+    create_certificate(mapping, atlas, e8)
+
+
+@benchmark("certificate", "verify", setup=_certificate_json, rounds=3)
+def _verify(cert_json):
+    assert CertificateVerifier().verify(cert_json)[0]
+
+
+@benchmark("certificate", "verify_batch_20", setup=_certificate_json, rounds=3)
+def _verify_batch(cert_json):
+    # Include the one-off context build in every round
+    certificate.batch._contexts.clear()
+    outcomes = BatchCertificateVerifier(processes=1).verify_strings([cert_json] * 20)
+    assert all(o.valid for o in outcomes)
+
+
+# -------------------------------------------------------------- quotient
+
+@benchmark("quotient", "build_graph", setup=structures)
+def _quotient_graph(context):
+    atlas, e8, mapping = context
+    QuotientAnalyzer(mapping, atlas, e8).build_quotient_graph()
+
+
+@benchmark("quotient", "analyze_properties", setup=structures)
+def _quotient_properties(context):
+    atlas, e8, mapping = context
+    analyze_quotient_properties(mapping, atlas, e8)
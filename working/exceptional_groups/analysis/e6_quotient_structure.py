@@ -12,6 +12,7 @@ from typing import Set, Dict, Tuple, List
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 
 from tier_a_embedding import AtlasGraph, E8RootSystem
+from tier_a_embedding.analysis.orbits import OrbitPartition, OrbitQuotient
 from exceptional_groups.e6.first_principles_construction import E6FirstPrinciplesConstruction
 
 
@@ -22,21 +23,14 @@ def build_e6_quotient_graph(atlas: AtlasGraph, e6_vertices: Set[int]) -> Dict:
     E₆ = 72 vertices = 36 mirror pairs
     → E₆ quotient = 36 sign classes
     """
-    # Find mirror pairs within E₆
-    mirror_pairs = []
-    seen = set()
+    # Mirror pairs: orbits of τ on the Atlas vertices
+    mirror = OrbitPartition([atlas.tau], len(atlas.labels))
 
-    for v in e6_vertices:
-        if v in seen:
-            continue
-
-        mirror = atlas.get_mirror_pair(v)
-        seen.add(v)
-        seen.add(mirror)
-
-        if mirror in e6_vertices:
-            # Complete pair
-            mirror_pairs.append((min(v, mirror), max(v, mirror)))
+    # Keep the pairs lying entirely in E₆, ordered by smaller index
+    mirror_pairs = [
+        (pair[0], pair[-1]) for pair in mirror.orbits
+        if all(v in e6_vertices for v in pair)
+    ]
 
     print(f"E₆ quotient construction:")
     print(f"  E₆ vertices: {len(e6_vertices)}")
@@ -47,47 +41,26 @@ def build_e6_quotient_graph(atlas: AtlasGraph, e6_vertices: Set[int]) -> Dict:
     # Representatives: one from each pair (take the smaller index)
     representatives = [pair[0] for pair in mirror_pairs]
 
-    # Build adjacency for quotient
-    # Two sign classes are adjacent if any representative of one class
-    # is adjacent to any representative of the other class
+    # Two sign classes are adjacent if any vertex of one class is adjacent
+    # to any vertex of the other; each Atlas edge inside E₆ is visited once
     n = len(representatives)
-    quotient_adj = [[False] * n for _ in range(n)]
-
-    for i in range(n):
-        for j in range(n):
-            if i == j:
-                continue
-
-            # Get both vertices in each pair
-            v1_a, v1_b = mirror_pairs[i]
-            v2_a, v2_b = mirror_pairs[j]
-
-            # Check if any are adjacent in Atlas
-            if (v2_a in atlas.neighbors(v1_a) or
-                v2_a in atlas.neighbors(v1_b) or
-                v2_b in atlas.neighbors(v1_a) or
-                v2_b in atlas.neighbors(v1_b)):
-                quotient_adj[i][j] = True
-
-    # Check connectivity
-    visited = set()
-    queue = [0]
-    while queue:
-        v = queue.pop(0)
-        if v in visited:
-            continue
-        visited.add(v)
-        for u in range(n):
-            if quotient_adj[v][u] and u not in visited:
-                queue.append(u)
-
-    is_connected = (len(visited) == n)
+    pair_index = {}
+    for i, pair in enumerate(mirror_pairs):
+        for v in pair:
+            pair_index[v] = i
+    quotient = OrbitQuotient(
+        pair_index, n,
+        ((u, v) for u, v in atlas.edges if u in pair_index and v in pair_index)
+    )
+    quotient_adj = quotient.adjacency_matrix()
+
+    is_connected = quotient.is_connected
 
     # Count edges
-    edges = sum(sum(row) for row in quotient_adj) // 2
+    edges = len(quotient.edges)
 
     # Degree sequence
-    degrees = [sum(row) for row in quotient_adj]
+    degrees = quotient.degrees
 
     return {
         'quotient_size': n,
@@ -151,22 +124,11 @@ def load_f4_quotient() -> Dict:
     f4 = analyzer.extract_sign_classes()
 
     # Check connectivity
-    n = len(f4.adjacency_matrix)
-    visited = set()
-    queue = [0]
-    while queue:
-        v = queue.pop(0)
-        if v in visited:
-            continue
-        visited.add(v)
-        for u in range(n):
-            if f4.adjacency_matrix[v][u] and u not in visited:
-                queue.append(u)
-
-    is_connected = (len(visited) == n)
-
-    edges = sum(sum(row) for row in f4.adjacency_matrix) // 2
-    degrees = [sum(row) for row in f4.adjacency_matrix]
+    quotient = OrbitQuotient.from_adjacency_matrix(f4.adjacency_matrix)
+    is_connected = quotient.is_connected
+
+    edges = len(quotient.edges)
+    degrees = quotient.degrees
 
     return {
         'size': len(f4.sign_classes),
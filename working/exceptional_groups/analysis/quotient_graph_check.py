@@ -11,29 +11,13 @@ from typing import Set, Dict
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 
 from tier_a_embedding import AtlasGraph
+from tier_a_embedding.analysis.orbits import OrbitQuotient
 from exceptional_groups.f4.sign_class_analysis import F4SignClassAnalyzer
 
 
 def check_quotient_connectivity(adjacency_matrix) -> bool:
-    """Check if quotient graph is connected via BFS."""
-    n = len(adjacency_matrix)
-    if n == 0:
-        return False
-
-    visited = set()
-    queue = [0]
-
-    while queue:
-        v = queue.pop(0)
-        if v in visited:
-            continue
-        visited.add(v)
-
-        for u in range(n):
-            if adjacency_matrix[v][u] and u not in visited:
-                queue.append(u)
-
-    return len(visited) == n
+    """Check if quotient graph is connected (union-find over its edges)."""
+    return OrbitQuotient.from_adjacency_matrix(adjacency_matrix).is_connected
 
 
 def main():
@@ -7,12 +7,13 @@ Explore: 126 = 96 + 30? Or other relationship?
 import sys
 import os
 from typing import List, Dict, Set, Tuple
-import numpy as np
 
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
 
-from tier_a_embedding import AtlasGraph
+from tier_a_embedding import AtlasGraph, E8RootSystem
+from tier_a_embedding.e8.weyl import e8_weyl_group
+from tier_a_embedding.analysis.orbits import OrbitPartition
 from s4_automorphism import verify_s4_automorphism
 
 
@@ -167,6 +168,37 @@ class E7OrbitAnalysis:
 
         return checks
 
+    def analyze_e7_root_orbits(self) -> Dict[str, any]:
+        """
+        W(E₇) orbits on the 240 E₈ roots.
+
+        The orbit partition comes from union-find over the 7 reflection
+        permutations, and the stabilisers from orbit-stabiliser with the
+        Schreier–Sims order. Expected: one orbit of 126 (the E₇ roots),
+        two of 56 and two fixed roots.
+        """
+        e8 = E8RootSystem()
+        weyl = e8_weyl_group(e8.roots, 7)
+        order = weyl.order()
+        partition = OrbitPartition(weyl.generators, len(e8.roots))
+        stabilizers = partition.stabilizer_sizes(order)
+
+        analysis = {
+            'weyl_order': order,
+            'orbit_sizes': partition.size_distribution(),
+            'stabilizers': {len(orbit): stab for orbit, stab in zip(partition.orbits, stabilizers)},
+        }
+        analysis['decomposition_126_56_56_1_1'] = (analysis['orbit_sizes'] == {1: 2, 56: 2, 126: 1})
+
+        print("\nW(E₇) orbits on the 240 E₈ roots:")
+        print(f"  |W(E₇)| = {order:,}")
+        for size, count in analysis['orbit_sizes'].items():
+            print(f"  {count} orbit(s) of size {size}, stabiliser order {analysis['stabilizers'][size]:,}")
+        status = "✓" if analysis['decomposition_126_56_56_1_1'] else "✗"
+        print(f"  {status} 240 = 126 + 56 + 56 + 1 + 1")
+
+        return analysis
+
     def propose_e7_mechanism(self) -> Dict[str, str]:
         """
         Propose mechanism for E₇ emergence.
@@ -201,15 +233,21 @@ class E7OrbitAnalysis:
         # Basic arithmetic
         checks['sum_equals'] = (96 + 30 == 126)
 
-        # Each orbit is distinct
-        all_vertices = set()
-        for orbit in self.s4_data.orbits:
-            all_vertices.update(orbit)
-        checks['orbits_partition'] = (len(all_vertices) == 96)
-        checks['orbit_count'] = (len(self.s4_data.orbits) == 30)
+        # The orbits partition the 96 vertices: labelling each vertex by its
+        # orbit gives one class per orbit, of the orbit's size
+        orbit_of = [0] * 96
+        for i, orbit in enumerate(self.s4_data.orbits):
+            for v in orbit:
+                orbit_of[v] = i
+        partition = OrbitPartition.from_keys(orbit_of)
+        checks['orbits_partition'] = (
+            sum(len(orbit) for orbit in self.s4_data.orbits) == 96
+            and sorted(partition.sizes) == sorted(len(o) for o in self.s4_data.orbits)
+        )
+        checks['orbit_count'] = (len(partition) == 30)
 
         # Combined structure
-        checks['combined_126'] = (len(all_vertices) + len(self.s4_data.orbits) == 126)
+        checks['combined_126'] = (partition.degree + len(partition) == 126)
 
         print("\n126 = 96 + 30 Verification:")
         for prop, result in checks.items():
@@ -244,6 +282,9 @@ def analyze_e7_orbits():
     # Analyze Weyl connection
     weyl_checks = analyzer.analyze_weyl_connection()
 
+    # W(E₇) orbits on the E₈ roots
+    root_orbits = analyzer.analyze_e7_root_orbits()
+
     # Propose mechanism
     mechanism = analyzer.propose_e7_mechanism()
 
@@ -258,6 +299,7 @@ def analyze_e7_orbits():
         'decomposition': '126 = 96 + 30',
         'verified': all(verification.values()),
         'mechanism': mechanism,
+        'root_orbits': root_orbits['orbit_sizes'],
         'key_insight': orbit_rel.get('key_insight')
     }
 
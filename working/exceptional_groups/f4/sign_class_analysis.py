@@ -12,8 +12,7 @@ from dataclasses import dataclass
 # Add parent directories to path
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 
-from tier_a_embedding import AtlasGraph, E8RootSystem
-from tier_a_embedding.embedding import EmbeddingSearch, EmbeddingConstraints
+from tier_a_embedding import cached_atlas_graph, cached_e8_root_system, cached_embedding
 from tier_a_embedding.analysis import QuotientAnalyzer
 
 
@@ -31,9 +30,9 @@ class F4SignClassAnalyzer:
     """Analyze F₄ structure in tier_a_embedding sign classes."""
 
     def __init__(self):
-        """Initialize with tier_a_embedding structures."""
-        self.atlas = AtlasGraph()
-        self.e8 = E8RootSystem()
+        """Initialize with tier_a_embedding structures (from the artifact cache)."""
+        self.atlas = cached_atlas_graph()
+        self.e8 = cached_e8_root_system()
         self.mapping = None
         self.quotient = None
 
@@ -49,21 +48,15 @@ class F4SignClassAnalyzer:
         except FileNotFoundError:
             pass
 
-        # Compute new embedding
+        # Compute new embedding, or reuse the cached one
         print("Computing new Tier-A embedding...")
-        search = EmbeddingSearch(self.atlas, self.e8)
-        constraints = EmbeddingConstraints(
-            max_solutions=1,
-            target_signs=48,
-            verbose=False
-        )
-        solutions = search.search(constraints)
+        mapping = cached_embedding(target_signs=48)
 
-        if not solutions:
+        if mapping is None:
             raise RuntimeError("No embedding found")
 
         print(f"Found embedding with 48 sign classes")
-        return solutions[0]
+        return mapping
 
     def extract_sign_classes(self) -> F4Structure:
         """
@@ -13,6 +13,7 @@ from itertools import product
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 
 from tier_a_embedding import AtlasGraph
+from tier_a_embedding.e8.weyl import WeylGroup
 from f4.sign_class_analysis import extract_f4_from_sign_classes
 
 
@@ -149,6 +150,17 @@ class F4WeylGroup:
             reflection_data.append(row)
         return ExactMatrix(reflection_data)
 
+    def permutation_group(self) -> WeylGroup:
+        """
+        W(F₄) as permutations of its 48 roots, with a Schreier–Sims chain.
+
+        Answers order and membership queries without the matrix BFS of
+        generate_weyl_group.
+        """
+        if self.simple_roots is None:
+            self.generate_simple_roots()
+        return WeylGroup.from_simple_roots([tuple(r.coords) for r in self.simple_roots])
+
     def generate_weyl_group(self, max_length: int = 30) -> Set[ExactMatrix]:
         """
         Generate Weyl group elements up to given word length (exact arithmetic).
@@ -12,7 +12,7 @@ from typing import Dict, List, Any
 
 sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
 
-from tier_a_embedding import AtlasGraph, E8RootSystem
+from tier_a_embedding import cached_atlas_graph, cached_e8_root_system
 from f4.sign_class_analysis import extract_f4_from_sign_classes
 from f4.cartan_extraction import extract_cartan_matrix
 from g2.klein_structure import find_klein_quartet
@@ -26,8 +26,8 @@ class CertificateGenerator:
 
     def __init__(self):
         """Initialize with all analyzers."""
-        self.atlas = AtlasGraph()
-        self.e8 = E8RootSystem()
+        self.atlas = cached_atlas_graph()
+        self.e8 = cached_e8_root_system()
         self.timestamp = datetime.now().isoformat()
 
     def generate_f4_certificate(self) -> Dict[str, Any]:
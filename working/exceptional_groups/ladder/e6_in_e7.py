@@ -14,6 +14,8 @@ sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
 from tier_a_embedding import AtlasGraph
 from e6.first_principles_construction import construct_e6_first_principles
 from e7.orbit_analysis import analyze_e7_orbits
+from tier_a_embedding import E8RootSystem
+from tier_a_embedding.e8.weyl import e8_weyl_group
 
 
 class E6InE7Inclusion:
@@ -113,15 +115,27 @@ class E6InE7Inclusion:
 
         E₆ Weyl: order 51,840
         E₇ Weyl: order 2,903,040
+
+        Both act on the 240 E₈ roots as reflection subgroups of W(E₈);
+        Schreier–Sims computes their orders and sifts each E₆ generator
+        through the E₇ chain, so neither group is enumerated.
         """
         checks = {}
 
-        e6_weyl = 51840
-        e7_weyl = 2903040
+        roots = E8RootSystem().roots
+        e6_group = e8_weyl_group(roots, rank=6)
+        e7_group = e8_weyl_group(roots, rank=7)
+        e6_weyl = e6_group.order()
+        e7_weyl = e7_group.order()
+
+        checks['weyl_orders_ok'] = (e6_weyl == 51840 and e7_weyl == 2903040)
 
         # Check divisibility
         checks['weyl_divides'] = (e7_weyl % e6_weyl == 0)
 
+        # Check membership of every E₆ generator in W(E₇)
+        checks['weyl_subgroup'] = e6_group.is_subgroup_of(e7_group)
+
         if checks['weyl_divides']:
             index = e7_weyl // e6_weyl
             checks['weyl_index'] = index
@@ -133,6 +147,7 @@ class E6InE7Inclusion:
         print(f"\nE₆ Weyl order: {e6_weyl:,}")
         print(f"E₇ Weyl order: {e7_weyl:,}")
         print(f"Divides: {checks['weyl_divides']}")
+        print(f"W(E₆) ⊂ W(E₇) by membership: {checks['weyl_subgroup']}")
 
         if 'weyl_index' in checks:
             print(f"Index [E₇:E₆] = {checks['weyl_index']}")
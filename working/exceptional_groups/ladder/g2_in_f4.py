@@ -16,6 +16,10 @@ from tier_a_embedding import AtlasGraph
 from f4.sign_class_analysis import extract_f4_from_sign_classes
 from g2.twelve_fold import verify_twelve_fold
 from g2.klein_to_g2_mapping import map_klein_to_g2
+from f4.weyl_generators import F4WeylGroup
+from tier_a_embedding.e8.weyl import (
+    PermutationGroup, WeylGroup, compose, element_order
+)
 
 
 class G2InF4Inclusion:
@@ -93,15 +97,33 @@ class G2InF4Inclusion:
         Checks:
         1. Order divides: 12 | 1152 ✓
         2. Rank compatible: rank(G₂) = 2 ≤ 4 = rank(F₄) ✓
+        3. Explicit copy of D₆ in W(F₄): r₁ = s₁ and r₂ = −s₂, with s₁, s₂
+           the reflections of the long A₂ simple roots and −1 the longest
+           element of W(F₄), are involutions whose product has order 6 and
+           which generate a subgroup of order 12 (Schreier–Sims)
         """
         checks = {}
 
-        g2_weyl_order = 12
-        f4_weyl_order = 1152
+        g2_group = WeylGroup.from_simple_roots([(1, -1, 0), (-2, 1, 1)])
+        f4_group = F4WeylGroup().permutation_group()
+        g2_weyl_order = g2_group.order()
+        f4_weyl_order = f4_group.order()
 
         # Order divisibility
         checks['weyl_order_divides'] = (f4_weyl_order % g2_weyl_order == 0)
 
+        # Dihedral subgroup of order 12 generated inside W(F₄)
+        s1, s2 = f4_group.generators[0], f4_group.generators[1]
+        r1, r2 = s1, compose(s2, f4_group.negation())
+        dihedral = PermutationGroup([r1, r2], f4_group.degree)
+        checks['weyl_subgroup_found'] = (
+            f4_group.contains(f4_group.negation())
+            and element_order(r1) == 2 and element_order(r2) == 2
+            and element_order(compose(r1, r2)) == 6
+            and dihedral.order() == g2_weyl_order
+            and dihedral.is_subgroup_of(f4_group)
+        )
+
         # Rank compatibility
         g2_rank = 2
         f4_rank = 4
@@ -116,6 +138,7 @@ class G2InF4Inclusion:
         print(f"  G₂ Weyl order: {g2_weyl_order} (D₆)")
         print(f"  F₄ Weyl order: {f4_weyl_order}")
         print(f"  Order divides: {checks['weyl_order_divides']}")
+        print(f"  D₆ = ⟨s₁, −s₂⟩ ⊂ F₄ Weyl: {checks['weyl_subgroup_found']}")
         if 'weyl_index' in checks:
             print(f"  Index [F₄:G₂] = {checks['weyl_index']}")
 
@@ -12,10 +12,19 @@ from fractions import Fraction
 
 sys.path.append(os.path.join(os.path.dirname(__file__), '../..'))
 
+from tier_a_embedding import E8RootSystem
+from tier_a_embedding.e8.weyl import PermutationGroup, compose, e8_weyl_group
+
 
 def verify_weyl_embedding():
     """
     Verify F₄ Weyl ⊂ E₆ Weyl by group theory.
+
+    W(F₄) is realised inside W(E₆), acting on the 240 E₈ roots, as the
+    group generated by s₂, s₄, s₃s₅ and s₁s₆: the reflections the diagram
+    automorphism 1↔6, 3↔5 fixes (Bourbaki numbering). Schreier–Sims gives
+    both orders and the membership of each generator without enumerating
+    either group.
     """
     print("="*70)
     print("F₄ WEYL ⊂ E₆ WEYL GROUP EMBEDDING")
@@ -24,18 +33,25 @@ def verify_weyl_embedding():
     F4_WEYL_ORDER = 1152
     E6_WEYL_ORDER = 51840
 
-    print(f"\nWeyl group orders:")
-    print(f"  |W(F₄)| = {F4_WEYL_ORDER}")
-    print(f"  |W(E₆)| = {E6_WEYL_ORDER}")
+    e6 = e8_weyl_group(E8RootSystem().roots, rank=6)
+    s1, s2, s3, s4, s5, s6 = e6.generators
+    f4 = PermutationGroup([s2, s4, compose(s3, s5), compose(s1, s6)], e6.degree)
+
+    print(f"\nWeyl group orders (Schreier–Sims on the 240 E₈ roots):")
+    print(f"  |W(F₄)| = {f4.order()} (expected {F4_WEYL_ORDER})")
+    print(f"  |W(E₆)| = {e6.order()} (expected {E6_WEYL_ORDER})")
+
+    if f4.order() != F4_WEYL_ORDER or e6.order() != E6_WEYL_ORDER:
+        print(f"\n✗ Computed orders do not match")
+        return False
 
-    # Check divisibility
-    if E6_WEYL_ORDER % F4_WEYL_ORDER == 0:
-        index = E6_WEYL_ORDER // F4_WEYL_ORDER
-        print(f"\n✓ F₄ Weyl divides E₆ Weyl")
+    if f4.is_subgroup_of(e6):
+        index = e6.order() // f4.order()
+        print(f"\n✓ Folded F₄ generators are elements of W(E₆)")
         print(f"  Index [W(E₆) : W(F₄)] = {index}")
         return True
     else:
-        print(f"\n✗ F₄ Weyl does NOT divide E₆ Weyl")
+        print(f"\n✗ F₄ Weyl does NOT embed in E₆ Weyl")
         return False
 
 
@@ -149,7 +165,7 @@ def summarize_findings():
     print(f"  • F₄ exists as 48-root system (quotient of 96 Atlas classes)")
     print(f"  • E₆ exists as 72-root system (degree partition)")
     print(f"  • Both embed in E₈ (via tier_a_embedding)")
-    print(f"  • Weyl groups compatible: |W(F₄)| divides |W(E₆)|")
+    print(f"  • Weyl groups embed: folded W(F₄) ⊂ W(E₆) by membership")
     print(f"  • Ranks compatible: rank(F₄)=4 < 6=rank(E₆)")
     print(f"  • 36/48 F₄ roots overlap with E₆ in E₈ (75%)")
 
@@ -14,6 +14,7 @@ from dataclasses import dataclass
 sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
 
 from tier_a_embedding import AtlasGraph, derive_unity_indices
+from tier_a_embedding.analysis.orbits import OrbitPartition
 
 
 @dataclass
@@ -72,33 +73,18 @@ class S4AutomorphismAnalyzer:
         - 12 orbits of size 4
         - 6 orbits of size 6
         """
-        # Track which vertices have been assigned to orbits
-        assigned = set()
-        orbits = []
-
         print("\nComputing S₄ orbits...")
 
-        for v in range(96):
-            if v in assigned:
-                continue
-
-            # Start new orbit with vertex v
-            orbit = set()
-            label = self.atlas.labels[v]
-
-            # Apply all S₄ elements
-            for perm in self.s4_group:
-                new_label = self.apply_s4_to_label(label, perm)
-
-                # Find vertex with this label
-                for u in range(96):
-                    if self.atlas.labels[u] == new_label:
-                        orbit.add(u)
-                        break
+        # Each S₄ element as a permutation of vertex indices
+        label_index = {label: v for v, label in enumerate(self.atlas.labels)}
+        generators = [
+            [label_index[self.apply_s4_to_label(label, perm)] for label in self.atlas.labels]
+            for perm in self.s4_group
+        ]
 
-            # Add orbit
-            orbits.append(orbit)
-            assigned.update(orbit)
+        # Orbits by union-find, ordered by their least vertex
+        partition = OrbitPartition(generators, len(self.atlas.labels))
+        orbits = [set(orbit) for orbit in partition.orbits]
 
         print(f"Found {len(orbits)} orbits")
         return orbits
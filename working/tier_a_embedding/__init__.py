@@ -21,6 +21,13 @@ from .atlas.labels import derive_unity_indices
 from .e8.roots import E8RootSystem
 from .embedding.search import find_embedding
 from .main import main, search_embedding, verify_embedding_mapping
+from .cache import (
+    ArtifactCache,
+    cached_atlas_graph,
+    cached_e8_root_system,
+    cached_s4_automorphisms,
+    cached_embedding,
+)
 
 __version__ = "1.0.0"
 
@@ -42,4 +49,10 @@ __all__ = [
     "main",
     "search_embedding",
     "verify_embedding_mapping",
+    # Derived-structure cache
+    "ArtifactCache",
+    "cached_atlas_graph",
+    "cached_e8_root_system",
+    "cached_s4_automorphisms",
+    "cached_embedding",
 ]
\ No newline at end of file
@@ -2,7 +2,7 @@
 Analysis module for studying embedding structure.
 
 This module provides tools for analyzing the graph structure
-of Tier-A embeddings, including neighbor extraction, quotient
+of Tier-A embeddings, including neighbor extraction, orbit partitions, quotient
 structures, and 1-skeleton analysis.
 """
 
@@ -21,6 +21,12 @@ from .quotient_structure import (
     QuotientAnalyzer,
 )
 
+from .orbits import (
+    UnionFind,
+    OrbitPartition,
+    OrbitQuotient,
+)
+
 from .skeleton import (
     extract_1_skeleton,
     compute_skeleton_properties,
@@ -39,6 +45,10 @@ __all__ = [
     "analyze_quotient_properties",
     "QuotientGraph",
     "QuotientAnalyzer",
+    # Orbits
+    "UnionFind",
+    "OrbitPartition",
+    "OrbitQuotient",
     # Skeleton
     "extract_1_skeleton",
     "compute_skeleton_properties",
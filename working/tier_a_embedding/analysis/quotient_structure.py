@@ -8,6 +8,8 @@ from typing import List, Dict, Set, Tuple, Optional
 from dataclasses import dataclass
 from collections import defaultdict
 
+from .orbits import OrbitPartition, OrbitQuotient
+
 
 @dataclass
 class QuotientGraph:
@@ -45,6 +47,13 @@ class QuotientAnalyzer:
             self.sign_map[v] = sign_class
             self.class_members[sign_class].append(v)
 
+    def _orbit_quotient(self) -> Tuple[List[int], OrbitQuotient]:
+        """Sorted sign classes and the Atlas edges collapsed onto them."""
+        vertices = sorted(self.class_members.keys())
+        vertex_idx = {v: i for i, v in enumerate(vertices)}
+        labels = [vertex_idx[self.sign_map[v]] for v in range(len(self.atlas.labels))]
+        return vertices, OrbitQuotient(labels, len(vertices), self.atlas.edges)
+
     def build_quotient_graph(self) -> QuotientGraph:
         """
         Build the quotient graph structure.
@@ -52,32 +61,10 @@ class QuotientAnalyzer:
         Returns:
             QuotientGraph with complete structure
         """
-        # Get sorted list of sign classes
-        vertices = sorted(self.class_members.keys())
-        vertex_idx = {v: i for i, v in enumerate(vertices)}
-        n = len(vertices)
-
-        # Initialize adjacency matrix
-        adj_matrix = [[False] * n for _ in range(n)]
-        edges = []
+        vertices, quotient = self._orbit_quotient()
 
-        # Build adjacency
-        for v1 in range(len(self.atlas.labels)):
-            class1 = self.sign_map[v1]
-            idx1 = vertex_idx[class1]
-
-            for v2 in self.atlas.adjacency[v1]:
-                class2 = self.sign_map[v2]
-                idx2 = vertex_idx[class2]
-
-                if idx1 != idx2 and not adj_matrix[idx1][idx2]:
-                    adj_matrix[idx1][idx2] = True
-                    adj_matrix[idx2][idx1] = True
-                    if idx1 < idx2:
-                        edges.append((class1, class2))
-
-        # Compute degree sequence
-        degree_sequence = [sum(row) for row in adj_matrix]
+        # Edges in sorted class order
+        edges = [(vertices[a], vertices[b]) for a, b in quotient.edges]
 
         # Get class sizes
         class_sizes = {cls: len(members) for cls, members in self.class_members.items()}
@@ -85,8 +72,8 @@ class QuotientAnalyzer:
         return QuotientGraph(
             vertices=vertices,
             edges=edges,
-            adjacency_matrix=adj_matrix,
-            degree_sequence=degree_sequence,
+            adjacency_matrix=quotient.adjacency_matrix(),
+            degree_sequence=quotient.degrees,
             class_sizes=class_sizes
         )
 
@@ -97,19 +84,11 @@ class QuotientAnalyzer:
         Returns:
             Dictionary mapping sign class to adjacent classes
         """
-        adjacency = defaultdict(set)
-
-        for v1 in range(len(self.atlas.labels)):
-            class1 = self.sign_map[v1]
-
-            for v2 in self.atlas.adjacency[v1]:
-                class2 = self.sign_map[v2]
-
-                if class1 != class2:
-                    adjacency[class1].add(class2)
-                    adjacency[class2].add(class1)
-
-        return dict(adjacency)
+        vertices, quotient = self._orbit_quotient()
+        return {
+            vertices[a]: {vertices[b] for b in row}
+            for a, row in enumerate(quotient.neighbors) if row
+        }
 
     def analyze_quotient_properties(self) -> Dict:
         """
@@ -172,22 +151,7 @@ class QuotientAnalyzer:
         if n == 0:
             return {"is_connected": False, "components": 0}
 
-        # BFS to find components
-        visited = [False] * n
-        components = 0
-
-        for start in range(n):
-            if not visited[start]:
-                components += 1
-                queue = [start]
-                visited[start] = True
-
-                while queue:
-                    v = queue.pop(0)
-                    for u in range(n):
-                        if quotient.adjacency_matrix[v][u] and not visited[u]:
-                            visited[u] = True
-                            queue.append(u)
+        components = len(_as_orbit_quotient(quotient).components())
 
         return {
             "is_connected": components == 1,
@@ -208,8 +172,9 @@ class QuotientAnalyzer:
         total_coeff = 0.0
         valid_nodes = 0
 
+        neighbor_lists = _as_orbit_quotient(quotient).neighbors
         for i in range(n):
-            neighbors = [j for j in range(n) if quotient.adjacency_matrix[i][j]]
+            neighbors = neighbor_lists[i]
             k = len(neighbors)
 
             if k >= 2:
@@ -236,36 +201,18 @@ class QuotientAnalyzer:
         Returns:
             Distance matrix, or None if not connected
         """
-        quotient = self.build_quotient_graph()
-        n = len(quotient.vertices)
-
-        if n == 0:
+        _, quotient = self._orbit_quotient()
+        if quotient.size == 0:
             return None
 
-        # Initialize distance matrix
-        dist = [[float('inf')] * n for _ in range(n)]
+        # Breadth-first search from every class; None if not connected
+        return quotient.distances()
 
-        # Set distances for edges
-        for i in range(n):
-            dist[i][i] = 0
-            for j in range(n):
-                if quotient.adjacency_matrix[i][j]:
-                    dist[i][j] = 1
-
-        # Floyd-Warshall algorithm
-        for k in range(n):
-            for i in range(n):
-                for j in range(n):
-                    if dist[i][k] + dist[k][j] < dist[i][j]:
-                        dist[i][j] = dist[i][k] + dist[k][j]
-
-        # Check if connected
-        for i in range(n):
-            for j in range(n):
-                if dist[i][j] == float('inf'):
-                    return None  # Not connected
 
-        return [[int(d) for d in row] for row in dist]
+def _as_orbit_quotient(quotient: QuotientGraph) -> OrbitQuotient:
+    """Adjacency lists of a QuotientGraph, from its edge list."""
+    index = {v: i for i, v in enumerate(quotient.vertices)}
+    return OrbitQuotient(index, len(quotient.vertices), quotient.edges)
 
 
 def build_quotient_graph(mapping: List[int], atlas_graph, e8_system) -> QuotientGraph:
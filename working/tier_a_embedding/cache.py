@@ -0,0 +1,250 @@
+"""
+On-disk cache of derived structures.
+
+Root systems, graphs, automorphism tables and embeddings are deterministic
+functions of their construction parameters and of the code that builds
+them. Each artifact is stored as one pickle file whose name is a content
+hash of:
+- CACHE_VERSION, the explicit invalidation key: bump it to drop every
+  artifact built by older code
+- the artifact name and its construction parameters
+- the bytes of the source files that build it, so editing a builder
+  invalidates its artifacts without touching CACHE_VERSION
+
+Files are read through mmap and unpickled straight from the mapping. They
+are written to a temporary file and renamed into place, so concurrent runs
+never see a partial artifact.
+
+The cache lives in $TIER_A_CACHE_DIR, defaulting to
+$XDG_CACHE_HOME/tier_a_embedding (~/.cache/tier_a_embedding). Setting
+TIER_A_CACHE=0 disables it; every call then builds from scratch.
+"""
+import hashlib
+import mmap
+import os
+import pickle
+import tempfile
+from typing import Any, Callable, Dict, List, Optional, Sequence, Tuple
+import sys
+sys.path.append(os.path.dirname(os.path.abspath(__file__)))
+
+from atlas import AtlasGraph
+from atlas.symmetry import generate_s4_automorphism_group
+from e8 import E8RootSystem
+from embedding import EmbeddingSearch, EmbeddingConstraints
+
+# Bump to invalidate every cached artifact
+CACHE_VERSION = 2
+
+PACKAGE_ROOT = os.path.dirname(os.path.abspath(__file__))
+
+# Source files each artifact is built from, relative to PACKAGE_ROOT
+_ATLAS_SOURCES = ("common_types.py", "atlas/graph.py", "atlas/labels.py")
+_E8_SOURCES = ("common_types.py", "e8/roots.py")
+_S4_SOURCES = _ATLAS_SOURCES + ("atlas/symmetry.py",)
+_EMBEDDING_SOURCES = _ATLAS_SOURCES + _E8_SOURCES + ("e8/geometry.py", "embedding/search.py")
+
+
+def default_cache_dir() -> str:
+    """Cache directory from the environment."""
+    explicit = os.environ.get("TIER_A_CACHE_DIR")
+    if explicit:
+        return explicit
+    base = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    return os.path.join(base, "tier_a_embedding")
+
+
+class ArtifactCache:
+    """
+    Content-hashed pickle store for derived structures.
+
+    Attributes:
+        directory: Where artifacts are stored
+        enabled: False when caching is switched off
+        hits, misses: Lookups served from disk and built, since creation
+    """
+
+    def __init__(self, directory: Optional[str] = None, enabled: Optional[bool] = None):
+        """
+        Initialize the cache.
+
+        Args:
+            directory: Cache directory (default: default_cache_dir())
+            enabled: Override the TIER_A_CACHE environment switch
+        """
+        self.directory = directory or default_cache_dir()
+        if enabled is None:
+            enabled = os.environ.get("TIER_A_CACHE", "1") != "0"
+        self.enabled = enabled
+        self.hits = 0
+        self.misses = 0
+        self._source_hashes: Dict[str, str] = {}
+
+    def _source_hash(self, relative_path: str) -> str:
+        """SHA-256 of a source file, hashed once per process."""
+        digest = self._source_hashes.get(relative_path)
+        if digest is None:
+            with open(os.path.join(PACKAGE_ROOT, relative_path), "rb") as f:
+                digest = hashlib.sha256(f.read()).hexdigest()
+            self._source_hashes[relative_path] = digest
+        return digest
+
+    def key(self, name: str, params: Tuple = (), sources: Sequence[str] = ()) -> str:
+        """
+        Content hash identifying one artifact.
+
+        Args:
+            name: Artifact name
+            params: Construction parameters (their repr is hashed)
+            sources: Builder source files, relative to the package root
+
+        Returns:
+            Hex digest
+        """
+        h = hashlib.sha256()
+        h.update(f"v{CACHE_VERSION}\0{name}\0{params!r}\0".encode())
+        for path in sorted(sources):
+            h.update(f"{path}\0{self._source_hash(path)}\0".encode())
+        return h.hexdigest()
+
+    def path(self, name: str, key: str) -> str:
+        """File holding an artifact."""
+        return os.path.join(self.directory, f"{name}-{key[:32]}.pkl")
+
+    def _load(self, path: str, key: str) -> Tuple[bool, Any]:
+        """Read an artifact through mmap; (False, None) when absent or stale."""
+        try:
+            with open(path, "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+                stored_key, value = pickle.loads(m)
+        except (OSError, ValueError, EOFError, pickle.UnpicklingError):
+            return False, None
+        if stored_key != key:
+            return False, None
+        return True, value
+
+    def _store(self, path: str, key: str, value: Any) -> None:
+        """Write an artifact atomically."""
+        os.makedirs(self.directory, exist_ok=True)
+        fd, temporary = tempfile.mkstemp(dir=self.directory, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "wb") as f:
+                pickle.dump((key, value), f, protocol=pickle.HIGHEST_PROTOCOL)
+            os.replace(temporary, path)
+        except BaseException:
+            if os.path.exists(temporary):
+                os.unlink(temporary)
+            raise
+
+    def get_or_build(self, name: str, build: Callable[[], Any], params: Tuple = (),
+                     sources: Sequence[str] = ()) -> Any:
+        """
+        Load an artifact, building and storing it on a miss.
+
+        Args:
+            name: Artifact name
+            build: Zero-argument builder
+            params: Construction parameters, part of the key
+            sources: Builder source files, part of the key
+
+        Returns:
+            The artifact
+        """
+        if not self.enabled:
+            return build()
+        key = self.key(name, params, sources)
+        path = self.path(name, key)
+        found, value = self._load(path, key)
+        if found:
+            self.hits += 1
+            return value
+        self.misses += 1
+        value = build()
+        try:
+            self._store(path, key, value)
+        except OSError:
+            pass  # A read-only cache directory only costs the rebuild
+        return value
+
+    def invalidate(self, name: Optional[str] = None) -> int:
+        """
+        Delete cached artifacts.
+
+        Args:
+            name: Only artifacts with this name (None deletes all)
+
+        Returns:
+            Number of files removed
+        """
+        if not os.path.isdir(self.directory):
+            return 0
+        removed = 0
+        for entry in os.listdir(self.directory):
+            if not entry.endswith(".pkl"):
+                continue
+            if name is not None and not entry.startswith(f"{name}-"):
+                continue
+            os.unlink(os.path.join(self.directory, entry))
+            removed += 1
+        return removed
+
+
+_default_cache: Optional[ArtifactCache] = None
+
+
+def get_cache() -> ArtifactCache:
+    """Process-wide cache configured from the environment."""
+    global _default_cache
+    if _default_cache is None:
+        _default_cache = ArtifactCache()
+    return _default_cache
+
+
+def _build_e8_root_system() -> E8RootSystem:
+    e8 = E8RootSystem()
+    # Fill the lazy integer tables so they are stored too
+    e8.doubled_roots, e8.gram, e8.adjacency
+    return e8
+
+
+def _build_s4_automorphisms() -> List[Tuple[int, ...]]:
+    return generate_s4_automorphism_group(cached_atlas_graph().labels)
+
+
+def _build_embedding(target_signs: Optional[int]) -> Optional[List[int]]:
+    # The plain backtracking search, as the analysis scripts ran it before
+    # caching: other searches may find a different first embedding
+    search = EmbeddingSearch(cached_atlas_graph(), cached_e8_root_system())
+    solutions = search.search(EmbeddingConstraints(max_solutions=1, target_signs=target_signs,
+                                                   verbose=False))
+    return solutions[0] if solutions else None
+
+
+def cached_atlas_graph() -> AtlasGraph:
+    """AtlasGraph, built once per cache."""
+    return get_cache().get_or_build("atlas_graph", AtlasGraph, sources=_ATLAS_SOURCES)
+
+
+def cached_e8_root_system() -> E8RootSystem:
+    """E8RootSystem with its Gram and adjacency tables filled, built once per cache."""
+    return get_cache().get_or_build("e8_root_system", _build_e8_root_system, sources=_E8_SOURCES)
+
+
+def cached_s4_automorphisms() -> List[Tuple[int, ...]]:
+    """The 24 S4 automorphisms of G_A as vertex permutations."""
+    return get_cache().get_or_build("s4_automorphisms", _build_s4_automorphisms, sources=_S4_SOURCES)
+
+
+def cached_embedding(target_signs: Optional[int] = None) -> Optional[List[int]]:
+    """
+    First embedding found by EmbeddingSearch.
+
+    Args:
+        target_signs: Required number of sign classes (None for any)
+
+    Returns:
+        Vertex to root mapping, or None if there is none
+    """
+    return get_cache().get_or_build(
+        "embedding", lambda: _build_embedding(target_signs),
+        params=(target_signs,), sources=_EMBEDDING_SOURCES,
+    )
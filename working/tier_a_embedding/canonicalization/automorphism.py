@@ -98,6 +98,25 @@ class S4Group:
         # Find identity element
         self.identity = S4Automorphism(S4_PERMUTABLE_BITS)
 
+    def vertex_permutations(self, labels: List[Label]) -> List[Tuple[int, ...]]:
+        """
+        All elements as vertex index arrays, in element order.
+
+        Entry k of the result for g satisfies
+        g.apply_to_mapping(mapping, labels)[n] == mapping[perm[n]].
+
+        Args:
+            labels: Atlas labels
+
+        Returns:
+            One permutation tuple per element
+        """
+        label_to_idx = {lab: i for i, lab in enumerate(labels)}
+        return [
+            tuple(label_to_idx[g.apply_to_label(lab)] for lab in labels)
+            for g in self.elements
+        ]
+
     def orbit(self, mapping: List[int], labels: List[Label]) -> List[List[int]]:
         """
         Compute the orbit of a mapping under S4 action.
@@ -2,8 +2,15 @@
 Canonical form selection for embeddings.
 
 This module selects canonical representatives from equivalence classes.
+
+The 24 S4 automorphisms are precomputed once as vertex permutation index
+arrays, and the mirror τ is composed with each of them to give 48 arrays
+in total. Transforming a mapping is then a gather through one of these
+arrays. The orbit-canonical form of a mapping is the lexicographically
+least of its 48 gathers.
 """
-from typing import List, Tuple, Optional
+from operator import itemgetter
+from typing import Dict, Iterable, Iterator, List, Tuple, Optional
 import sys
 import os
 sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -12,6 +19,11 @@ from common_types import Label, Root
 from .equivalence import mapping_equivalence_key, count_root_types
 from .automorphism import S4Group
 
+try:
+    import numpy as np
+except ImportError:  # itemgetter gathers below
+    np = None
+
 class CanonicalSelector:
     """Selects canonical forms for embeddings."""
 
@@ -37,9 +49,26 @@ class CanonicalSelector:
         self.roots = roots
         self.s4_group = S4Group()
 
+        # S4 permutations, then each composed with τ: image[n] = mapping[perm[n]]
+        self.s4_permutations = self.s4_group.vertex_permutations(labels)
+        self.permutations = self.s4_permutations + [
+            tuple(perm[t] for t in tau) for perm in self.s4_permutations
+        ]
+        self._s4_gathers = [itemgetter(*perm) for perm in self.s4_permutations]
+        self._gathers = [itemgetter(*perm) for perm in self.permutations]
+        self._table = np.array(self.permutations, dtype=np.intp) if np is not None else None
+
+        # S4 only permutes e1, e2, e3, e6 and τ only flips e7, so each S4
+        # permutation commutes with τ. The τ/sign key is then constant on an
+        # orbit and one evaluation gives its minimum.
+        self._key_is_orbit_invariant = all(
+            perm[tau[i]] == tau[perm[i]]
+            for perm in self.s4_permutations for i in range(len(tau))
+        )
+
     def canonicalize(
         self,
-        mappings: List[List[int]],
+        mappings: Iterable[List[int]],
         use_automorphisms: bool = True
     ) -> List[int]:
         """
@@ -50,22 +79,35 @@ class CanonicalSelector:
         2. Maximum integer roots (minimal denominators)
         3. Lexicographically minimal mapping
 
+        Mappings with the same root multiset share their key and their root
+        counts. The key and counts are computed once per multiset, through
+        a hashed set, so the selection is linear in the number of mappings.
+
         Args:
-            mappings: List of mappings to select from
+            mappings: Mappings to select from (any iterable)
             use_automorphisms: Whether to consider S4 automorphisms
 
         Returns:
             The canonical mapping
         """
-        if not mappings:
-            raise ValueError("No mappings provided")
-
-        if len(mappings) == 1:
+        if isinstance(mappings, list) and len(mappings) == 1:
             return mappings[0]
 
-        # Compute scores for each mapping
-        scored_mappings = []
+        # Least mapping per root multiset; ties keep the first seen, like a stable sort
+        least: Dict[Tuple[int, ...], Tuple[Tuple[int, ...], List[int]]] = {}
         for mapping in mappings:
+            as_tuple = tuple(mapping)
+            group = tuple(sorted(as_tuple))
+            best = least.get(group)
+            if best is None or as_tuple < best[0]:
+                least[group] = (as_tuple, mapping)
+
+        if not least:
+            raise ValueError("No mappings provided")
+
+        best_score = None
+        best_mapping = None
+        for as_tuple, mapping in least.values():
             if use_automorphisms:
                 key = self._automorphism_equivalence_key(mapping)
             else:
@@ -76,13 +118,67 @@ class CanonicalSelector:
             score = (
                 key,                # Minimize equivalence key
                 -int_count,        # Maximize integer roots
-                tuple(mapping)     # Lexicographic tiebreaker
+                as_tuple           # Lexicographic tiebreaker
             )
-            scored_mappings.append((score, mapping))
+            if best_score is None or score < best_score:
+                best_score, best_mapping = score, mapping
 
-        # Select minimum by score
-        scored_mappings.sort(key=lambda x: x[0])
-        return scored_mappings[0][1]
+        return best_mapping
+
+    def images(self, mapping: List[int], include_mirror: bool = True) -> List[Tuple[int, ...]]:
+        """
+        Gather a mapping through every precomputed permutation.
+
+        Args:
+            mapping: Vertex to root mapping
+            include_mirror: Also gather through the τ-composed permutations
+
+        Returns:
+            48 images (24 without the mirror), with repeats, in table order
+        """
+        gathers = self._gathers if include_mirror else self._s4_gathers
+        return [gather(mapping) for gather in gathers]
+
+    def canonical_form(self, mapping: List[int]) -> Tuple[int, ...]:
+        """
+        Orbit-canonical form under S4 × mirror.
+
+        The lexicographically least of the 48 images. Two mappings have the
+        same canonical form exactly when one is carried to the other by an
+        S4 automorphism, optionally composed with τ. For an embedding,
+        composing with τ is the same as negating every root.
+
+        Args:
+            mapping: Vertex to root mapping
+
+        Returns:
+            Canonical form as a tuple
+        """
+        if self._table is not None:
+            rows = np.asarray(mapping)[self._table]
+            # lexsort treats its last key as primary, so pass columns reversed
+            return tuple(rows[np.lexsort(rows.T[::-1])[0]].tolist())
+        return min(gather(mapping) for gather in self._gathers)
+
+    def unique_orbits(self, mappings: Iterable[List[int]]) -> Iterator[List[int]]:
+        """
+        Yield the first mapping seen from each S4 × mirror orbit.
+
+        Canonical forms are kept in a hashed set, so one pass is linear in
+        the number of mappings.
+
+        Args:
+            mappings: Mappings, e.g. search results
+
+        Yields:
+            One mapping per distinct orbit, in input order
+        """
+        seen = set()
+        for mapping in mappings:
+            form = self.canonical_form(mapping)
+            if form not in seen:
+                seen.add(form)
+                yield mapping
 
     def _automorphism_equivalence_key(self, mapping: List[int]) -> Tuple[int, ...]:
         """
@@ -94,14 +190,13 @@ class CanonicalSelector:
         Returns:
             Minimal equivalence key
         """
-        orbit = self.s4_group.orbit(mapping, self.labels)
-        keys = []
-
-        for transformed in orbit:
-            key = mapping_equivalence_key(transformed, self.tau, self.negation_table)
-            keys.append(key)
+        if self._key_is_orbit_invariant:
+            return mapping_equivalence_key(mapping, self.tau, self.negation_table)
 
-        return min(keys)
+        return min(
+            mapping_equivalence_key(image, self.tau, self.negation_table)
+            for image in set(self.images(mapping, include_mirror=False))
+        )
 
     def are_equivalent_modulo_automorphisms(
         self,
@@ -132,8 +227,7 @@ class CanonicalSelector:
         Returns:
             Size of equivalence class
         """
-        orbit = self.s4_group.orbit(mapping, self.labels)
-        stabilizer_size = self.s4_group.stabilizer_size(mapping, self.labels)
+        orbit = set(self.images(mapping, include_mirror=False))
 
         # Orbit-stabilizer theorem: |G| = |orbit| * |stabilizer|
         # So |orbit| = |G| / |stabilizer| = 24 / stabilizer_size
@@ -153,8 +247,9 @@ class CanonicalSelector:
         Returns:
             Canonical representative in the orbit
         """
-        orbit = self.s4_group.orbit(mapping, self.labels)
-        return self.canonicalize(orbit, use_automorphisms=False)
+        # Every member of the orbit has the same τ/sign key and root counts,
+        # so the selection reduces to the least image
+        return list(min(self.images(mapping, include_mirror=False)))
 
 def canonicalize_embedding(
     mappings: List[List[int]],
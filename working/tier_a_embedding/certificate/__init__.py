@@ -19,6 +19,12 @@ from .verifier import (
     CertificateVerifier,
     verify_certificate,
 )
+from .batch import (
+    BatchCertificateVerifier,
+    VerificationOutcome,
+    iter_certificate_items,
+    verify_certificates,
+)
 
 __all__ = [
     # Format
@@ -33,4 +39,9 @@ __all__ = [
     # Verifier
     "CertificateVerifier",
     "verify_certificate",
+    # Batch verification
+    "BatchCertificateVerifier",
+    "VerificationOutcome",
+    "iter_certificate_items",
+    "verify_certificates",
 ]
\ No newline at end of file
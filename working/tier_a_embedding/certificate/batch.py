@@ -0,0 +1,285 @@
+"""
+Batch certificate verification.
+
+Runs the same checks as CertificateVerifier, in the same order and with
+the same messages, over many certificates. The structures the checks
+need are derived from a certificate's atlas labels and roots:
+- the atlas edge list
+- the τ pairing
+- the root negation table
+- the E8 adjacency as one bitmask row per root
+These are built once per distinct (labels, roots) content and shared by
+every certificate that carries the same content. Usually that is all of
+them, and then an edge check costs one bit test per edge.
+
+Certificates are streamed from disk: one file per certificate in a
+directory, or a JSON Lines file with one certificate per line, and
+optionally checked on a process pool.
+"""
+import ast
+import json
+import os
+from dataclasses import dataclass
+from fractions import Fraction
+from multiprocessing import Pool
+from typing import Dict, Iterable, Iterator, List, Optional, Tuple, Union
+import sys
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from e8.roots import compute_gram_matrix
+from .format import validate_certificate_format
+from .verifier import CertificateVerifier
+
+
+@dataclass
+class VerificationOutcome:
+    """Result of verifying one certificate."""
+    # File path, "path:line" for JSON Lines, or the position in the input
+    source: str
+    valid: bool
+    message: str
+
+
+class _VerificationContext:
+    """Structures derived from one (atlas labels, roots) content."""
+
+    def __init__(self, label_strings: List[str], roots_dict: dict):
+        builder = CertificateVerifier()
+        self.labels = [ast.literal_eval(s) for s in label_strings]
+        self.roots = builder._parse_roots(roots_dict)
+
+        label_index = {lab: i for i, lab in enumerate(self.labels)}
+        self.tau = []
+        for e1, e2, e3, d45, e6, e7 in self.labels:
+            self.tau.append(label_index.get((e1, e2, e3, d45, e6, 1 - e7), -1))
+
+        root_index = {r: i for i, r in enumerate(self.roots)}
+        self.negation = [root_index.get(tuple(-x for x in r), -1) for r in self.roots]
+
+        self.edges = sorted(builder._build_atlas_edges(self.labels))
+
+        try:
+            gram = compute_gram_matrix(self.roots)
+        except ValueError:
+            # Roots off the half-integer lattice: exact rational products
+            gram = [[sum(a * b for a, b in zip(u, v)) for v in self.roots] for u in self.roots]
+        self.adjacent = [
+            sum(1 << j for j, x in enumerate(row) if x == 1) for row in gram
+        ]
+
+    def verify(self, cert: dict) -> Tuple[bool, str]:
+        """Run the CertificateVerifier checks on an already validated certificate."""
+        try:
+            mapping = [int(cert["mapping"][str(i)]) for i in range(96)]
+        except (KeyError, ValueError) as e:
+            return False, f"Format validation failed: bad mapping entry {e}"
+        if any(not 0 <= r < len(self.roots) for r in mapping):
+            return False, "Format validation failed: mapping refers to unknown roots"
+
+        checks = (
+            ("Injectivity", self._injectivity),
+            ("Mirror pairing", self._mirror_pairing),
+            ("Edge preservation", self._edge_preservation),
+            ("Unity constraint", self._unity_constraint),
+            ("Sign classes", self._sign_classes),
+        )
+        for check_name, check in checks:
+            passed, check_msg = check(mapping, cert)
+            if not passed:
+                return False, f"{check_name} failed: {check_msg}"
+        return True, "Certificate verified successfully"
+
+    def _injectivity(self, mapping: List[int], cert: dict) -> Tuple[bool, str]:
+        if len(set(mapping)) != len(mapping):
+            return False, "Mapping is not injective"
+        return True, ""
+
+    def _mirror_pairing(self, mapping: List[int], cert: dict) -> Tuple[bool, str]:
+        for i, t in enumerate(self.tau):
+            if t < 0 or self.negation[mapping[i]] != mapping[t]:
+                return False, f"Mirror pairing violated at vertex {i}"
+        return True, ""
+
+    def _edge_preservation(self, mapping: List[int], cert: dict) -> Tuple[bool, str]:
+        adjacent = self.adjacent
+        for i, j in self.edges:
+            if not adjacent[mapping[i]] >> mapping[j] & 1:
+                return False, f"Edge ({i},{j}) not preserved"
+        return True, ""
+
+    def _unity_constraint(self, mapping: List[int], cert: dict) -> Tuple[bool, str]:
+        unity_indices = cert["unity_indices"]
+        if not unity_indices:
+            return True, ""
+        sum_vec = [Fraction(0, 1)] * 8
+        for u in unity_indices:
+            root = self.roots[mapping[u]]
+            for k in range(8):
+                sum_vec[k] += root[k]
+        if any(x != 0 for x in sum_vec):
+            return False, f"Unity sum is not zero: {sum_vec}"
+        return True, ""
+
+    def _sign_classes(self, mapping: List[int], cert: dict) -> Tuple[bool, str]:
+        expected = cert.get("sign_classes_used", 48)
+        representatives = {
+            min(r, self.negation[r]) if self.negation[r] >= 0 else r for r in mapping
+        }
+        if len(representatives) != expected:
+            return False, f"Expected {expected} sign classes, got {len(representatives)}"
+        return True, ""
+
+
+# Per-process contexts, keyed by the certificate content they derive from
+_contexts: Dict[tuple, _VerificationContext] = {}
+
+
+def _context_for(cert: dict) -> _VerificationContext:
+    roots = cert["roots"]
+    key = (tuple(cert["atlas_labels"]), tuple(tuple(roots[str(i)]) for i in range(240)))
+    context = _contexts.get(key)
+    if context is None:
+        context = _VerificationContext(cert["atlas_labels"], roots)
+        _contexts[key] = context
+    return context
+
+
+def _verify_document(source: str, document: Union[str, dict]) -> VerificationOutcome:
+    """Parse (if needed), validate and check one certificate."""
+    if isinstance(document, str):
+        try:
+            cert = json.loads(document)
+        except json.JSONDecodeError as e:
+            return VerificationOutcome(source, False, f"Invalid JSON: {e}")
+    else:
+        cert = document
+
+    valid, msg = validate_certificate_format(cert)
+    if not valid:
+        return VerificationOutcome(source, False, f"Format validation failed: {msg}")
+
+    try:
+        context = _context_for(cert)
+    except (KeyError, ValueError, SyntaxError) as e:
+        return VerificationOutcome(source, False, f"Format validation failed: {e}")
+    passed, message = context.verify(cert)
+    return VerificationOutcome(source, passed, message)
+
+
+def _verify_item(item: Tuple[str, str, Optional[str]]) -> VerificationOutcome:
+    """Worker entry: ("file", path, None) or ("text", source, json)."""
+    kind, source, text = item
+    if kind == "file":
+        try:
+            with open(source, "r") as f:
+                text = f.read()
+        except OSError as e:
+            return VerificationOutcome(source, False, f"Unreadable certificate: {e}")
+    return _verify_document(source, text)
+
+
+def iter_certificate_items(path: str) -> Iterator[Tuple[str, str, Optional[str]]]:
+    """
+    Stream certificates from disk without loading them all.
+
+    Args:
+        path: A directory (every *.json file in it, sorted, one certificate
+            per file), a JSON Lines file (*.jsonl, one per line) or a single
+            certificate file
+
+    Yields:
+        Work items for _verify_item; files are only read when verified
+    """
+    if os.path.isdir(path):
+        for entry in sorted(os.listdir(path)):
+            if entry.endswith(".json"):
+                yield ("file", os.path.join(path, entry), None)
+    elif path.endswith(".jsonl"):
+        with open(path, "r") as f:
+            for line_number, line in enumerate(f, 1):
+                if line.strip():
+                    yield ("text", f"{path}:{line_number}", line)
+    else:
+        yield ("file", path, None)
+
+
+class BatchCertificateVerifier:
+    """Verifies many certificates, sharing derived structures between them."""
+
+    def __init__(self, processes: Optional[int] = 1, chunksize: int = 16, verbose: bool = False):
+        """
+        Initialize the batch verifier.
+
+        Args:
+            processes: Worker processes (1 verifies in-process, None uses one per CPU)
+            chunksize: Certificates handed to a worker at a time
+            verbose: Print each failure as it is found
+        """
+        self.processes = processes
+        self.chunksize = chunksize
+        self.verbose = verbose
+
+    def _run(self, items: Iterable[Tuple[str, str, Optional[str]]]) -> Iterator[VerificationOutcome]:
+        if self.processes == 1:
+            outcomes = map(_verify_item, items)
+            for outcome in outcomes:
+                self._report(outcome)
+                yield outcome
+            return
+        with Pool(self.processes) as pool:
+            for outcome in pool.imap(_verify_item, items, chunksize=self.chunksize):
+                self._report(outcome)
+                yield outcome
+
+    def _report(self, outcome: VerificationOutcome) -> None:
+        if self.verbose and not outcome.valid:
+            print(f"  {outcome.source}: {outcome.message}")
+
+    def verify_strings(self, certificates: Iterable[str]) -> Iterator[VerificationOutcome]:
+        """
+        Verify JSON certificate strings, in order.
+
+        Args:
+            certificates: Certificate JSON strings
+
+        Yields:
+            One outcome per certificate; source is its position in the input
+        """
+        return self._run(("text", str(i), text) for i, text in enumerate(certificates))
+
+    def verify_path(self, path: str) -> Iterator[VerificationOutcome]:
+        """
+        Verify certificates streamed from a directory or file, in order.
+
+        Args:
+            path: See iter_certificate_items
+
+        Yields:
+            One outcome per certificate
+        """
+        return self._run(iter_certificate_items(path))
+
+
+def verify_certificates(path: str, processes: Optional[int] = None,
+                        verbose: bool = False) -> Tuple[int, List[VerificationOutcome]]:
+    """
+    Convenience function to verify a batch of certificates from disk.
+
+    Args:
+        path: Directory, JSON Lines file or certificate file
+        processes: Worker processes (None for one per CPU)
+        verbose: Print failures as they are found
+
+    Returns:
+        (number verified, outcomes of the certificates that failed)
+    """
+    verifier = BatchCertificateVerifier(processes=processes, verbose=verbose)
+    count = 0
+    failures = []
+    for outcome in verifier.verify_path(path):
+        count += 1
+        if not outcome.valid:
+            failures.append(outcome)
+    if verbose:
+        print(f"Verified {count} certificates: {count - len(failures)} valid, {len(failures)} invalid")
+    return count, failures
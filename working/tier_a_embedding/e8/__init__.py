@@ -13,6 +13,8 @@ from .roots import (
     compute_negation_table,
     is_integer_root,
     is_half_integer_root,
+    double_root,
+    compute_gram_matrix,
     e8_roots,
 )
 from .geometry import (
@@ -22,8 +24,19 @@ from .geometry import (
     norm_squared,
     are_adjacent,
     compute_adjacency_graph,
+    compute_distance_table,
     build_GE8,
 )
+from .weyl import (
+    PermutationGroup,
+    WeylGroup,
+    E8_SIMPLE_ROOTS,
+    e8_weyl_group,
+    close_root_system,
+    compose,
+    invert,
+    element_order,
+)
 
 __all__ = [
     # Roots
@@ -35,6 +48,8 @@ __all__ = [
     "compute_negation_table",
     "is_integer_root",
     "is_half_integer_root",
+    "double_root",
+    "compute_gram_matrix",
     "e8_roots",
     # Geometry
     "E8Geometry",
@@ -43,5 +58,15 @@ __all__ = [
     "norm_squared",
     "are_adjacent",
     "compute_adjacency_graph",
+    "compute_distance_table",
     "build_GE8",
+    # Weyl groups
+    "PermutationGroup",
+    "WeylGroup",
+    "E8_SIMPLE_ROOTS",
+    "e8_weyl_group",
+    "close_root_system",
+    "compose",
+    "invert",
+    "element_order",
 ]
\ No newline at end of file
@@ -5,12 +5,13 @@ This module provides geometric operations on the E8 root system, including
 dot products, adjacency computation, and norm calculations.
 """
 from fractions import Fraction
-from typing import List, Set, Tuple
+from typing import List, Optional, Set, Tuple
 import sys
 import os
 sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
 from common_types import Root, EdgeSet, AdjacencyList, GraphStructure, E8_ROOT_DEGREE
+from .roots import compute_gram_matrix
 
 def dot_product(u: Root, v: Root) -> Fraction:
     """
@@ -52,7 +53,10 @@ def are_adjacent(u: Root, v: Root) -> bool:
     """
     return dot_product(u, v) == Fraction(1, 1)
 
-def compute_adjacency_graph(roots: List[Root]) -> Tuple[EdgeSet, AdjacencyList]:
+def compute_adjacency_graph(
+    roots: List[Root],
+    gram: Optional[List[List[int]]] = None
+) -> Tuple[EdgeSet, AdjacencyList]:
     """
     Compute the adjacency graph of the E8 root system.
 
@@ -61,22 +65,66 @@ def compute_adjacency_graph(roots: List[Root]) -> Tuple[EdgeSet, AdjacencyList]:
 
     Args:
         roots: List of E8 roots
+        gram: Their Gram matrix, if already computed
 
     Returns:
         Tuple of (edges, adjacency_list)
     """
+    if gram is None:
+        gram = compute_gram_matrix(roots)
+
     edges: EdgeSet = set()
     adj: AdjacencyList = [set() for _ in range(len(roots))]
 
-    for i in range(len(roots)):
+    for i, row in enumerate(gram):
         for j in range(i + 1, len(roots)):
-            if are_adjacent(roots[i], roots[j]):
+            if row[j] == 1:
                 edges.add((i, j))
                 adj[i].add(j)
                 adj[j].add(i)
 
     return edges, adj
 
+def compute_distance_table(adjacency: AdjacencyList) -> List[List[int]]:
+    """
+    Compute all-pairs shortest path distances in a graph.
+
+    Runs one breadth-first search per vertex over int bitsets, so each level
+    is a handful of OR operations rather than a queue of vertices.
+
+    Args:
+        adjacency: Adjacency list
+
+    Returns:
+        Matrix whose (i, j) entry is the distance from i to j, -1 if unreachable
+    """
+    n = len(adjacency)
+    masks = [sum(1 << j for j in adj) for adj in adjacency]
+    table: List[List[int]] = []
+
+    for source in range(n):
+        row = [-1] * n
+        row[source] = 0
+        seen = frontier = 1 << source
+        dist = 0
+        while frontier:
+            dist += 1
+            reached = 0
+            while frontier:
+                low = frontier & -frontier
+                frontier ^= low
+                reached |= masks[low.bit_length() - 1]
+            frontier = reached & ~seen
+            seen |= frontier
+            bits = frontier
+            while bits:
+                low = bits & -bits
+                bits ^= low
+                row[low.bit_length() - 1] = dist
+        table.append(row)
+
+    return table
+
 def verify_e8_geometry(roots: List[Root], adjacency: AdjacencyList) -> bool:
     """
     Verify the geometric invariants of the E8 root system.
@@ -175,15 +223,17 @@ class E8Geometry:
             roots: List of E8 roots
         """
         self.roots = roots
-        self.edges, self.adjacency = compute_adjacency_graph(roots)
+        self.gram = compute_gram_matrix(roots)
+        self.edges, self.adjacency = compute_adjacency_graph(roots, self.gram)
+        self.distances = compute_distance_table(self.adjacency)
 
         self._verify_invariants()
 
     def _verify_invariants(self) -> None:
         """Verify E8 geometric invariants."""
         # Check norm squared = 2 for all roots
-        for r in self.roots:
-            assert norm_squared(r) == Fraction(2, 1), "Each root must have norm squared = 2"
+        for i in range(len(self.roots)):
+            assert self.gram[i][i] == 2, "Each root must have norm squared = 2"
 
         # Check degree = 56 for all roots
         degrees = [len(adj) for adj in self.adjacency]
@@ -198,28 +248,10 @@ class E8Geometry:
             j: Second root index
 
         Returns:
-            Shortest path distance in the root graph
+            Shortest path distance in the root graph (-1 if not connected,
+            which cannot happen in E8)
         """
-        if i == j:
-            return 0
-
-        # BFS to find shortest path
-        from collections import deque
-        visited = [False] * len(self.roots)
-        queue = deque([(i, 0)])
-        visited[i] = True
-
-        while queue:
-            curr, dist = queue.popleft()
-            if curr == j:
-                return dist
-
-            for neighbor in self.adjacency[curr]:
-                if not visited[neighbor]:
-                    visited[neighbor] = True
-                    queue.append((neighbor, dist + 1))
-
-        return -1  # Not connected (shouldn't happen in E8)
+        return self.distances[i][j]
 
     def get_graph_structure(self) -> GraphStructure:
         """
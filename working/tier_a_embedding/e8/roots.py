@@ -6,13 +6,24 @@ This module generates the 240 roots of the E8 root system, consisting of
 """
 from fractions import Fraction
 from itertools import combinations, product
-from typing import List, Dict
+from typing import List, Dict, Tuple
 import sys
 import os
 sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
 from common_types import Root, RootIndex, E8_ROOT_COUNT, E8_INTEGER_ROOT_COUNT, E8_HALF_INTEGER_ROOT_COUNT
 
+try:
+    import numpy as np
+except ImportError:  # Pure-integer fallback below
+    np = None
+
+# A doubled root: 2·r, which has integer coordinates for every E8 root
+DoubledRoot = Tuple[int, ...]
+
+# Largest doubled coordinate whose 8-term inner products fit in int16
+_INT16_DOUBLED_BOUND = 63
+
 def generate_integer_roots() -> List[Root]:
     """
     Generate the 112 integer roots of E8.
@@ -121,6 +132,54 @@ def is_half_integer_root(r: Root) -> bool:
     """
     return all(x.denominator == 2 and abs(x.numerator) == 1 for x in r)
 
+def double_root(r: Root) -> DoubledRoot:
+    """
+    Encode a root as the integer vector 2·r.
+
+    Args:
+        r: A root vector with integer or half-integer coordinates
+
+    Returns:
+        Integer coordinates of 2·r
+
+    Raises:
+        ValueError: If a coordinate is not a multiple of 1/2
+    """
+    doubled = tuple(2 * Fraction(x) for x in r)
+    if any(x.denominator != 1 for x in doubled):
+        raise ValueError(f"Root coordinates must be multiples of 1/2: {r}")
+    return tuple(x.numerator for x in doubled)
+
+def compute_gram_matrix(roots: List[Root]) -> List[List[int]]:
+    """
+    Compute all inner products ⟨r_i, r_j⟩ exactly, as integers.
+
+    Works on the doubled encoding: ⟨2u, 2v⟩ = 4⟨u, v⟩, and E8 inner products
+    are integers, so dividing the integer product by 4 is exact. Uses one
+    NumPy matrix product when NumPy is installed and the coordinates are
+    small enough for int16, plain integers otherwise.
+
+    Args:
+        roots: List of roots
+
+    Returns:
+        Matrix whose (i, j) entry is ⟨roots[i], roots[j]⟩
+
+    Raises:
+        ValueError: If a coordinate is not a multiple of 1/2, or an inner
+            product is not an integer
+    """
+    doubled = [double_root(r) for r in roots]
+    if np is not None and all(abs(x) <= _INT16_DOUBLED_BOUND for d in doubled for x in d):
+        d = np.array(doubled, dtype=np.int16)
+        product = (d @ d.T).tolist()
+    else:
+        product = [[sum(a * b for a, b in zip(u, v)) for v in doubled] for u in doubled]
+
+    if any(x % 4 for row in product for x in row):
+        raise ValueError("Inner products must be integers")
+    return [[x // 4 for x in row] for row in product]
+
 def get_sign_class_representative(root_idx: int, negation_table: List[int]) -> int:
     """
     Get the canonical representative of a sign class {r, -r}.
@@ -156,6 +215,9 @@ class E8RootSystem:
         self.roots = generate_e8_roots()
         self.root_index = create_root_index(self.roots)
         self.negation_table = compute_negation_table(self.roots)
+        self._doubled = None
+        self._gram = None
+        self._adjacency = None
 
         self._verify_invariants()
 
@@ -206,6 +268,52 @@ class E8RootSystem:
         """
         return self.negation_table[index]
 
+    @property
+    def doubled_roots(self) -> List[DoubledRoot]:
+        """Roots in the doubled integer encoding (computed once)."""
+        if self._doubled is None:
+            self._doubled = [double_root(r) for r in self.roots]
+        return self._doubled
+
+    @property
+    def gram(self) -> List[List[int]]:
+        """Integer Gram matrix of the roots (computed once)."""
+        if self._gram is None:
+            self._gram = compute_gram_matrix(self.roots)
+        return self._gram
+
+    @property
+    def adjacency(self) -> List[List[bool]]:
+        """Adjacency matrix of the root graph: ⟨r_i, r_j⟩ = 1 (computed once)."""
+        if self._adjacency is None:
+            self._adjacency = [[x == 1 for x in row] for row in self.gram]
+        return self._adjacency
+
+    def is_adjacent(self, i: int, j: int) -> bool:
+        """
+        Check if two roots are adjacent in the root graph.
+
+        Args:
+            i: First root index
+            j: Second root index
+
+        Returns:
+            True if ⟨r_i, r_j⟩ = 1
+        """
+        return self.gram[i][j] == 1
+
+    def get_adjacent_roots(self, index: int) -> List[int]:
+        """
+        Get the indices of the roots adjacent to a root.
+
+        Args:
+            index: Root index
+
+        Returns:
+            Indices j with ⟨r_index, r_j⟩ = 1, ascending
+        """
+        return [j for j, x in enumerate(self.gram[index]) if x == 1]
+
     def get_sign_classes_used(self, root_indices: List[int]) -> int:
         """
         Count sign classes used by a set of roots.
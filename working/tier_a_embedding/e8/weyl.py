@@ -0,0 +1,427 @@
+"""
+Weyl groups as permutation groups on root indices.
+
+A Weyl group element is stored as the permutation it induces on a root
+list, for E8 the 240-root array of `e8/roots.py`. Order, membership and
+orbit queries go through a Schreier–Sims stabiliser chain, so groups the
+size of W(E8) (696,729,600 elements) are handled without enumerating them.
+"""
+from fractions import Fraction
+from math import lcm
+from typing import Dict, Iterable, List, Optional, Sequence, Set, Tuple
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from common_types import Root
+
+# A permutation of root indices: perm[i] is the image of root i
+Perm = Tuple[int, ...]
+
+def compose(p: Perm, q: Perm) -> Perm:
+    """
+    Compose two permutations, applying p first and then q.
+
+    Args:
+        p: First permutation
+        q: Second permutation
+
+    Returns:
+        The permutation i ↦ q[p[i]]
+    """
+    return tuple(q[x] for x in p)
+
+def invert(p: Perm) -> Perm:
+    """
+    Invert a permutation.
+
+    Args:
+        p: A permutation
+
+    Returns:
+        The inverse permutation
+    """
+    inv = [0] * len(p)
+    for i, x in enumerate(p):
+        inv[x] = i
+    return tuple(inv)
+
+def element_order(p: Perm) -> int:
+    """
+    Order of a permutation: the lcm of its cycle lengths.
+
+    Args:
+        p: A permutation
+
+    Returns:
+        Smallest n ≥ 1 with pⁿ the identity
+    """
+    seen = [False] * len(p)
+    result = 1
+    for start in range(len(p)):
+        length = 0
+        x = start
+        while not seen[x]:
+            seen[x] = True
+            x = p[x]
+            length += 1
+        if length:
+            result = lcm(result, length)
+    return result
+
+def reflect(beta: Root, alpha: Root) -> Root:
+    """
+    Reflect β in the hyperplane orthogonal to α.
+
+    s_α(β) = β − (2⟨β, α⟩ / ⟨α, α⟩) α, in exact rational arithmetic.
+
+    Args:
+        beta: Vector to reflect
+        alpha: Root defining the hyperplane
+
+    Returns:
+        The reflected vector
+    """
+    coefficient = 2 * sum(b * a for b, a in zip(beta, alpha)) / sum(a * a for a in alpha)
+    return tuple(b - coefficient * a for b, a in zip(beta, alpha))
+
+def reflection_permutation(roots: List[Root], alpha: Root,
+                           index: Optional[Dict[Root, int]] = None) -> Perm:
+    """
+    Express the reflection s_α as a permutation of a root list.
+
+    Args:
+        roots: Root list closed under s_α
+        alpha: Root defining the reflection
+        index: Root to position map of `roots`, if already built
+
+    Returns:
+        Permutation sending i to the position of s_α(roots[i])
+    """
+    if index is None:
+        index = {r: i for i, r in enumerate(roots)}
+    return tuple(index[reflect(r, alpha)] for r in roots)
+
+def close_root_system(simple_roots: Sequence[Root]) -> List[Root]:
+    """
+    Generate the root system spanned by a set of simple roots.
+
+    Every root is the image of a simple root under the Weyl group, so the
+    closure of the simple roots under the simple reflections is the whole
+    root system.
+
+    Args:
+        simple_roots: Simple roots with exact coordinates
+
+    Returns:
+        All roots, simple roots first, then in order of discovery
+    """
+    simple = [tuple(Fraction(x) for x in r) for r in simple_roots]
+    roots: List[Root] = []
+    seen: Set[Root] = set()
+    for r in simple:
+        if r not in seen:
+            seen.add(r)
+            roots.append(r)
+    for r in roots:
+        for alpha in simple:
+            image = reflect(r, alpha)
+            if image not in seen:
+                seen.add(image)
+                roots.append(image)
+    return roots
+
+
+class PermutationGroup:
+    """
+    Permutation group with a Schreier–Sims stabiliser chain.
+
+    The chain is a base b_0, b_1, … and, per level i, the strong generators
+    fixing b_0 … b_{i-1} with a transversal of the orbit of b_i under them.
+    The group order is the product of the orbit lengths.
+    """
+
+    def __init__(self, generators: Iterable[Perm], degree: int):
+        """
+        Build the stabiliser chain of the group generated by `generators`.
+
+        Args:
+            generators: Permutations of range(degree)
+            degree: Number of points acted on
+        """
+        self.degree = degree
+        self.identity: Perm = tuple(range(degree))
+        self.generators: List[Perm] = [tuple(g) for g in generators if tuple(g) != self.identity]
+        self.base: List[int] = []
+        self._strong: List[List[Perm]] = []
+        # Per level: orbit point -> permutation sending the base point there
+        self._transversals: List[Dict[int, Perm]] = []
+        self._schreier_sims()
+
+    def _moved_point(self, g: Perm) -> int:
+        """First point moved by a non-identity permutation."""
+        return next(i for i, x in enumerate(g) if x != i)
+
+    def _extend_base(self, g: Perm) -> None:
+        """Add a base point moved by g, which fixes every current base point."""
+        self.base.append(self._moved_point(g))
+        self._strong.append([])
+        self._transversals.append({})
+
+    def _build_transversal(self, level: int) -> None:
+        """Orbit of the level's base point under its strong generators."""
+        point = self.base[level]
+        transversal = {point: self.identity}
+        frontier = [point]
+        for x in frontier:
+            u = transversal[x]
+            for s in self._strong[level]:
+                y = s[x]
+                if y not in transversal:
+                    transversal[y] = compose(u, s)
+                    frontier.append(y)
+        self._transversals[level] = transversal
+
+    def _sift(self, g: Perm, start: int = 0) -> Tuple[Perm, int]:
+        """
+        Strip g through the chain.
+
+        Returns:
+            (residue, level): level is where stripping stopped, len(base)
+            when g passed every level; g is in the group exactly when the
+            residue is the identity at level len(base)
+        """
+        for level in range(start, len(self.base)):
+            x = g[self.base[level]]
+            u = self._transversals[level].get(x)
+            if u is None:
+                return g, level
+            g = compose(g, invert(u))
+        return g, len(self.base)
+
+    def _schreier_sims(self) -> None:
+        """Deterministic Schreier–Sims: every Schreier generator sifts to the identity."""
+        for g in self.generators:
+            if all(g[b] == b for b in self.base):
+                self._extend_base(g)
+        for level in range(len(self.base)):
+            self._strong[level] = [
+                g for g in self.generators if all(g[b] == b for b in self.base[:level])
+            ]
+            self._build_transversal(level)
+
+        level = len(self.base) - 1
+        while level >= 0:
+            restart = False
+            transversal = self._transversals[level]
+            for x, u in list(transversal.items()):
+                for s in self._strong[level]:
+                    # u_x · s · u_{s(x)}⁻¹ fixes the base point of this level
+                    h = compose(compose(u, s), invert(transversal[s[x]]))
+                    if h == self.identity:
+                        continue
+                    residue, stop = self._sift(h, level + 1)
+                    if stop == len(self.base) and residue == self.identity:
+                        continue
+                    if stop == len(self.base):
+                        self._extend_base(residue)
+                    for l in range(level + 1, stop + 1):
+                        self._strong[l].append(residue)
+                        self._build_transversal(l)
+                    level = stop
+                    restart = True
+                    break
+                if restart:
+                    break
+            if not restart:
+                level -= 1
+
+    def order(self) -> int:
+        """
+        Order of the group.
+
+        Returns:
+            Product of the basic orbit lengths
+        """
+        result = 1
+        for transversal in self._transversals:
+            result *= len(transversal)
+        return result
+
+    def contains(self, g: Sequence[int]) -> bool:
+        """
+        Test membership.
+
+        Args:
+            g: Permutation of range(degree)
+
+        Returns:
+            True if g is an element of the group
+        """
+        residue, stop = self._sift(tuple(g))
+        return stop == len(self.base) and residue == self.identity
+
+    def orbit(self, point: int) -> List[int]:
+        """
+        Orbit of a point.
+
+        Args:
+            point: A point in range(degree)
+
+        Returns:
+            The orbit, in breadth-first order from point
+        """
+        seen = {point}
+        orbit = [point]
+        for x in orbit:
+            for g in self.generators:
+                y = g[x]
+                if y not in seen:
+                    seen.add(y)
+                    orbit.append(y)
+        return orbit
+
+    def orbits(self) -> List[List[int]]:
+        """
+        Partition of range(degree) into orbits.
+
+        Returns:
+            Orbits ordered by their smallest point
+        """
+        placed: Set[int] = set()
+        result = []
+        for point in range(self.degree):
+            if point not in placed:
+                orbit = self.orbit(point)
+                placed.update(orbit)
+                result.append(sorted(orbit))
+        return result
+
+    def is_subgroup_of(self, other: 'PermutationGroup') -> bool:
+        """
+        Test inclusion by sifting the generators through the other chain.
+
+        Args:
+            other: Group on the same points
+
+        Returns:
+            True if every element of this group is in other
+        """
+        return all(other.contains(g) for g in self.generators)
+
+
+class WeylGroup(PermutationGroup):
+    """
+    Weyl group generated by reflections, acting on the indices of a root list.
+    """
+
+    def __init__(self, roots: List[Root], reflecting_roots: Sequence[Root]):
+        """
+        Build the group generated by reflections in `reflecting_roots`.
+
+        Args:
+            roots: Root list the group permutes (closed under the reflections)
+            reflecting_roots: Roots whose reflections generate the group
+        """
+        self.roots = roots
+        self.root_index = {r: i for i, r in enumerate(roots)}
+        self.reflecting_roots = [tuple(Fraction(x) for x in r) for r in reflecting_roots]
+        super().__init__(
+            [reflection_permutation(roots, alpha, self.root_index) for alpha in self.reflecting_roots],
+            len(roots),
+        )
+
+    @classmethod
+    def from_simple_roots(cls, simple_roots: Sequence[Root]) -> 'WeylGroup':
+        """
+        Weyl group of the root system with the given simple roots.
+
+        Args:
+            simple_roots: Simple roots with exact coordinates
+
+        Returns:
+            The group acting on close_root_system(simple_roots)
+        """
+        return cls(close_root_system(simple_roots), simple_roots)
+
+    def subgroup(self, root_indices: Sequence[int]) -> 'WeylGroup':
+        """
+        Reflection subgroup generated by some of the roots, on the same indices.
+
+        Args:
+            root_indices: Indices into self.roots
+
+        Returns:
+            The subgroup, as a WeylGroup on self.roots
+        """
+        return WeylGroup(self.roots, [self.roots[i] for i in root_indices])
+
+    def root_subsystem(self) -> List[int]:
+        """
+        Indices of the roots of this reflection subgroup's root system.
+
+        Returns:
+            Sorted union of the orbits of the reflecting roots
+        """
+        members: Set[int] = set()
+        for alpha in self.reflecting_roots:
+            members.update(self.orbit(self.root_index[alpha]))
+        return sorted(members)
+
+    def negation(self) -> Perm:
+        """
+        The map r ↦ −r as a permutation (an element only when −1 ∈ W).
+
+        Returns:
+            Permutation sending i to the position of −roots[i]
+        """
+        return tuple(self.root_index[tuple(-x for x in r)] for r in self.roots)
+
+    def reflection(self, root_index: int) -> Perm:
+        """
+        Reflection in one of the roots as a permutation.
+
+        Args:
+            root_index: Index into self.roots
+
+        Returns:
+            The reflection permutation
+        """
+        return reflection_permutation(self.roots, self.roots[root_index], self.root_index)
+
+
+def _half(*coords: int) -> Root:
+    return tuple(Fraction(c, 2) for c in coords)
+
+def _unit(i: int, j: int, sj: int = 1, si: int = 1) -> Root:
+    v = [Fraction(0)] * 8
+    v[i] = Fraction(si)
+    v[j] = Fraction(sj)
+    return tuple(v)
+
+# Bourbaki simple roots of E8 in the coordinates of e8/roots.py; the first
+# six span E6 and the first seven E7
+E8_SIMPLE_ROOTS: List[Root] = [
+    _half(1, -1, -1, -1, -1, -1, -1, 1),
+    _unit(0, 1),
+    _unit(0, 1, si=-1),
+    _unit(1, 2, si=-1),
+    _unit(2, 3, si=-1),
+    _unit(3, 4, si=-1),
+    _unit(4, 5, si=-1),
+    _unit(5, 6, si=-1),
+]
+
+def e8_weyl_group(roots: List[Root], rank: int = 8) -> WeylGroup:
+    """
+    Weyl group of E6, E7 or E8 acting on the 240 E8 root indices.
+
+    Args:
+        roots: The E8 roots (E8RootSystem.roots)
+        rank: 6, 7 or 8, taking the first `rank` Bourbaki simple roots
+
+    Returns:
+        The Weyl group as a group of permutations of range(240)
+    """
+    assert rank in (6, 7, 8), "Only the E6 ⊂ E7 ⊂ E8 chain is supported"
+    return WeylGroup(roots, E8_SIMPLE_ROOTS[:rank])
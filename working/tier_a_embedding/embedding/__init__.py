@@ -7,17 +7,41 @@ This module implements the backtracking search for Tier-A embeddings.
 from .result import EmbeddingResult
 from .search import (
     EmbeddingSearch,
+    BitsetEmbeddingSearch,
     EmbeddingConstraints,
     find_embedding,
     tierA_search,
 )
+from .parallel import (
+    SymmetryBreaker,
+    SymmetryBrokenSearch,
+    EnumerationResult,
+    enumerate_embeddings,
+)
+from .runner import (
+    SearchCheckpoint,
+    SearchProgress,
+    SearchRunner,
+    merge_checkpoints,
+)
 
 __all__ = [
     # Result
     "EmbeddingResult",
     # Search
     "EmbeddingSearch",
+    "BitsetEmbeddingSearch",
     "EmbeddingConstraints",
     "find_embedding",
     "tierA_search",
+    # Parallel enumeration
+    "SymmetryBreaker",
+    "SymmetryBrokenSearch",
+    "EnumerationResult",
+    "enumerate_embeddings",
+    # Checkpointed runs
+    "SearchCheckpoint",
+    "SearchProgress",
+    "SearchRunner",
+    "merge_checkpoints",
 ]
\ No newline at end of file
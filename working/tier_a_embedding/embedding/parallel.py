@@ -0,0 +1,312 @@
+"""
+Parallel, symmetry-broken embedding enumeration.
+
+The search tree is cut after the first few τ-pair assignments. Each prefix
+becomes an independent work unit, and the units run on a multiprocessing
+pool. Of every orbit under S4 × {±1}, only the lex-leader is enumerated.
+"""
+from dataclasses import dataclass, field
+from multiprocessing import Pool
+from typing import List, Optional, Tuple
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from atlas.symmetry import generate_s4_automorphism_group
+from .search import BitsetEmbeddingSearch, EmbeddingConstraints
+
+# A work unit: (pair representative, root) assignments fixed before the search
+Prefix = Tuple[Tuple[int, int], ...]
+
+
+class SymmetryBreaker:
+    """
+    Lex-leader test for embeddings under S4 × {±1}.
+
+    Two embeddings are equivalent when one is the other composed with an
+    S4 automorphism of G_A, optionally followed by negating every root. The
+    τ mirror adds nothing: an embedding composed with τ is its negation.
+    Mappings are compared along `order`, which lists pair representatives,
+    each followed by its mirror. Pairs are ordered breadth-first from a pair
+    S4 fixes, each pair's S4 orbit kept contiguous and moved orbits reached
+    before fixed ones, so the first pairs are
+    close together (small domains) and the lex comparison against S4 images
+    is decided a few pairs into the order rather than at the leaves.
+    """
+
+    def __init__(self, atlas_graph, negation_table: List[int]):
+        """
+        Initialize the symmetry breaker.
+
+        Args:
+            atlas_graph: AtlasGraph instance
+            negation_table: Root negation table
+        """
+        tau = atlas_graph.tau
+        self.negation_table = negation_table
+        automorphisms = generate_s4_automorphism_group(atlas_graph.labels)
+        identity = tuple(range(len(tau)))
+        self.elements = [
+            (perm, negate)
+            for perm in automorphisms
+            for negate in (False, True)
+            if perm != identity or negate
+        ]
+        self.group_order = len(self.elements) + 1
+
+        pair_of = [min(v, tau[v]) for v in range(len(tau))]
+        orbit_of = {
+            p: sorted({pair_of[perm[p]] for perm in automorphisms})
+            for p in set(pair_of)
+        }
+        pairs: List[int] = []
+        placed = set()
+        for start in sorted(orbit_of, key=lambda p: (len(orbit_of[p]), p)):
+            if start in placed:
+                continue
+            queue = [start]
+            placed.update(orbit_of[start])
+            pairs.extend(orbit_of[start])
+            for p in queue:
+                neighbors = atlas_graph.adjacency[p] | atlas_graph.adjacency[tau[p]]
+                for u in sorted(neighbors, key=lambda u: (len(orbit_of[pair_of[u]]) == 1, u)):
+                    q = pair_of[u]
+                    if q not in placed:
+                        placed.update(orbit_of[q])
+                        pairs.extend(orbit_of[q])
+                        queue.extend(orbit_of[q])
+        self.order = [u for p in pairs for u in (p, tau[p])]
+
+    def _compare(self, mapping: List[int], perm: Tuple[int, ...], negate: bool) -> int:
+        """
+        Compare the image of mapping under (perm, negate) with mapping.
+
+        Unassigned vertices (-1) end the comparison, so a partial mapping
+        only compares on its assigned prefix of `order`.
+
+        Returns:
+            -1 if the image is smaller, 1 if larger, 0 if equal or undecided
+        """
+        neg = self.negation_table
+        for v in self.order:
+            own = mapping[v]
+            image = mapping[perm[v]]
+            if own == -1 or image == -1:
+                return 0
+            if negate:
+                image = neg[image]
+            if image != own:
+                return -1 if image < own else 1
+        return 0
+
+    def is_partial_leader(self, mapping: List[int]) -> bool:
+        """
+        Check no symmetry maps an assigned prefix below itself.
+
+        Args:
+            mapping: Partial mapping, -1 for unassigned vertices
+
+        Returns:
+            False when every completion of mapping is a non-leader
+        """
+        return all(self._compare(mapping, perm, negate) >= 0 for perm, negate in self.elements)
+
+    def leader_stabilizer(self, mapping: List[int]) -> Optional[int]:
+        """
+        Test a complete mapping for being the leader of its orbit.
+
+        Args:
+            mapping: Complete vertex to root mapping
+
+        Returns:
+            Order of the stabilizer of mapping, or None if not the leader
+        """
+        stabilizer = 1
+        for perm, negate in self.elements:
+            comparison = self._compare(mapping, perm, negate)
+            if comparison < 0:
+                return None
+            if comparison == 0:
+                stabilizer += 1
+        return stabilizer
+
+
+class SymmetryBrokenSearch(BitsetEmbeddingSearch):
+    """Bitset search that keeps orbit leaders only and counts their orbits."""
+
+    def __init__(self, atlas_graph, e8_system):
+        super().__init__(atlas_graph, e8_system)
+        self.breaker = SymmetryBreaker(self.atlas, self.e8.negation_table)
+        self.orbit_count = 0
+        self.embedding_count = 0
+
+    def search(self, constraints: EmbeddingConstraints) -> List[List[int]]:
+        self.orbit_count = 0
+        self.embedding_count = 0
+        return super().search(constraints)
+
+    def _record_solution(self) -> None:
+        stabilizer = self.breaker.leader_stabilizer(self.mapping)
+        if stabilizer is None:
+            return
+        self.orbit_count += 1
+        self.embedding_count += self.breaker.group_order // stabilizer
+        super()._record_solution()
+
+    def _assign(self, p: int, root: int, domains):
+        remaining = super()._assign(p, root, domains)
+        if remaining is not None and not self.breaker.is_partial_leader(self.mapping):
+            self._unassign(p)
+            return None
+        return remaining
+
+    def split(self, depth: int, prefix: Prefix = ()) -> List[Prefix]:
+        """
+        Enumerate the work units of the first `depth` pairs of the order.
+
+        Prefixes that forward checking empties, or that cannot extend to an
+        orbit leader, are dropped; the same pruning applies at every node of
+        the unit searches. Given a unit `prefix` of the first k pairs, only
+        its extensions to `depth` pairs are enumerated; with depth k + 1 this
+        splits one unit into the units one level below it.
+
+        Args:
+            depth: Number of pairs to fix per unit
+            prefix: Unit to split, fixing a leading part of the order
+
+        Returns:
+            Work unit prefixes in search order
+        """
+        pairs = self.breaker.order[2 * len(prefix):2 * depth:2]
+        self.mapping = [-1] * len(self.atlas.labels)
+        self.used_roots = [False] * len(self.e8.roots)
+        units: List[Prefix] = []
+
+        def extend(level: int, domains, prefix: Prefix) -> None:
+            if level == len(pairs):
+                units.append(prefix)
+                return
+            p = pairs[level]
+            candidates = domains[p]
+            while candidates:
+                low = candidates & -candidates
+                candidates ^= low
+                root = low.bit_length() - 1
+                remaining = self._assign(p, root, domains)
+                if remaining is None:
+                    continue
+                extend(level + 1, remaining, prefix + ((p, root),))
+                self._unassign(p)
+
+        domains = {p: self.full_mask for p in self.representatives}
+        for p, root in prefix:
+            domains = self._assign(p, root, domains)
+            if domains is None:
+                break
+        else:
+            extend(0, domains, prefix)
+        for p, _ in prefix:
+            self._unassign(p)
+        return units
+
+
+@dataclass
+class EnumerationResult:
+    """Outcome of a symmetry-broken enumeration."""
+    # One leader per orbit found, sorted
+    representatives: List[List[int]] = field(default_factory=list)
+    orbits: int = 0
+    # Embeddings in those orbits, leaders included
+    embeddings: int = 0
+    units: int = 0
+    nodes: int = 0
+    # False when max_orbits stopped the enumeration early
+    complete: bool = True
+
+
+_worker: Optional[SymmetryBrokenSearch] = None
+
+
+def _init_worker(atlas_graph, e8_system) -> None:
+    """Build the per-process search once; units reuse its masks."""
+    global _worker
+    _worker = SymmetryBrokenSearch(atlas_graph, e8_system)
+
+
+def _run_unit(args: Tuple[Prefix, int, Optional[int]]):
+    """Search one work unit in the worker process."""
+    prefix, max_solutions, target_signs = args
+    constraints = EmbeddingConstraints(
+        max_solutions=max_solutions,
+        target_signs=target_signs,
+        required_mapping=dict(prefix),
+    )
+    leaders = _worker.search(constraints)
+    return leaders, _worker.orbit_count, _worker.embedding_count, _worker.nodes
+
+
+def enumerate_embeddings(
+    atlas_graph,
+    e8_system,
+    max_orbits: Optional[int] = None,
+    split_depth: int = 2,
+    processes: Optional[int] = None,
+    target_signs: Optional[int] = None,
+    verbose: bool = False
+) -> EnumerationResult:
+    """
+    Enumerate embeddings up to S4 × {±1} symmetry.
+
+    Units are handed to idle workers one at a time, so long subtrees do not
+    hold up the rest of the pool.
+
+    Args:
+        atlas_graph: AtlasGraph instance
+        e8_system: E8RootSystem instance
+        max_orbits: Stop after this many orbits (None enumerates all)
+        split_depth: Pairs fixed per work unit
+        processes: Worker processes (None for one per CPU, 1 for in-process)
+        target_signs: Optional sign class count every embedding must use
+        verbose: Print progress per finished unit
+
+    Returns:
+        EnumerationResult with the orbit leaders and counts
+    """
+    search = SymmetryBrokenSearch(atlas_graph, e8_system)
+    units = search.split(split_depth)
+    limit = max_orbits if max_orbits is not None else sys.maxsize
+    jobs = [(prefix, limit, target_signs) for prefix in units]
+    result = EnumerationResult(units=len(units))
+
+    if verbose:
+        print(f"Enumerating {len(units)} work units (split depth {split_depth})")
+
+    def collect(outcome) -> bool:
+        leaders, orbits, embeddings, nodes = outcome
+        result.representatives.extend(leaders)
+        result.orbits += orbits
+        result.embeddings += embeddings
+        result.nodes += nodes
+        return result.orbits >= limit
+
+    finished = 0
+    if processes == 1:
+        _init_worker(atlas_graph, e8_system)
+        for job in jobs:
+            finished += 1
+            if collect(_run_unit(job)):
+                break
+    else:
+        with Pool(processes, initializer=_init_worker, initargs=(atlas_graph, e8_system)) as pool:
+            for outcome in pool.imap_unordered(_run_unit, jobs, chunksize=1):
+                finished += 1
+                if verbose:
+                    print(f"  Unit {finished}/{len(units)}: {result.orbits} orbits so far")
+                if collect(outcome):
+                    pool.terminate()
+                    break
+
+    result.complete = finished == len(units) and result.orbits < limit
+    order = search.breaker.order
+    result.representatives.sort(key=lambda m: [m[v] for v in order])
+    return result
@@ -0,0 +1,626 @@
+"""
+Resumable, checkpointed embedding enumeration.
+
+A run searches the work units of SymmetryBrokenSearch.split as
+enumerate_embeddings does, and records its progress in a JSON checkpoint:
+the units still to search (the frontier) and the counters. The orbit
+leaders found go to an append-only JSON-lines file beside it, of which the
+checkpoint records the valid length, so a checkpoint costs the size of the
+frontier rather than of every solution so far. The checkpoint is rewritten
+every `checkpoint_interval` seconds, when the run ends and when it is
+interrupted (Ctrl-C or SIGTERM). It is written to a temporary file and
+renamed into place, so a pre-empted run always leaves a complete checkpoint
+behind. Starting a run on an existing checkpoint resumes it: leaders past
+the recorded length are dropped, and units that were in flight when the
+run stopped are searched again.
+
+Units vary enormously in size, so a unit search gives up after
+`max_unit_nodes` nodes and the unit is split one pair deeper into the
+frontier. The abandoned partial search is discarded; its leaders are found
+again below the split. This bounds the work a pre-emption can lose. Every
+unit has a key, its position in the tree of splits, and units are searched
+and stored in key order.
+
+Shard i of n takes every n-th initial unit starting at i, so n machines can
+each run one shard into their own checkpoint; merge_checkpoints combines
+them.
+
+SearchProgress reports nodes per second, the mean branching factor of the
+bitset search and the remaining work, extrapolated from the mean nodes per
+finished unit. Everything is integer arithmetic.
+"""
+from collections import deque
+from contextlib import contextmanager
+from dataclasses import dataclass
+from fractions import Fraction
+from multiprocessing import Pool, cpu_count
+from queue import SimpleQueue
+from typing import Callable, Dict, List, Optional, Sequence, Tuple
+import hashlib
+import json
+import os
+import signal
+import tempfile
+import time
+import sys
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from . import parallel
+from .parallel import EnumerationResult, Prefix, SymmetryBreaker, SymmetryBrokenSearch
+from .search import EmbeddingConstraints
+
+# Bump when the checkpoint layout changes
+CHECKPOINT_VERSION = 1
+
+# Position of a unit: index among the initial units, then child indices
+UnitKey = Tuple[int, ...]
+
+
+def leaders_path(checkpoint_path: str) -> str:
+    """Orbit leaders file of a checkpoint."""
+    return checkpoint_path + ".leaders.jsonl"
+
+
+def read_leaders(checkpoint_path: str, length: int) -> List[List[int]]:
+    """The leaders within the first `length` bytes of a leaders file."""
+    if length == 0:
+        return []
+    with open(leaders_path(checkpoint_path), "rb") as f:
+        data = f.read(length)
+    return [json.loads(line) for line in data.splitlines()]
+
+
+def units_fingerprint(units: Sequence[Prefix]) -> str:
+    """SHA-256 of a complete initial unit list; shards of one run share it."""
+    return hashlib.sha256(repr([list(map(list, u)) for u in units]).encode()).hexdigest()
+
+
+@dataclass
+class SearchCheckpoint:
+    """State of one shard of a checkpointed enumeration."""
+    split_depth: int
+    target_signs: Optional[int]
+    max_orbits: Optional[int]
+    max_unit_nodes: Optional[int]
+    # (index, count) of this shard
+    shard: Tuple[int, int]
+    # Hash of the unsharded initial unit list
+    fingerprint: str
+    # Units not yet searched, in key order
+    frontier: List[Tuple[UnitKey, Prefix]]
+    # Bytes of the leaders file holding the leaders found so far
+    leaders_bytes: int = 0
+    # Units searched to the end, and units given up and split
+    finished: int = 0
+    resplit: int = 0
+    orbits: int = 0
+    embeddings: int = 0
+    # Nodes of finished units; nodes of abandoned unit searches
+    nodes: int = 0
+    discarded_nodes: int = 0
+    expansions: int = 0
+    # Wall time spent searching, summed over every run of this shard
+    elapsed_ns: int = 0
+
+    @property
+    def units(self) -> int:
+        """Units finished or still to search."""
+        return self.finished + len(self.frontier)
+
+    @property
+    def stopped(self) -> bool:
+        """True when max_orbits has been reached."""
+        return self.max_orbits is not None and self.orbits >= self.max_orbits
+
+    @property
+    def complete(self) -> bool:
+        """True when every unit was searched without reaching max_orbits."""
+        return not self.frontier and not self.stopped
+
+    def same_run(self, other: "SearchCheckpoint") -> bool:
+        """True when both checkpoints are shards of the same enumeration."""
+        return (
+            self.split_depth == other.split_depth
+            and self.target_signs == other.target_signs
+            and self.max_orbits == other.max_orbits
+            and self.shard[1] == other.shard[1]
+            and self.fingerprint == other.fingerprint
+        )
+
+    def progress(self) -> "SearchProgress":
+        """Telemetry for the state recorded in this checkpoint."""
+        return SearchProgress(
+            units_done=self.finished,
+            units_left=len(self.frontier),
+            nodes=self.nodes,
+            discarded_nodes=self.discarded_nodes,
+            expansions=self.expansions,
+            elapsed_ns=self.elapsed_ns,
+            orbits=self.orbits,
+        )
+
+    def save(self, path: str) -> None:
+        """Write the checkpoint atomically."""
+        document = {
+            "version": CHECKPOINT_VERSION,
+            "split_depth": self.split_depth,
+            "target_signs": self.target_signs,
+            "max_orbits": self.max_orbits,
+            "max_unit_nodes": self.max_unit_nodes,
+            "shard": list(self.shard),
+            "fingerprint": self.fingerprint,
+            "frontier": [[list(key), list(map(list, unit))] for key, unit in self.frontier],
+            "leaders_bytes": self.leaders_bytes,
+            "finished": self.finished,
+            "resplit": self.resplit,
+            "orbits": self.orbits,
+            "embeddings": self.embeddings,
+            "nodes": self.nodes,
+            "discarded_nodes": self.discarded_nodes,
+            "expansions": self.expansions,
+            "elapsed_ns": self.elapsed_ns,
+        }
+        directory = os.path.dirname(os.path.abspath(path))
+        os.makedirs(directory, exist_ok=True)
+        fd, temporary = tempfile.mkstemp(dir=directory, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "w") as f:
+                json.dump(document, f, separators=(",", ":"))
+            os.replace(temporary, path)
+        except BaseException:
+            os.unlink(temporary)
+            raise
+
+    @classmethod
+    def load(cls, path: str) -> "SearchCheckpoint":
+        """
+        Read a checkpoint written by save.
+
+        Raises:
+            ValueError: If the file was written by a different layout version
+        """
+        with open(path) as f:
+            document = json.load(f)
+        if document.get("version") != CHECKPOINT_VERSION:
+            raise ValueError(f"{path}: checkpoint version {document.get('version')}, "
+                             f"expected {CHECKPOINT_VERSION}")
+        return cls(
+            split_depth=document["split_depth"],
+            target_signs=document["target_signs"],
+            max_orbits=document["max_orbits"],
+            max_unit_nodes=document["max_unit_nodes"],
+            shard=tuple(document["shard"]),
+            fingerprint=document["fingerprint"],
+            frontier=[(tuple(key), tuple(map(tuple, unit))) for key, unit in document["frontier"]],
+            leaders_bytes=document["leaders_bytes"],
+            finished=document["finished"],
+            resplit=document["resplit"],
+            orbits=document["orbits"],
+            embeddings=document["embeddings"],
+            nodes=document["nodes"],
+            discarded_nodes=document["discarded_nodes"],
+            expansions=document["expansions"],
+            elapsed_ns=document["elapsed_ns"],
+        )
+
+
+def format_duration(ns: int) -> str:
+    """Nanoseconds as h:mm:ss, rounded down."""
+    seconds = ns // 1_000_000_000
+    return f"{seconds // 3600}:{seconds // 60 % 60:02d}:{seconds % 60:02d}"
+
+
+@dataclass
+class SearchProgress:
+    """Telemetry snapshot of a running enumeration."""
+    units_done: int
+    units_left: int
+    nodes: int
+    discarded_nodes: int
+    expansions: int
+    elapsed_ns: int
+    orbits: int
+
+    @property
+    def nodes_per_second(self) -> int:
+        """Search nodes per second of wall time, over every worker."""
+        if self.elapsed_ns == 0:
+            return 0
+        return (self.nodes + self.discarded_nodes) * 1_000_000_000 // self.elapsed_ns
+
+    @property
+    def branching_factor(self) -> Optional[Fraction]:
+        """Mean assignments tried per branching node of the finished units."""
+        if self.expansions == 0:
+            return None
+        return Fraction(self.nodes, self.expansions)
+
+    @property
+    def remaining_nodes(self) -> Optional[int]:
+        """
+        Nodes left, assuming each unsearched unit costs what a finished one
+        did on average, abandoned searches before its split included.
+        """
+        if self.units_done == 0:
+            return None
+        return (self.nodes + self.discarded_nodes) * self.units_left // self.units_done
+
+    @property
+    def eta_ns(self) -> Optional[int]:
+        """Wall time left at the current node rate."""
+        remaining = self.remaining_nodes
+        rate = self.nodes_per_second
+        if remaining is None or rate == 0:
+            return None
+        return remaining * 1_000_000_000 // rate
+
+    def format(self) -> str:
+        """One-line report."""
+        line = (f"{self.units_done}/{self.units_done + self.units_left} units, "
+                f"{self.orbits} orbits, {self.nodes + self.discarded_nodes} nodes, "
+                f"{self.nodes_per_second} nodes/s")
+        branching = self.branching_factor
+        if branching is not None:
+            hundredths = branching.numerator * 100 // branching.denominator
+            line += f", branching {hundredths // 100}.{hundredths % 100:02d}"
+        eta = self.eta_ns
+        if eta is not None:
+            line += f", ~{self.remaining_nodes} nodes left, ETA {format_duration(eta)}"
+        return line
+
+
+def _init_runner_worker(atlas_graph, e8_system) -> None:
+    """Worker initializer; the parent alone handles Ctrl-C and checkpoints."""
+    signal.signal(signal.SIGINT, signal.SIG_IGN)
+    parallel._init_worker(atlas_graph, e8_system)
+
+
+def _run_budgeted_unit(args):
+    """Search one unit in the worker process, up to a node budget."""
+    key, prefix, max_solutions, target_signs, max_nodes = args
+    constraints = EmbeddingConstraints(
+        max_solutions=max_solutions,
+        target_signs=target_signs,
+        required_mapping=dict(prefix),
+        max_nodes=max_nodes,
+    )
+    worker = parallel._worker
+    leaders = worker.search(constraints)
+    return (key, leaders, worker.orbit_count, worker.embedding_count,
+            worker.nodes, worker.expansions, worker.truncated)
+
+
+class _Interrupts:
+    """
+    SIGINT and SIGTERM as KeyboardInterrupt, held back inside critical().
+
+    A signal arriving inside a critical section is raised when the section
+    ends, so the run state it updates is never left half done.
+    """
+
+    def __init__(self):
+        self.depth = 0
+        self.pending = False
+
+    @contextmanager
+    def critical(self):
+        self.depth += 1
+        try:
+            yield
+        finally:
+            self.depth -= 1
+        if self.depth == 0 and self.pending:
+            self.pending = False
+            raise KeyboardInterrupt
+
+
+@contextmanager
+def _deferred_interrupts():
+    """Within the block, SIGINT and SIGTERM go through an _Interrupts."""
+    pid = os.getpid()
+    interrupts = _Interrupts()
+
+    def handle(signum, frame):
+        if os.getpid() != pid:
+            # A pool worker forked inside the block: die as the signal would
+            os._exit(128 + signum)
+        if interrupts.depth:
+            interrupts.pending = True
+        else:
+            raise KeyboardInterrupt
+
+    try:
+        previous = {sig: signal.signal(sig, handle) for sig in (signal.SIGINT, signal.SIGTERM)}
+    except ValueError:
+        # Not the main thread, where only the default handling is possible
+        yield interrupts
+        return
+    try:
+        yield interrupts
+    finally:
+        for sig, handler in previous.items():
+            signal.signal(sig, handler)
+
+
+class SearchRunner:
+    """
+    Checkpointed, resumable, shardable enumerate_embeddings.
+
+    Attributes:
+        checkpoint_path: JSON checkpoint of this shard
+        checkpoint: State of the last run, once run has been called
+    """
+
+    def __init__(
+        self,
+        atlas_graph,
+        e8_system,
+        checkpoint_path: str,
+        split_depth: int = 2,
+        max_orbits: Optional[int] = None,
+        target_signs: Optional[int] = None,
+        max_unit_nodes: Optional[int] = 200_000,
+        shard: Tuple[int, int] = (0, 1),
+        processes: Optional[int] = None,
+        checkpoint_interval: int = 60,
+        report_interval: int = 10,
+        progress: Optional[Callable[[SearchProgress], None]] = None,
+        verbose: bool = False
+    ):
+        """
+        Initialize the runner.
+
+        Args:
+            atlas_graph: AtlasGraph instance
+            e8_system: E8RootSystem instance
+            checkpoint_path: Checkpoint to resume from and write to
+            split_depth: Pairs fixed per initial work unit
+            max_orbits: Stop this shard after this many orbits (None for all)
+            target_signs: Optional sign class count every embedding must use
+            max_unit_nodes: Split units whose search exceeds this (None never splits)
+            shard: (index, count); this runner takes initial units index, index + count, ...
+            processes: Worker processes (None for one per CPU, 1 for in-process)
+            checkpoint_interval: Seconds between checkpoints
+            report_interval: Seconds between progress reports
+            progress: Called with a SearchProgress at every report
+            verbose: Print progress reports
+        """
+        index, count = shard
+        if not 0 <= index < count:
+            raise ValueError(f"Shard index {index} out of range for {count} shards")
+        self.atlas = atlas_graph
+        self.e8 = e8_system
+        self.checkpoint_path = checkpoint_path
+        self.split_depth = split_depth
+        self.max_orbits = max_orbits
+        self.target_signs = target_signs
+        self.max_unit_nodes = max_unit_nodes
+        self.shard = (index, count)
+        self.processes = processes
+        self.checkpoint_interval_ns = checkpoint_interval * 1_000_000_000
+        self.report_interval_ns = report_interval * 1_000_000_000
+        self.progress = progress
+        self.verbose = verbose
+        self.checkpoint: Optional[SearchCheckpoint] = None
+
+    def _open_checkpoint(self, search: SymmetryBrokenSearch) -> SearchCheckpoint:
+        """
+        Resume the checkpoint on disk, or split a fresh run and save it.
+
+        Raises:
+            ValueError: If the checkpoint on disk belongs to another run
+        """
+        requested = (self.split_depth, self.target_signs, self.max_orbits,
+                     self.max_unit_nodes, self.shard)
+        if os.path.exists(self.checkpoint_path):
+            checkpoint = SearchCheckpoint.load(self.checkpoint_path)
+            stored = (checkpoint.split_depth, checkpoint.target_signs, checkpoint.max_orbits,
+                      checkpoint.max_unit_nodes, checkpoint.shard)
+            if requested != stored:
+                raise ValueError(
+                    f"{self.checkpoint_path} holds (split_depth, target_signs, max_orbits, "
+                    f"max_unit_nodes, shard) = {stored}, not {requested}"
+                )
+            if self.verbose:
+                print(f"Resuming {self.checkpoint_path}: {checkpoint.progress().format()}")
+            return checkpoint
+
+        units = search.split(self.split_depth)
+        index, count = self.shard
+        checkpoint = SearchCheckpoint(
+            split_depth=self.split_depth,
+            target_signs=self.target_signs,
+            max_orbits=self.max_orbits,
+            max_unit_nodes=self.max_unit_nodes,
+            shard=self.shard,
+            fingerprint=units_fingerprint(units),
+            frontier=[((i,), units[i]) for i in range(index, len(units), count)],
+        )
+        checkpoint.save(self.checkpoint_path)
+        if self.verbose:
+            print(f"Starting {self.checkpoint_path}: {checkpoint.units} of {len(units)} "
+                  f"units (split depth {self.split_depth}, shard {index}/{count})")
+        return checkpoint
+
+    def run(self) -> EnumerationResult:
+        """
+        Search the frontier of the checkpoint, checkpointing as it goes.
+
+        Returns:
+            EnumerationResult of this shard, over every run so far
+
+        Raises:
+            KeyboardInterrupt: On Ctrl-C or SIGTERM, after the checkpoint is saved
+        """
+        search = SymmetryBrokenSearch(self.atlas, self.e8)
+        checkpoint = self._open_checkpoint(search)
+        self.checkpoint = checkpoint
+
+        limit = self.max_orbits if self.max_orbits is not None else sys.maxsize
+        pending: Dict[UnitKey, Prefix] = dict(checkpoint.frontier)
+        queue = deque(pending)
+
+        # Drop leaders written after the last checkpoint
+        leaders_file = open(leaders_path(self.checkpoint_path), "ab")
+        if leaders_file.tell() < checkpoint.leaders_bytes:
+            leaders_file.close()
+            raise ValueError(f"{leaders_path(self.checkpoint_path)} is shorter than "
+                             f"its checkpoint records")
+        leaders_file.truncate(checkpoint.leaders_bytes)
+        leaders_file.seek(checkpoint.leaders_bytes)
+
+        start = time.monotonic_ns()
+        base_elapsed = checkpoint.elapsed_ns
+        last_checkpoint = last_report = start
+
+        def job(key: UnitKey):
+            return (key, pending[key], limit, self.target_signs, self.max_unit_nodes)
+
+        def save() -> None:
+            leaders_file.flush()
+            os.fsync(leaders_file.fileno())
+            checkpoint.leaders_bytes = leaders_file.tell()
+            checkpoint.frontier = sorted(pending.items())
+            checkpoint.elapsed_ns = base_elapsed + time.monotonic_ns() - start
+            checkpoint.save(self.checkpoint_path)
+
+        def collect(outcome) -> bool:
+            nonlocal last_checkpoint, last_report
+            key, leaders, orbits, embeddings, nodes, expansions, truncated = outcome
+            # Prepare first, then update the state in one critical section:
+            # an interrupt must not save a frontier without the unit or its
+            # children, nor a torn leaders line
+            prefix = pending[key]
+            children = search.split(len(prefix) + 1, prefix) if truncated else []
+            lines = b"".join(
+                json.dumps(m, separators=(",", ":")).encode() + b"\n" for m in leaders
+            )
+            with interrupts.critical():
+                if truncated:
+                    # Requeue the children first, keeping the search in key order
+                    for i, child in enumerate(children):
+                        pending[key + (i,)] = child
+                    queue.extendleft(key + (i,) for i in reversed(range(len(children))))
+                    checkpoint.resplit += 1
+                    checkpoint.discarded_nodes += nodes
+                else:
+                    leaders_file.write(lines)
+                    checkpoint.finished += 1
+                    checkpoint.orbits += orbits
+                    checkpoint.embeddings += embeddings
+                    checkpoint.nodes += nodes
+                    checkpoint.expansions += expansions
+                del pending[key]
+
+                now = time.monotonic_ns()
+                if now - last_checkpoint >= self.checkpoint_interval_ns:
+                    save()
+                    last_checkpoint = now
+                if now - last_report >= self.report_interval_ns:
+                    self._report(checkpoint, pending, base_elapsed + now - start)
+                    last_report = now
+            return checkpoint.orbits >= limit
+
+        try:
+            if checkpoint.stopped or not queue:
+                pass
+            elif self.processes == 1:
+                parallel._init_worker(self.atlas, self.e8)
+                with _deferred_interrupts() as interrupts:
+                    while queue:
+                        if collect(_run_budgeted_unit(job(queue.popleft()))):
+                            break
+            else:
+                # Keep every worker busy with a short backlog; children of a
+                # split unit go to the front of the queue
+                window = 2 * (self.processes or cpu_count())
+                results = SimpleQueue()
+                with Pool(self.processes, initializer=_init_runner_worker,
+                          initargs=(self.atlas, self.e8)) as pool, \
+                        _deferred_interrupts() as interrupts:
+                    in_flight = 0
+                    while True:
+                        while queue and in_flight < window:
+                            pool.apply_async(_run_budgeted_unit, (job(queue.popleft()),),
+                                             callback=results.put, error_callback=results.put)
+                            in_flight += 1
+                        if in_flight == 0:
+                            break
+                        outcome = results.get()
+                        in_flight -= 1
+                        if isinstance(outcome, BaseException):
+                            raise outcome
+                        if collect(outcome):
+                            break
+        finally:
+            save()
+            leaders_file.close()
+            if self.verbose:
+                print(f"Checkpoint saved to {self.checkpoint_path}")
+
+        self._report(checkpoint, pending, checkpoint.elapsed_ns)
+        return _checkpoints_result([self.checkpoint_path], [checkpoint], search.breaker.order)
+
+    def _report(self, checkpoint: SearchCheckpoint, pending, elapsed_ns: int) -> None:
+        """Hand a progress snapshot to the callback and, if verbose, print it."""
+        snapshot = SearchProgress(
+            units_done=checkpoint.finished,
+            units_left=len(pending),
+            nodes=checkpoint.nodes,
+            discarded_nodes=checkpoint.discarded_nodes,
+            expansions=checkpoint.expansions,
+            elapsed_ns=elapsed_ns,
+            orbits=checkpoint.orbits,
+        )
+        if self.progress is not None:
+            self.progress(snapshot)
+        if self.verbose:
+            print(f"  {snapshot.format()}")
+
+
+def _checkpoints_result(paths: Sequence[str], checkpoints: List[SearchCheckpoint],
+                        order: List[int]) -> EnumerationResult:
+    """Combine shard checkpoints into one EnumerationResult."""
+    result = EnumerationResult(complete=all(c.complete for c in checkpoints))
+    for path, c in zip(paths, checkpoints):
+        result.representatives.extend(read_leaders(path, c.leaders_bytes))
+        result.orbits += c.orbits
+        result.embeddings += c.embeddings
+        result.units += c.units
+        result.nodes += c.nodes
+    result.representatives.sort(key=lambda m: [m[v] for v in order])
+    return result
+
+
+def merge_checkpoints(paths: Sequence[str], atlas_graph, e8_system) -> EnumerationResult:
+    """
+    Combine the shard checkpoints of one enumeration.
+
+    The result is complete only when every shard is present and complete.
+
+    Args:
+        paths: Checkpoint files, one per shard
+        atlas_graph: AtlasGraph instance
+        e8_system: E8RootSystem instance
+
+    Returns:
+        EnumerationResult over all the given shards
+
+    Raises:
+        ValueError: If the checkpoints belong to different runs or repeat a shard
+    """
+    checkpoints = [SearchCheckpoint.load(path) for path in paths]
+    if not checkpoints:
+        raise ValueError("No checkpoints provided")
+    first = checkpoints[0]
+    for path, c in zip(paths, checkpoints):
+        if not c.same_run(first):
+            raise ValueError(f"{path} is not a shard of the same run as {paths[0]}")
+    indices = [c.shard[0] for c in checkpoints]
+    if len(set(indices)) != len(indices):
+        raise ValueError(f"Repeated shard among {sorted(indices)}")
+
+    order = SymmetryBreaker(atlas_graph, e8_system.negation_table).order
+    result = _checkpoints_result(paths, checkpoints, order)
+    result.complete = result.complete and len(checkpoints) == first.shard[1]
+    return result
@@ -19,6 +19,8 @@ class EmbeddingConstraints:
     target_signs: Optional[int] = None
     required_mapping: Optional[Dict[int, int]] = None
     verbose: bool = False
+    # Bitset search only: give up after this many nodes (None for no limit)
+    max_nodes: Optional[int] = None
 
 
 class EmbeddingSearch:
@@ -201,6 +203,191 @@ class EmbeddingSearch:
         return len(sign_classes)
 
 
+class _NodeLimitReached(Exception):
+    """Raised inside the bitset search when max_nodes runs out."""
+
+
+class BitsetEmbeddingSearch(EmbeddingSearch):
+    """
+    Forward-checking search over 240-bit root bitsets.
+
+    Each τ-pair {v, τ(v)} is one search variable: assigning root r to its
+    representative assigns -r to the mirror. The variable's domain is an int
+    with bit r set when r is still a candidate. Assigning a pair ANDs every
+    adjacent pair's domain with the E8 neighbour mask of the assigned root
+    (or of its negation, for edges that cross to the mirror) and clears r and
+    -r everywhere, so a dead end shows up as an empty domain before the
+    search descends. The next pair is always the one with the fewest
+    candidates left.
+    """
+
+    def __init__(self, atlas_graph, e8_system):
+        super().__init__(atlas_graph, e8_system)
+
+        num_roots = len(self.e8.roots)
+        neg = self.e8.negation_table
+        self.full_mask = (1 << num_roots) - 1
+        self.neighbor_mask = [0] * num_roots
+        for r in range(num_roots):
+            for s in self.e8_adjacency[r]:
+                self.neighbor_mask[r] |= 1 << s
+        # Clearing a root from the domains also clears its negation
+        self.pair_mask = [(1 << r) | (1 << neg[r]) for r in range(num_roots)]
+
+        # Pair representatives and, per representative, the adjacent pairs:
+        # (other representative, True when the edge joins v to the other's
+        # mirror rather than to the other representative itself)
+        tau = self.atlas.tau
+        self.representatives = [v for v in range(len(tau)) if v < tau[v]]
+        self.pair_of = [min(v, tau[v]) for v in range(len(tau))]
+        self.constrains: Dict[int, List[tuple]] = {p: [] for p in self.representatives}
+        for p in self.representatives:
+            seen = set()
+            for v, crossed in ((p, False), (tau[p], True)):
+                for u in self.atlas.adjacency[v]:
+                    q = self.pair_of[u]
+                    link = (q, crossed != (u != q))
+                    if link not in seen:
+                        seen.add(link)
+                        self.constrains[p].append(link)
+
+        # Assignments tried, and nodes that branched over a domain; their
+        # ratio is the mean branching factor
+        self.nodes = 0
+        self.expansions = 0
+        # True when the last search stopped at max_nodes
+        self.truncated = False
+
+    def search(self, constraints: EmbeddingConstraints) -> List[List[int]]:
+        """
+        Run the bitset search with given constraints.
+
+        Args:
+            constraints: Search constraints
+
+        Returns:
+            List of found embeddings (each as a mapping list)
+        """
+        self.constraints = constraints
+        self.solutions = []
+        self.mapping = [-1] * len(self.atlas.labels)
+        self.used_roots = [False] * len(self.e8.roots)
+        self.nodes = 0
+        self.expansions = 0
+        self.truncated = False
+        # -1 never equals the node count, so no limit costs one comparison
+        self.node_limit = constraints.max_nodes if constraints.max_nodes is not None else -1
+
+        domains = {p: self.full_mask for p in self.representatives}
+        if constraints.required_mapping:
+            for v, r in constraints.required_mapping.items():
+                p = self.pair_of[v]
+                root = r if v == p else self.e8.negation_table[r]
+                if p not in domains or not domains[p] >> root & 1:
+                    return self.solutions
+                domains = self._assign(p, root, domains)
+                if domains is None:
+                    return self.solutions
+
+        if constraints.verbose:
+            print(f"Starting bitset search (max solutions: {constraints.max_solutions})")
+
+        try:
+            self._search_domains(domains)
+        except _NodeLimitReached:
+            self.truncated = True
+            self.mapping = [-1] * len(self.atlas.labels)
+            self.used_roots = [False] * len(self.e8.roots)
+
+        if constraints.verbose:
+            if self.truncated:
+                print(f"Node limit reached after {self.nodes} nodes.")
+            print(f"Search complete. Found {len(self.solutions)} solutions "
+                  f"in {self.nodes} nodes.")
+
+        return self.solutions
+
+    def _search_domains(self, domains: Dict[int, int]) -> None:
+        """
+        Recursive forward-checking search.
+
+        Args:
+            domains: Candidate bitset of every unassigned pair representative
+        """
+        if len(self.solutions) >= self.constraints.max_solutions:
+            return
+
+        if not domains:
+            if not self._check_unity_constraint():
+                return
+            if self.constraints.target_signs:
+                if self._count_sign_classes() != self.constraints.target_signs:
+                    return
+            self._record_solution()
+            return
+
+        # Most constrained pair first; ties go to the lowest vertex
+        p = min(domains, key=lambda q: (domains[q].bit_count(), q))
+        candidates = domains[p]
+        self.expansions += 1
+        while candidates:
+            low = candidates & -candidates
+            candidates ^= low
+            root = low.bit_length() - 1
+
+            if self.nodes == self.node_limit:
+                raise _NodeLimitReached
+            self.nodes += 1
+            remaining = self._assign(p, root, domains)
+            if remaining is None:
+                continue
+            self._search_domains(remaining)
+            self._unassign(p)
+            if len(self.solutions) >= self.constraints.max_solutions:
+                return
+
+    def _record_solution(self) -> None:
+        """Keep the complete mapping as a solution."""
+        self.solutions.append(self.mapping.copy())
+        if self.constraints.verbose:
+            print(f"  Found embedding #{len(self.solutions)}")
+
+    def _assign(self, p: int, root: int, domains: Dict[int, int]) -> Optional[Dict[int, int]]:
+        """
+        Assign root to representative p and -root to its mirror.
+
+        Returns:
+            Domains of the pairs still unassigned, or None when one of them
+            has no candidate left
+        """
+        neg_root = self.e8.negation_table[root]
+        mirror = self.atlas.tau[p]
+        self.mapping[p] = root
+        self.mapping[mirror] = neg_root
+        self.used_roots[root] = True
+        self.used_roots[neg_root] = True
+
+        keep = self.full_mask ^ self.pair_mask[root]
+        remaining = {q: d & keep for q, d in domains.items() if q != p}
+        for q, crossed in self.constrains[p]:
+            if q in remaining:
+                remaining[q] &= self.neighbor_mask[neg_root if crossed else root]
+
+        if any(d == 0 for d in remaining.values()):
+            self._unassign(p)
+            return None
+        return remaining
+
+    def _unassign(self, p: int) -> None:
+        """Undo the assignment of representative p and its mirror."""
+        mirror = self.atlas.tau[p]
+        for v in (p, mirror):
+            root = self.mapping[v]
+            if root != -1:
+                self.used_roots[root] = False
+                self.mapping[v] = -1
+
+
 def find_embedding(
     atlas_graph,
     e8_system,
@@ -219,7 +406,7 @@ def find_embedding(
     Returns:
         List of found embeddings (as mapping lists)
     """
-    search = EmbeddingSearch(atlas_graph, e8_system)
+    search = BitsetEmbeddingSearch(atlas_graph, e8_system)
     constraints = EmbeddingConstraints(max_solutions=max_solutions)
     return search.search(constraints)
 
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Command line driver for checkpointed embedding enumerations.
+
+    python run_search.py run CHECKPOINT [--shard I/N] [--split-depth D] ...
+    python run_search.py status CHECKPOINT...
+    python run_search.py merge CHECKPOINT...
+
+`run` starts the enumeration, or resumes it when CHECKPOINT exists; it can
+be killed (Ctrl-C, SIGTERM) and rerun at any point. On a batch cluster, run
+one shard per job, each into its own checkpoint, then `merge` them.
+"""
+import argparse
+import sys
+
+from atlas import AtlasGraph
+from e8 import E8RootSystem
+from embedding import SearchCheckpoint, SearchRunner, merge_checkpoints
+
+
+def parse_shard(text: str):
+    """Parse 'I/N' into (I, N)."""
+    index, _, count = text.partition("/")
+    try:
+        return int(index), int(count)
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"expected I/N, got {text!r}")
+
+
+def print_result(result) -> None:
+    """Print the counts of an EnumerationResult."""
+    print(f"Units: {result.units}")
+    print(f"Orbits: {result.orbits}")
+    print(f"Embeddings: {result.embeddings}")
+    print(f"Nodes: {result.nodes}")
+    print(f"Complete: {result.complete}")
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run = commands.add_parser("run", help="start or resume a shard")
+    run.add_argument("checkpoint")
+    run.add_argument("--shard", type=parse_shard, default=(0, 1), help="I/N (default 0/1)")
+    run.add_argument("--split-depth", type=int, default=2)
+    run.add_argument("--max-orbits", type=int)
+    run.add_argument("--target-signs", type=int)
+    run.add_argument("--max-unit-nodes", type=int, default=200_000,
+                     help="split units whose search exceeds this many nodes (0: never)")
+    run.add_argument("--processes", type=int, help="default: one per CPU")
+    run.add_argument("--checkpoint-interval", type=int, default=60, help="seconds")
+    run.add_argument("--report-interval", type=int, default=10, help="seconds")
+
+    status = commands.add_parser("status", help="print the progress of checkpoints")
+    status.add_argument("checkpoints", nargs="+")
+
+    merge = commands.add_parser("merge", help="combine the shards of one run")
+    merge.add_argument("checkpoints", nargs="+")
+
+    args = parser.parse_args(argv)
+
+    if args.command == "status":
+        for path in args.checkpoints:
+            c = SearchCheckpoint.load(path)
+            print(f"{path} (shard {c.shard[0]}/{c.shard[1]}): {c.progress().format()}")
+        return 0
+
+    atlas = AtlasGraph()
+    e8 = E8RootSystem()
+
+    if args.command == "merge":
+        print_result(merge_checkpoints(args.checkpoints, atlas, e8))
+        return 0
+
+    runner = SearchRunner(
+        atlas, e8, args.checkpoint,
+        split_depth=args.split_depth,
+        max_orbits=args.max_orbits,
+        target_signs=args.target_signs,
+        max_unit_nodes=args.max_unit_nodes or None,
+        shard=args.shard,
+        processes=args.processes,
+        checkpoint_interval=args.checkpoint_interval,
+        report_interval=args.report_interval,
+        verbose=True,
+    )
+    try:
+        result = runner.run()
+    except KeyboardInterrupt:
+        print("Interrupted; rerun the same command to resume")
+        return 130
+    print_result(result)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
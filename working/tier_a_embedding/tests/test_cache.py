@@ -0,0 +1,155 @@
+"""
+Tests for the on-disk artifact cache.
+"""
+import os
+import sys
+import tempfile
+import unittest
+from unittest import mock
+
+import cache
+from cache import ArtifactCache
+
+
+class TestArtifactCache(unittest.TestCase):
+    """Test keying, hits, misses and invalidation."""
+
+    def setUp(self):
+        """Use a fresh cache directory per test."""
+        self.directory = tempfile.TemporaryDirectory()
+        self.cache = ArtifactCache(self.directory.name, enabled=True)
+        self.builds = 0
+
+    def tearDown(self):
+        self.directory.cleanup()
+
+    def build(self):
+        self.builds += 1
+        return {"value": [1, 2, 3]}
+
+    def test_second_lookup_is_a_hit(self):
+        """A stored artifact is loaded, not rebuilt."""
+        first = self.cache.get_or_build("thing", self.build)
+        second = ArtifactCache(self.directory.name, enabled=True).get_or_build("thing", self.build)
+        self.assertEqual(first, second)
+        self.assertEqual(self.builds, 1)
+
+    def test_parameters_are_part_of_the_key(self):
+        """Different construction parameters are different artifacts."""
+        self.cache.get_or_build("thing", self.build, params=(1,))
+        self.cache.get_or_build("thing", self.build, params=(2,))
+        self.cache.get_or_build("thing", self.build, params=(1,))
+        self.assertEqual(self.builds, 2)
+        self.assertEqual((self.cache.hits, self.cache.misses), (1, 2))
+
+    def test_version_bump_invalidates(self):
+        """Changing CACHE_VERSION misses every stored artifact."""
+        self.cache.get_or_build("thing", self.build)
+        with mock.patch.object(cache, "CACHE_VERSION", cache.CACHE_VERSION + 1):
+            self.cache.get_or_build("thing", self.build)
+        self.assertEqual(self.builds, 2)
+
+    def test_source_contents_are_part_of_the_key(self):
+        """Editing a builder source changes the key."""
+        before = self.cache.key("thing", sources=("common_types.py",))
+        edited = ArtifactCache(self.directory.name, enabled=True)
+        edited._source_hashes["common_types.py"] = "0" * 64
+        self.assertNotEqual(before, edited.key("thing", sources=("common_types.py",)))
+
+    def test_invalidate(self):
+        """invalidate() removes artifacts by name or all of them."""
+        self.cache.get_or_build("one", self.build)
+        self.cache.get_or_build("two", self.build)
+        self.assertEqual(self.cache.invalidate("one"), 1)
+        self.cache.get_or_build("two", self.build)
+        self.assertEqual(self.builds, 2)
+        self.assertEqual(self.cache.invalidate(), 1)
+
+    def test_corrupt_file_is_rebuilt(self):
+        """A truncated artifact is treated as a miss and replaced."""
+        self.cache.get_or_build("thing", self.build)
+        path = self.cache.path("thing", self.cache.key("thing"))
+        with open(path, "wb") as f:
+            f.write(b"\x80")
+        self.assertEqual(self.cache.get_or_build("thing", self.build), {"value": [1, 2, 3]})
+        self.assertEqual(self.builds, 2)
+
+    def test_disabled_cache_always_builds(self):
+        """A disabled cache builds every time and writes nothing."""
+        disabled = ArtifactCache(self.directory.name, enabled=False)
+        disabled.get_or_build("thing", self.build)
+        disabled.get_or_build("thing", self.build)
+        self.assertEqual(self.builds, 2)
+        self.assertEqual(os.listdir(self.directory.name), [])
+
+
+class TestCachedStructures(unittest.TestCase):
+    """Test that cached structures equal freshly built ones."""
+
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        self.patch = mock.patch.object(cache, "_default_cache",
+                                       ArtifactCache(self.directory.name, enabled=True))
+        self.patch.start()
+
+    def tearDown(self):
+        self.patch.stop()
+        self.directory.cleanup()
+
+    def test_round_trip(self):
+        """Loaded artifacts match the ones that were stored."""
+        built = (cache.cached_atlas_graph(), cache.cached_e8_root_system(), cache.cached_embedding(48))
+        loaded = (cache.cached_atlas_graph(), cache.cached_e8_root_system(), cache.cached_embedding(48))
+        self.assertEqual(built[0].edges, loaded[0].edges)
+        self.assertEqual(built[0].tau, loaded[0].tau)
+        self.assertEqual(built[1].roots, loaded[1].roots)
+        self.assertEqual([list(row) for row in built[1].gram], [list(row) for row in loaded[1].gram])
+        self.assertEqual(built[2], loaded[2])
+        self.assertEqual(loaded[1].get_sign_classes_used(loaded[2]), 48)
+        self.assertEqual(len(cache.cached_s4_automorphisms()), 24)
+
+    def test_embedding_matches_uncached_search(self):
+        """The cached embedding is the one EmbeddingSearch finds on fresh structures."""
+        from atlas import AtlasGraph
+        from e8 import E8RootSystem
+        from embedding import EmbeddingSearch, EmbeddingConstraints
+
+        search = EmbeddingSearch(AtlasGraph(), E8RootSystem())
+        solutions = search.search(EmbeddingConstraints(max_solutions=1, target_signs=48, verbose=False))
+        self.assertEqual(cache.cached_embedding(48), solutions[0])
+        self.assertEqual(cache.cached_embedding(48), solutions[0])
+
+    def _files_run_by(self, build):
+        """Package source files with a function called while building."""
+        files = set()
+
+        def profile(frame, event, arg):
+            if event == "call":
+                files.add(frame.f_code.co_filename)
+
+        with mock.patch.object(cache, "_default_cache", ArtifactCache(enabled=False)):
+            sys.setprofile(profile)
+            try:
+                build()
+            finally:
+                sys.setprofile(None)
+        relative = {os.path.relpath(f, cache.PACKAGE_ROOT) for f in files
+                    if f.startswith(cache.PACKAGE_ROOT + os.sep)}
+        return {f for f in relative if f != "cache.py" and not f.endswith("__init__.py")
+                and not f.startswith("tests" + os.sep)}
+
+    def test_sources_cover_builders(self):
+        """Every package file a builder runs is part of its artifact key."""
+        builders = (
+            (cache.cached_atlas_graph, cache._ATLAS_SOURCES),
+            (cache.cached_e8_root_system, cache._E8_SOURCES),
+            (cache.cached_s4_automorphisms, cache._S4_SOURCES),
+            (lambda: cache.cached_embedding(48), cache._EMBEDDING_SOURCES),
+        )
+        for build, sources in builders:
+            with self.subTest(build=build):
+                self.assertLessEqual(self._files_run_by(build), set(sources))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -7,7 +7,7 @@ from typing import List
 
 from atlas import AtlasGraph
 from e8 import E8RootSystem
-from embedding import EmbeddingSearch, EmbeddingConstraints
+from embedding import EmbeddingSearch, BitsetEmbeddingSearch, EmbeddingConstraints
 from canonicalization import (
     S4Automorphism,
     S4Group,
@@ -332,5 +332,69 @@ class TestEquivalenceClassSize(unittest.TestCase):
         self.assertEqual(48 % size, 0)
 
 
+class TestPrecomputedOrbitTables(unittest.TestCase):
+    """Test the permutation tables against the S4Group reference."""
+
+    def setUp(self):
+        """Set up a selector and a few embeddings."""
+        self.atlas = AtlasGraph()
+        self.e8 = E8RootSystem()
+        self.selector = CanonicalSelector(
+            tau=self.atlas.tau,
+            negation_table=self.e8.negation_table,
+            labels=self.atlas.labels,
+            roots=self.e8.roots
+        )
+        search = BitsetEmbeddingSearch(self.atlas, self.e8)
+        self.solutions = search.search(EmbeddingConstraints(max_solutions=3))
+        self.assertGreater(len(self.solutions), 0, "Need at least one solution to test")
+
+    def test_gathers_match_apply_to_mapping(self):
+        """Each S4 gather equals S4Automorphism.apply_to_mapping."""
+        mapping = self.solutions[0]
+        images = self.selector.images(mapping, include_mirror=False)
+        expected = [tuple(g.apply_to_mapping(mapping, self.atlas.labels))
+                    for g in self.selector.s4_group.elements]
+        self.assertEqual(images, expected)
+
+    def test_canonical_form_is_orbit_invariant(self):
+        """Every S4 × mirror image has the same canonical form."""
+        mapping = self.solutions[0]
+        form = self.selector.canonical_form(mapping)
+        self.assertIn(form, self.selector.images(mapping))
+        for image in self.selector.images(mapping):
+            self.assertEqual(self.selector.canonical_form(list(image)), form)
+        # The mirror image of an embedding is its root negation
+        negated = [self.e8.negation_table[r] for r in mapping]
+        self.assertEqual(self.selector.canonical_form(negated), form)
+
+    def test_unique_orbits(self):
+        """Dedup keeps one mapping per orbit, first seen first."""
+        stream = []
+        for mapping in self.solutions:
+            stream.extend(list(image) for image in self.selector.images(mapping))
+        unique = list(self.selector.unique_orbits(stream))
+        forms = {self.selector.canonical_form(m) for m in self.solutions}
+        self.assertEqual(len(unique), len(forms))
+        self.assertEqual(unique[0], stream[0])
+
+    def test_canonicalize_matches_reference(self):
+        """Linear selection agrees with scoring and sorting every mapping."""
+        orbit = [list(image) for image in self.selector.images(self.solutions[0])]
+        candidates = orbit + self.solutions
+
+        def reference_score(mapping):
+            key = min(mapping_equivalence_key(m, self.atlas.tau, self.e8.negation_table)
+                      for m in S4Group().orbit(mapping, self.atlas.labels))
+            int_count, _ = count_root_types(mapping, self.e8.roots)
+            return (key, -int_count, tuple(mapping))
+
+        expected = min(candidates, key=reference_score)
+        self.assertEqual(self.selector.canonicalize(candidates), expected)
+        self.assertEqual(self.selector.canonicalize(iter(candidates)), expected)
+        self.assertEqual(self.selector.find_canonical_in_orbit(self.solutions[0]),
+                         list(min(tuple(m) for m in S4Group().orbit(self.solutions[0], self.atlas.labels))))
+
+
 if __name__ == "__main__":
     unittest.main()
\ No newline at end of file
@@ -3,12 +3,18 @@ Tests for certificate generation and verification.
 """
 import unittest
 import json
+import os
+import subprocess
+import sys
+import tempfile
 from fractions import Fraction
 
 from atlas import AtlasGraph
 from e8 import E8RootSystem
-from embedding import EmbeddingSearch, EmbeddingConstraints
+from embedding import EmbeddingSearch, BitsetEmbeddingSearch, EmbeddingConstraints
 from certificate import (
+    BatchCertificateVerifier,
+    format_root,
     CertificateGenerator,
     CertificateVerifier,
     CertificateFormat,
@@ -18,6 +24,7 @@ from certificate import (
     parse_root,
     create_certificate,
     verify_certificate,
+    verify_certificates,
 )
 
 
@@ -213,6 +220,99 @@ class TestCertificateVerifier(unittest.TestCase):
         self.assertTrue(is_valid)
 
 
+class TestBatchCertificateVerifier(unittest.TestCase):
+    """Test batch verification against the single-certificate verifier."""
+
+    def setUp(self):
+        """Create a valid certificate and broken variants of it."""
+        atlas = AtlasGraph()
+        e8 = E8RootSystem()
+        search = BitsetEmbeddingSearch(atlas, e8)
+        solutions = search.search(EmbeddingConstraints(max_solutions=1))
+        self.assertGreater(len(solutions), 0, "Need at least one solution to test")
+        self.cert_json = create_certificate(solutions[0], atlas, e8)
+
+        not_injective = json.loads(self.cert_json)
+        not_injective["mapping"]["0"] = not_injective["mapping"]["1"]
+        swapped = json.loads(self.cert_json)
+        swapped["mapping"]["0"], swapped["mapping"]["1"] = swapped["mapping"]["1"], swapped["mapping"]["0"]
+        wrong_count = json.loads(self.cert_json)
+        wrong_count["sign_classes_used"] = 47
+
+        # Move one image off the lattice so an edge has inner product 5/4,
+        # keeping its negative in the table so mirror pairing still holds
+        mapping = solutions[0]
+        i, j = next((i, j) for i, j in sorted(atlas.edges)
+                    if e8.roots[mapping[j]][0].denominator == 2)
+        u, v = e8.roots[mapping[i]], e8.roots[mapping[j]]
+        forged = (u[0] + v[0],) + u[1:]
+        self.assertEqual(sum(a * b for a, b in zip(forged, v)), Fraction(5, 4))
+        off_lattice = json.loads(self.cert_json)
+        off_lattice["roots"][str(mapping[i])] = format_root(forged)
+        off_lattice["roots"][str(e8.negation_table[mapping[i]])] = format_root(tuple(-x for x in forged))
+        self.off_lattice = json.dumps(off_lattice)
+
+        self.documents = [
+            self.cert_json,
+            json.dumps(not_injective),
+            json.dumps(swapped),
+            json.dumps(wrong_count),
+            json.dumps({"wrong": "format"}),
+            "not valid json",
+        ]
+
+    def test_agrees_with_single_verifier(self):
+        """Every certificate gets the same verdict and message."""
+        verifier = CertificateVerifier()
+        expected = [verifier.verify(doc) for doc in self.documents]
+        outcomes = list(BatchCertificateVerifier().verify_strings(self.documents))
+        self.assertEqual([(o.valid, o.message) for o in outcomes], expected)
+        self.assertEqual([o.source for o in outcomes], [str(i) for i in range(len(self.documents))])
+
+    def test_rejects_roots_off_the_lattice(self):
+        """Inner products of roots off the lattice are exact, also under python -O."""
+        outcome, = BatchCertificateVerifier().verify_strings([self.off_lattice])
+        self.assertFalse(outcome.valid)
+        self.assertTrue(outcome.message.startswith("Edge preservation failed"))
+
+        # Assertions are stripped under -O, so the check must not rely on them
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "forged.json")
+            with open(path, "w") as f:
+                f.write(self.off_lattice)
+            script = ("import sys; from certificate import verify_certificates; "
+                      f"count, failures = verify_certificates({path!r}, processes=1); "
+                      "sys.exit(0 if count == 1 and len(failures) == 1 else 1)")
+            package_root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+            result = subprocess.run([sys.executable, "-O", "-c", script], cwd=package_root)
+            self.assertEqual(result.returncode, 0)
+
+    def test_process_pool_agrees(self):
+        """A process pool returns the same outcomes in input order."""
+        serial = list(BatchCertificateVerifier().verify_strings(self.documents))
+        pooled = list(BatchCertificateVerifier(processes=2, chunksize=2).verify_strings(self.documents))
+        self.assertEqual(serial, pooled)
+
+    def test_streams_directory_and_json_lines(self):
+        """Certificates are read from per-file directories and JSON Lines files."""
+        with tempfile.TemporaryDirectory() as directory:
+            for i, doc in enumerate(self.documents[:4]):
+                with open(os.path.join(directory, f"cert_{i}.json"), "w") as f:
+                    f.write(doc)
+            count, failures = verify_certificates(directory, processes=1)
+            self.assertEqual(count, 4)
+            self.assertEqual([os.path.basename(o.source) for o in failures],
+                             ["cert_1.json", "cert_2.json", "cert_3.json"])
+
+            lines = os.path.join(directory, "certs.jsonl")
+            with open(lines, "w") as f:
+                for doc in (self.cert_json, self.cert_json, self.documents[1]):
+                    f.write(json.dumps(json.loads(doc)) + "\n")
+            count, failures = verify_certificates(lines, processes=1)
+            self.assertEqual(count, 3)
+            self.assertEqual([o.source for o in failures], [f"{lines}:3"])
+
+
 class TestCertificateIndependence(unittest.TestCase):
     """Test that verifier is independent of generator."""
 
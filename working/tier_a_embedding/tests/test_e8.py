@@ -4,7 +4,8 @@ Tests for the E8 root system module.
 import unittest
 from fractions import Fraction
 
-from e8 import E8RootSystem
+from e8 import E8RootSystem, E8Geometry, double_root, compute_gram_matrix
+from e8 import WeylGroup, e8_weyl_group, compose, element_order
 from common_types import E8_ROOT_COUNT
 
 
@@ -197,5 +198,91 @@ class TestE8Helpers(unittest.TestCase):
                 self.assertIn(coord.denominator, [1, 2])
 
 
+class TestIntegerTables(unittest.TestCase):
+    """Test the doubled encoding, Gram matrix and distance table."""
+
+    @classmethod
+    def setUpClass(cls):
+        """Build the root system and geometry once."""
+        cls.e8 = E8RootSystem()
+        cls.geometry = E8Geometry(cls.e8.roots)
+
+    def test_doubled_encoding(self):
+        """Test doubling gives integer vectors of norm 8."""
+        for root, doubled in zip(self.e8.roots, self.e8.doubled_roots):
+            self.assertEqual(doubled, double_root(root))
+            self.assertTrue(all(isinstance(x, int) for x in doubled))
+            self.assertEqual(tuple(Fraction(x, 2) for x in doubled), root)
+            self.assertEqual(sum(x * x for x in doubled), 8)
+
+    def test_off_lattice_roots_raise(self):
+        """Test coordinates off the half-integer lattice raise ValueError."""
+        with self.assertRaises(ValueError):
+            double_root((Fraction(1, 3),) + (Fraction(0),) * 7)
+        half = (Fraction(1, 2),) + (Fraction(0),) * 7
+        five_halves = (Fraction(5, 2),) + (Fraction(0),) * 7
+        with self.assertRaises(ValueError):
+            compute_gram_matrix([half, five_halves])
+
+    def test_gram_matches_rational_dot(self):
+        """Test integer Gram entries equal the exact rational inner products."""
+        for i in range(0, E8_ROOT_COUNT, 7):
+            for j in range(E8_ROOT_COUNT):
+                dot = sum(a * b for a, b in zip(self.e8.roots[i], self.e8.roots[j]))
+                self.assertEqual(Fraction(self.e8.gram[i][j]), dot)
+
+    def test_distance_follows_inner_product(self):
+        """Test distances are 0, 1, 2, 2, 3 for inner products 2, 1, 0, -1, -2."""
+        expected = {2: 0, 1: 1, 0: 2, -1: 2, -2: 3}
+        for i in range(E8_ROOT_COUNT):
+            for j in range(E8_ROOT_COUNT):
+                self.assertEqual(self.geometry.distance(i, j), expected[self.e8.gram[i][j]])
+
+
+class TestWeylGroups(unittest.TestCase):
+    """Test the Schreier–Sims Weyl group engine."""
+
+    @classmethod
+    def setUpClass(cls):
+        """Build W(E6), W(E7) and W(E8) on the E8 roots once."""
+        cls.e8 = E8RootSystem()
+        cls.groups = {rank: e8_weyl_group(cls.e8.roots, rank) for rank in (6, 7, 8)}
+
+    def test_orders(self):
+        """Test the orders of W(E6), W(E7) and W(E8)."""
+        self.assertEqual(self.groups[6].order(), 51840)
+        self.assertEqual(self.groups[7].order(), 2903040)
+        self.assertEqual(self.groups[8].order(), 696729600)
+
+    def test_root_subsystems(self):
+        """Test the reflection subgroups see 72, 126 and 240 roots."""
+        self.assertEqual(len(self.groups[6].root_subsystem()), 72)
+        self.assertEqual(len(self.groups[7].root_subsystem()), 126)
+        self.assertEqual(self.groups[8].orbits(), [list(range(E8_ROOT_COUNT))])
+
+    def test_membership(self):
+        """Test the chain E6 ⊂ E7 ⊂ E8 and a non-member."""
+        self.assertTrue(self.groups[6].is_subgroup_of(self.groups[7]))
+        self.assertTrue(self.groups[7].is_subgroup_of(self.groups[8]))
+        self.assertFalse(self.groups[7].is_subgroup_of(self.groups[6]))
+        # −1 is the longest element of W(E8) and W(E7) but not of W(E6)
+        negation = self.groups[8].negation()
+        self.assertTrue(self.groups[8].contains(negation))
+        self.assertFalse(self.groups[6].contains(negation))
+        product = compose(self.groups[8].generators[0], self.groups[8].generators[1])
+        self.assertTrue(self.groups[8].contains(product))
+        self.assertEqual(element_order(product), 2)
+
+    def test_rank_two_and_f4(self):
+        """Test W(G2) and W(F4) from their simple roots."""
+        g2 = WeylGroup.from_simple_roots([(1, -1, 0), (-2, 1, 1)])
+        self.assertEqual((len(g2.roots), g2.order()), (12, 12))
+        half = Fraction(1, 2)
+        f4 = WeylGroup.from_simple_roots([
+            (0, 1, -1, 0), (0, 0, 1, -1), (0, 0, 0, 1), (half, -half, -half, -half)
+        ])
+        self.assertEqual((len(f4.roots), f4.order()), (48, 1152))
+
+
 if __name__ == "__main__":
     unittest.main()
\ No newline at end of file
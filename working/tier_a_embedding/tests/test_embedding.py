@@ -1,12 +1,19 @@
 """
 Tests for the embedding search module.
 """
+import os
+import signal
+import tempfile
 import unittest
+from unittest import mock
+from fractions import Fraction
 from typing import List
 
 from atlas import AtlasGraph
 from e8 import E8RootSystem
-from embedding import EmbeddingSearch, EmbeddingConstraints
+from embedding import EmbeddingSearch, BitsetEmbeddingSearch, EmbeddingConstraints
+from embedding import SymmetryBrokenSearch, enumerate_embeddings
+from embedding import SearchCheckpoint, SearchProgress, SearchRunner, merge_checkpoints
 from common_types import ATLAS_VERTEX_COUNT, E8_ROOT_COUNT
 
 
@@ -262,5 +269,279 @@ class TestBacktrackingOptimizations(unittest.TestCase):
         self.assertEqual(remaining, E8_ROOT_COUNT - 5)
 
 
+class TestBitsetEmbeddingSearch(unittest.TestCase):
+    """Test the forward-checking bitset search."""
+
+    @classmethod
+    def setUpClass(cls):
+        """Build the search once; it precomputes the root masks."""
+        cls.atlas = AtlasGraph()
+        cls.e8 = E8RootSystem()
+        cls.search = BitsetEmbeddingSearch(cls.atlas, cls.e8)
+
+    def _assert_valid(self, mapping: List[int]):
+        """Check injectivity, mirror pairing and edge preservation."""
+        self.assertEqual(len(set(mapping)), ATLAS_VERTEX_COUNT)
+        for i in range(ATLAS_VERTEX_COUNT):
+            self.assertEqual(self.e8.negation_table[mapping[i]], mapping[self.atlas.tau[i]])
+        for a, b in self.atlas.edges:
+            self.assertIn(mapping[b], self.search.e8_adjacency[mapping[a]])
+
+    def test_neighbor_masks_match_adjacency(self):
+        """Test each root mask holds exactly its 56 E8 neighbours."""
+        for r in range(E8_ROOT_COUNT):
+            mask = self.search.neighbor_mask[r]
+            self.assertEqual(mask.bit_count(), 56)
+            self.assertEqual({s for s in range(E8_ROOT_COUNT) if mask >> s & 1},
+                             self.search.e8_adjacency[r])
+
+    def test_solutions_are_valid_and_distinct(self):
+        """Test every solution found is a valid embedding."""
+        solutions = self.search.search(EmbeddingConstraints(max_solutions=50, target_signs=48))
+        self.assertEqual(len(solutions), 50)
+        self.assertEqual(len({tuple(m) for m in solutions}), 50)
+        for mapping in solutions:
+            self._assert_valid(mapping)
+
+    def test_required_mapping_respected(self):
+        """Test required assignments fix the vertex and its mirror."""
+        solutions = self.search.search(EmbeddingConstraints(required_mapping={1: 7}))
+        self.assertEqual(len(solutions), 1)
+        self.assertEqual(solutions[0][1], 7)
+        self._assert_valid(solutions[0])
+
+    def test_forward_checking_rejects_conflicts(self):
+        """Test assigning a pair leaves no candidate that breaks an edge."""
+        domains = {p: self.search.full_mask for p in self.search.representatives}
+        p = self.search.representatives[0]
+        remaining = self.search._assign(p, 0, domains)
+        self.assertIsNotNone(remaining)
+        self.assertNotIn(p, remaining)
+        neg = self.e8.negation_table[0]
+        for u in self.atlas.adjacency[p]:
+            q = self.search.pair_of[u]
+            root_for_u = 0 if u == q else neg
+            for r in range(E8_ROOT_COUNT):
+                if remaining[q] >> r & 1:
+                    candidate = r if u == q else self.e8.negation_table[r]
+                    self.assertIn(candidate, self.search.e8_adjacency[0])
+            self.assertFalse(remaining[q] >> root_for_u & 1)
+        self.search._unassign(p)
+        self.assertEqual(self.search.mapping, [-1] * ATLAS_VERTEX_COUNT)
+
+    def test_node_limit_truncates(self):
+        """Test max_nodes stops the search and resets its state."""
+        self.search.search(EmbeddingConstraints(max_solutions=10**6, max_nodes=25))
+        self.assertTrue(self.search.truncated)
+        self.assertEqual(self.search.nodes, 25)
+        self.assertEqual(self.search.mapping, [-1] * ATLAS_VERTEX_COUNT)
+        self.search.search(EmbeddingConstraints(max_nodes=10**6))
+        self.assertFalse(self.search.truncated)
+        self.assertGreater(self.search.expansions, 0)
+
+
+class TestParallelEnumeration(unittest.TestCase):
+    """Test symmetry-broken, work-unit enumeration."""
+
+    @classmethod
+    def setUpClass(cls):
+        """Build the search once; it precomputes masks and the group."""
+        cls.atlas = AtlasGraph()
+        cls.e8 = E8RootSystem()
+        cls.search = SymmetryBrokenSearch(cls.atlas, cls.e8)
+        cls.breaker = cls.search.breaker
+
+    def _images(self, mapping: List[int]) -> List[List[int]]:
+        """All images of mapping under S4 x {+-1}, identity included."""
+        images = [mapping]
+        for perm, negate in self.breaker.elements:
+            image = [mapping[perm[v]] for v in range(ATLAS_VERTEX_COUNT)]
+            if negate:
+                image = [self.e8.negation_table[r] for r in image]
+            images.append(image)
+        return images
+
+    def test_group_order(self):
+        """Test the group is S4 x {+-1}."""
+        self.assertEqual(self.breaker.group_order, 48)
+        self.assertEqual(sorted(self.breaker.order), list(range(ATLAS_VERTEX_COUNT)))
+
+    def test_split_prunes_negation(self):
+        """Test the first pair only takes one root of each +-r pair."""
+        units = self.search.split(1)
+        self.assertEqual(len(units), E8_ROOT_COUNT // 2)
+        for (unit,) in units:
+            p, root = unit
+            self.assertLess(root, self.e8.negation_table[root])
+
+    def test_split_below_a_unit(self):
+        """Test splitting a unit deeper gives exactly the deeper units below it."""
+        unit = self.search.split(1)[3]
+        below = [u for u in self.search.split(2) if u[:1] == unit]
+        self.assertTrue(below)
+        self.assertEqual(self.search.split(2, unit), below)
+        self.assertEqual(self.search.mapping, [-1] * ATLAS_VERTEX_COUNT)
+
+    def test_exactly_one_leader_per_orbit(self):
+        """Test a found leader is the only leader among its images."""
+        result = enumerate_embeddings(self.atlas, self.e8, max_orbits=5, processes=1)
+        self.assertGreaterEqual(result.orbits, 5)
+        self.assertFalse(result.complete)
+        for mapping in result.representatives:
+            images = self._images(mapping)
+            for image in images:
+                self.assertEqual(self.e8.negation_table[image[0]], image[self.atlas.tau[0]])
+                for a, b in self.atlas.edges:
+                    self.assertIn(image[b], self.search.e8_adjacency[image[a]])
+            leaders = [m for m in images if self.breaker.leader_stabilizer(m) is not None]
+            self.assertTrue(all(m == mapping for m in leaders))
+            stabilizer = self.breaker.leader_stabilizer(mapping)
+            self.assertEqual(len({tuple(m) for m in images}), 48 // stabilizer)
+
+    def test_pool_counts_match_leaders(self):
+        """Test pool results are leaders with consistent orbit counts."""
+        result = enumerate_embeddings(self.atlas, self.e8, max_orbits=10, processes=2)
+        self.assertGreaterEqual(result.orbits, 10)
+        self.assertEqual(len(result.representatives), result.orbits)
+        self.assertEqual(result.embeddings, sum(
+            48 // self.breaker.leader_stabilizer(m) for m in result.representatives
+        ))
+
+
+class TestSearchRunner(unittest.TestCase):
+    """Test checkpointed, resumable and sharded enumeration."""
+
+    @classmethod
+    def setUpClass(cls):
+        cls.atlas = AtlasGraph()
+        cls.e8 = E8RootSystem()
+        cls.search = SymmetryBrokenSearch(cls.atlas, cls.e8)
+
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        self.addCleanup(self.directory.cleanup)
+
+    def _path(self, name: str) -> str:
+        return os.path.join(self.directory.name, name)
+
+    def test_matches_enumerate_embeddings(self):
+        """Test a runner reproduces enumerate_embeddings and saves its state."""
+        expected = enumerate_embeddings(self.atlas, self.e8, max_orbits=5, processes=1)
+        path = self._path("run.json")
+        result = SearchRunner(self.atlas, self.e8, path, max_orbits=5, processes=1).run()
+        self.assertEqual(result.representatives, expected.representatives)
+        self.assertEqual((result.orbits, result.embeddings, result.nodes, result.units),
+                         (expected.orbits, expected.embeddings, expected.nodes, expected.units))
+        self.assertFalse(result.complete)
+        checkpoint = SearchCheckpoint.load(path)
+        self.assertTrue(checkpoint.stopped)
+        self.assertEqual(checkpoint.finished + len(checkpoint.frontier), expected.units)
+
+    def test_resume_after_interrupt(self):
+        """Test an interrupted run resumes to the uninterrupted result."""
+        options = dict(split_depth=1, max_orbits=40, max_unit_nodes=50, processes=1)
+        expected = SearchRunner(self.atlas, self.e8, self._path("whole.json"), **options).run()
+
+        def interrupt(progress: SearchProgress):
+            if progress.units_done == 10:
+                raise KeyboardInterrupt
+
+        path = self._path("resumed.json")
+        runner = SearchRunner(self.atlas, self.e8, path, checkpoint_interval=0,
+                              report_interval=0, progress=interrupt, **options)
+        with self.assertRaises(KeyboardInterrupt):
+            runner.run()
+        self.assertEqual(SearchCheckpoint.load(path).finished, 10)
+
+        resumed = SearchRunner(self.atlas, self.e8, path, **options).run()
+        self.assertEqual(resumed.representatives, expected.representatives)
+        self.assertEqual((resumed.orbits, resumed.nodes, resumed.units),
+                         (expected.orbits, expected.nodes, expected.units))
+
+        with self.assertRaises(ValueError):
+            SearchRunner(self.atlas, self.e8, path, split_depth=2, processes=1).run()
+
+    def test_signal_while_collecting(self):
+        """Test SIGTERM while a finished unit is recorded loses no subtree."""
+        options = dict(split_depth=1, max_orbits=40, max_unit_nodes=50, processes=1)
+        expected = SearchRunner(self.atlas, self.e8, self._path("whole.json"), **options).run()
+        path = self._path("signalled.json")
+
+        # While the children of a truncated unit are being split
+        split = SymmetryBrokenSearch.split
+        signalled = []
+
+        def split_and_signal(search, depth, prefix=()):
+            if prefix and not signalled:
+                signalled.append(prefix)
+                os.kill(os.getpid(), signal.SIGTERM)
+            return split(search, depth, prefix)
+
+        with mock.patch.object(SymmetryBrokenSearch, "split", split_and_signal):
+            with self.assertRaises(KeyboardInterrupt):
+                SearchRunner(self.atlas, self.e8, path, checkpoint_interval=0, **options).run()
+        self.assertTrue(signalled)
+
+        # Inside the critical section, here from the progress report
+        def signal_at_ten(progress: SearchProgress):
+            if progress.units_done == 10:
+                os.kill(os.getpid(), signal.SIGTERM)
+
+        with self.assertRaises(KeyboardInterrupt):
+            SearchRunner(self.atlas, self.e8, path, checkpoint_interval=0, report_interval=0,
+                         progress=signal_at_ten, **options).run()
+        self.assertEqual(SearchCheckpoint.load(path).finished, 10)
+
+        resumed = SearchRunner(self.atlas, self.e8, path, **options).run()
+        self.assertEqual(resumed.representatives, expected.representatives)
+        self.assertEqual((resumed.orbits, resumed.nodes, resumed.units),
+                         (expected.orbits, expected.nodes, expected.units))
+
+    def test_oversized_units_are_split(self):
+        """Test units over the node budget are replaced by their children."""
+        path = self._path("split.json")
+        result = SearchRunner(self.atlas, self.e8, path, split_depth=1, max_orbits=20,
+                              max_unit_nodes=10, processes=2).run()
+        checkpoint = SearchCheckpoint.load(path)
+        self.assertGreater(checkpoint.resplit, 0)
+        self.assertGreater(checkpoint.discarded_nodes, 0)
+        self.assertGreater(result.units, 120)
+        self.assertGreaterEqual(result.orbits, 20)
+        self.assertEqual(len(result.representatives), result.orbits)
+        for mapping in result.representatives:
+            self.assertIsNotNone(self.search.breaker.leader_stabilizer(mapping))
+
+    def test_shards_merge(self):
+        """Test shards cover the units once and merge into one result."""
+        paths = [self._path(f"shard{i}.json") for i in range(2)]
+        shards = [
+            SearchRunner(self.atlas, self.e8, path, split_depth=1, max_orbits=3,
+                         shard=(i, 2), processes=1).run()
+            for i, path in enumerate(paths)
+        ]
+        self.assertEqual(sum(r.units for r in shards), 120)
+        merged = merge_checkpoints(paths, self.atlas, self.e8)
+        self.assertEqual(merged.orbits, sum(r.orbits for r in shards))
+        self.assertEqual(merged.units, 120)
+        self.assertFalse(merged.complete)
+        with self.assertRaises(ValueError):
+            merge_checkpoints([paths[0], paths[0]], self.atlas, self.e8)
+        other = self._path("other.json")
+        SearchRunner(self.atlas, self.e8, other, split_depth=1, max_orbits=1,
+                     shard=(1, 2), processes=1).run()
+        with self.assertRaises(ValueError):
+            merge_checkpoints([paths[0], other], self.atlas, self.e8)
+
+    def test_progress_arithmetic(self):
+        """Test rates and estimates are exact integer arithmetic."""
+        progress = SearchProgress(units_done=4, units_left=12, nodes=300, discarded_nodes=100,
+                                  expansions=120, elapsed_ns=2_000_000_000, orbits=7)
+        self.assertEqual(progress.nodes_per_second, 200)
+        self.assertEqual(progress.branching_factor, Fraction(5, 2))
+        self.assertEqual(progress.remaining_nodes, 1200)
+        self.assertEqual(progress.eta_ns, 6_000_000_000)
+        self.assertIn("ETA 0:00:06", progress.format())
+
+
 if __name__ == "__main__":
     unittest.main()
\ No newline at end of file
@@ -0,0 +1,102 @@
+"""
+Tests for the union-find orbit and quotient engine.
+"""
+import unittest
+
+from atlas import AtlasGraph
+from atlas.symmetry import generate_s4_automorphism_group
+from e8 import E8RootSystem, e8_weyl_group
+from embedding import BitsetEmbeddingSearch, EmbeddingConstraints
+from analysis.orbits import UnionFind, OrbitPartition, OrbitQuotient
+from analysis.quotient_structure import QuotientAnalyzer
+
+
+class TestOrbitPartition(unittest.TestCase):
+    """Test partitions from generators and from keys."""
+
+    def setUp(self):
+        self.atlas = AtlasGraph()
+
+    def test_union_find(self):
+        """Unions report whether they merged two sets."""
+        uf = UnionFind(4)
+        self.assertTrue(uf.union(0, 1))
+        self.assertTrue(uf.union(2, 3))
+        self.assertFalse(uf.union(1, 0))
+        self.assertEqual(uf.find(0), uf.find(1))
+        self.assertNotEqual(uf.find(1), uf.find(2))
+
+    def test_s4_orbits(self):
+        """S4 has 30 orbits on the Atlas: 12 fixed, 12 of size 4, 6 of size 6."""
+        autos = generate_s4_automorphism_group(self.atlas.labels)
+        partition = OrbitPartition(autos, len(self.atlas.labels))
+        self.assertEqual(len(partition), 30)
+        self.assertEqual(partition.size_distribution(), {1: 12, 4: 12, 6: 6})
+        self.assertEqual(partition.representatives, sorted(partition.representatives))
+        for orbit in partition.orbits:
+            for v in orbit:
+                self.assertIs(partition.orbit_of(v), orbit)
+        self.assertEqual(sorted(set(partition.stabilizer_sizes(24))), [4, 6, 24])
+
+    def test_mirror_pairs(self):
+        """The orbits of tau are the 48 mirror pairs."""
+        partition = OrbitPartition([self.atlas.tau], len(self.atlas.labels))
+        self.assertEqual(partition.size_distribution(), {2: 48})
+        for a, b in partition.orbits:
+            self.assertEqual(self.atlas.tau[a], b)
+
+    def test_from_keys(self):
+        """Points with equal keys share a class; classes follow least points."""
+        partition = OrbitPartition.from_keys(["b", "a", "b", "c", "a"])
+        self.assertEqual(partition.orbits, [[0, 2], [1, 4], [3]])
+        self.assertEqual(partition.labels, [0, 1, 0, 2, 1])
+
+    def test_e7_orbits_on_e8_roots(self):
+        """W(E7) splits the 240 roots as 126 + 56 + 56 + 1 + 1."""
+        e8 = E8RootSystem()
+        weyl = e8_weyl_group(e8.roots, 7)
+        partition = OrbitPartition(weyl.generators, 240)
+        self.assertEqual(partition.size_distribution(), {1: 2, 56: 2, 126: 1})
+        self.assertEqual(len(partition.orbit_of(weyl.root_index[e8.roots[0]])), 126)
+        order = weyl.order()
+        for orbit, stabilizer in zip(partition.orbits, partition.stabilizer_sizes(order)):
+            self.assertEqual(len(orbit) * stabilizer, order)
+
+
+class TestOrbitQuotient(unittest.TestCase):
+    """Test quotient graphs."""
+
+    def test_small_quotient(self):
+        """Edges collapse onto classes; inner edges and repeats are dropped."""
+        partition = OrbitPartition.from_keys([0, 0, 1, 1, 2])
+        quotient = partition.quotient([(0, 1), (0, 2), (1, 3), (3, 4), (2, 3)])
+        self.assertEqual(quotient.edges, [(0, 1), (1, 2)])
+        self.assertEqual(quotient.neighbors, [[1], [0, 2], [1]])
+        self.assertEqual(quotient.degrees, [1, 2, 1])
+        self.assertTrue(quotient.is_connected)
+        self.assertEqual(quotient.distances(), [[0, 1, 2], [1, 0, 1], [2, 1, 0]])
+        matrix = quotient.adjacency_matrix()
+        self.assertEqual(OrbitQuotient.from_adjacency_matrix(matrix).edges, quotient.edges)
+
+    def test_disconnected(self):
+        """Components are found and distances are refused."""
+        quotient = OrbitQuotient(range(4), 4, [(0, 1), (2, 3)])
+        self.assertFalse(quotient.is_connected)
+        self.assertEqual(quotient.components().orbits, [[0, 1], [2, 3]])
+        self.assertIsNone(quotient.distances())
+
+    def test_sign_class_quotient(self):
+        """The embedding quotient lists every edge of its adjacency matrix."""
+        atlas = AtlasGraph()
+        e8 = E8RootSystem()
+        mapping = BitsetEmbeddingSearch(atlas, e8).search(EmbeddingConstraints(max_solutions=1))[0]
+        graph = QuotientAnalyzer(mapping, atlas, e8).build_quotient_graph()
+        self.assertEqual(len(graph.vertices), 48)
+        self.assertEqual(2 * len(graph.edges), sum(graph.degree_sequence))
+        for a, b in graph.edges:
+            i, j = graph.vertices.index(a), graph.vertices.index(b)
+            self.assertTrue(graph.adjacency_matrix[i][j])
+
+
+if __name__ == '__main__':
+    unittest.main()